@@ -44,7 +44,7 @@ elif [ "$suite" == "vector" ]; then
 	echo "${red}running all vector benchmarks${reset}"
 	./run.sh $action "simd"
     else
-	./run.sh $action "$bench" "$individual" "$5" "$6"
+	./run.sh $action "$bench" "$individual" "${@:5}"
     fi
     cd $cur_dir
 fi
@@ -0,0 +1,224 @@
+/**
+ * This code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ */
+
+#ifndef GENERICBITPACKING_H_
+#define GENERICBITPACKING_H_
+
+#include "common.h"
+
+namespace FastPForLib {
+
+/**
+ * Compile-time unrolled packers shared by bitpacking.cpp, bitpackingaligned.cpp,
+ * simdbitpacking.cpp and usimdbitpacking.cpp.
+ *
+ * Integer k of a group of "length" integers of "bit" bits occupies bits
+ * [k * bit, (k + 1) * bit) of the packed words, least significant bit first,
+ * so that a group uses (length * bit + 31) / 32 words. The SIMD versions apply
+ * the same layout to each of the four 32-bit lanes (integers j, j + 4, j + 8,
+ * ... go to lane j), which is the vertical layout of Lemire and Boytsov.
+ * Each recursion step handles one integer; the shift amounts are constants, so
+ * the compiler emits straight-line code for every bit width.
+ *
+ * The upstream FastPFor sources are not part of this tree; these packers were
+ * written for it and are not the hand-unrolled upstream kernels.
+ */
+
+template <uint32_t bit> struct BitMask {
+  static const uint32_t value = bit == 32 ? 0xFFFFFFFFU : (1U << (bit % 32)) - 1;
+};
+
+template <uint32_t bit, uint32_t k, uint32_t length> struct ScalarUnpacker {
+  static inline void run(const uint32_t *__restrict__ in,
+                         uint32_t *__restrict__ out) {
+    const uint32_t word = k * bit / 32, shift = k * bit % 32;
+    uint32_t value = in[word] >> shift;
+    if (shift + bit > 32)
+      value |= in[word + 1] << ((32 - shift) % 32);
+    out[k] = value & BitMask<bit>::value;
+    ScalarUnpacker<bit, k + 1, length>::run(in, out);
+  }
+};
+
+template <uint32_t bit, uint32_t length>
+struct ScalarUnpacker<bit, length, length> {
+  static inline void run(const uint32_t *__restrict__,
+                         uint32_t *__restrict__) {}
+};
+
+// the first integer written to a word assigns it, so the output need not be
+// zeroed
+template <uint32_t bit, uint32_t k, uint32_t length, bool mask>
+struct ScalarPacker {
+  static inline void run(const uint32_t *__restrict__ in,
+                         uint32_t *__restrict__ out) {
+    const uint32_t word = k * bit / 32, shift = k * bit % 32;
+    const uint32_t value = mask ? in[k] & BitMask<bit>::value : in[k];
+    if (shift == 0)
+      out[word] = value;
+    else
+      out[word] |= value << shift;
+    if (shift + bit > 32)
+      out[word + 1] = value >> ((32 - shift) % 32);
+    ScalarPacker<bit, k + 1, length, mask>::run(in, out);
+  }
+};
+
+template <uint32_t bit, uint32_t length, bool mask>
+struct ScalarPacker<bit, length, length, mask> {
+  static inline void run(const uint32_t *__restrict__,
+                         uint32_t *__restrict__) {}
+};
+
+template <uint32_t bit, uint32_t length>
+inline void genericunpack(const uint32_t *__restrict__ in,
+                          uint32_t *__restrict__ out) {
+  if (bit == 0) {
+    for (uint32_t k = 0; k < length; ++k)
+      out[k] = 0;
+    return;
+  }
+  ScalarUnpacker<bit, 0, length>::run(in, out);
+}
+
+template <uint32_t bit, uint32_t length, bool mask>
+inline void genericpack(const uint32_t *__restrict__ in,
+                        uint32_t *__restrict__ out) {
+  if (bit == 0)
+    return;
+  ScalarPacker<bit, 0, length, mask>::run(in, out);
+}
+
+template <bool aligned> inline __m128i loadlanes(const __m128i *p) {
+  return aligned ? _mm_load_si128(p) : _mm_loadu_si128(p);
+}
+
+template <bool aligned> inline void storelanes(__m128i *p, __m128i v) {
+  if (aligned)
+    _mm_store_si128(p, v);
+  else
+    _mm_storeu_si128(p, v);
+}
+
+/**
+ * Prefix sums of four consecutive integers with stride "delta" (1, 2 or 4; 0
+ * returns value unchanged): lane i gets value[i] + value[i - delta] + ... plus
+ * the matching one of the last "delta" lanes of prev, the four integers
+ * decoded before value. This undoes the D1, D2 and D4 delta coding of sorted
+ * lists (Delta::delta and Delta::deltaSIMD are D1 and D4) in two shifts and
+ * adds at most, without leaving the registers.
+ */
+template <uint32_t delta> inline __m128i prefixsum(__m128i value, __m128i prev) {
+  if (delta == 0)
+    return value;
+  if (delta < 2)
+    value = _mm_add_epi32(value, _mm_slli_si128(value, 4));
+  if (delta < 4)
+    value = _mm_add_epi32(value, _mm_slli_si128(value, 8));
+  if (delta == 1)
+    prev = _mm_shuffle_epi32(prev, _MM_SHUFFLE(3, 3, 3, 3));
+  else if (delta == 2)
+    prev = _mm_shuffle_epi32(prev, _MM_SHUFFLE(3, 2, 3, 2));
+  return _mm_add_epi32(value, prev);
+}
+
+// with delta > 0, the unpacked vectors are prefix-summed before being stored;
+// run returns the last vector stored
+template <uint32_t bit, uint32_t k, bool aligned, uint32_t delta>
+struct VerticalUnpacker {
+  static inline __m128i run(const __m128i *__restrict__ in,
+                            __m128i *__restrict__ out, __m128i prev) {
+    const uint32_t word = k * bit / 32, shift = k * bit % 32;
+    __m128i value = _mm_srli_epi32(loadlanes<aligned>(in + word), shift);
+    if (shift + bit > 32)
+      value = _mm_or_si128(value,
+                           _mm_slli_epi32(loadlanes<aligned>(in + word + 1),
+                                          (32 - shift) % 32));
+    if (bit < 32)
+      value = _mm_and_si128(value, _mm_set1_epi32(BitMask<bit>::value));
+    value = prefixsum<delta>(value, prev);
+    storelanes<aligned>(out + k, value);
+    return VerticalUnpacker<bit, k + 1, aligned, delta>::run(in, out, value);
+  }
+};
+
+template <uint32_t bit, bool aligned, uint32_t delta>
+struct VerticalUnpacker<bit, 32, aligned, delta> {
+  static inline __m128i run(const __m128i *__restrict__, __m128i *__restrict__,
+                            __m128i prev) {
+    return prev;
+  }
+};
+
+template <uint32_t bit, uint32_t k, bool aligned, bool mask>
+struct VerticalPacker {
+  static inline void run(const __m128i *__restrict__ in, __m128i *__restrict__ out,
+                         __m128i word) {
+    const uint32_t shift = k * bit % 32;
+    __m128i value = loadlanes<aligned>(in + k);
+    if (mask && bit < 32)
+      value = _mm_and_si128(value, _mm_set1_epi32(BitMask<bit>::value));
+    word = shift == 0 ? value : _mm_or_si128(word, _mm_slli_epi32(value, shift));
+    if (shift + bit >= 32) {
+      storelanes<aligned>(out + k * bit / 32, word);
+      word = _mm_srli_epi32(value, (32 - shift) % 32);
+    }
+    VerticalPacker<bit, k + 1, aligned, mask>::run(in, out, word);
+  }
+};
+
+template <uint32_t bit, bool aligned, bool mask>
+struct VerticalPacker<bit, 32, aligned, mask> {
+  static inline void run(const __m128i *__restrict__, __m128i *__restrict__,
+                         __m128i) {}
+};
+
+// 128 integers of "bit" bits from/to "bit" vectors of four lanes
+template <uint32_t bit, bool aligned>
+inline void verticalunpack(const __m128i *__restrict__ in,
+                           uint32_t *__restrict__ out) {
+  __m128i *dst = reinterpret_cast<__m128i *>(out);
+  if (bit == 0) {
+    for (uint32_t k = 0; k < 32; ++k)
+      storelanes<aligned>(dst + k, _mm_setzero_si128());
+    return;
+  }
+  VerticalUnpacker<bit, 0, aligned, 0>::run(in, dst, _mm_setzero_si128());
+}
+
+// verticalunpack fused with the prefix sum of prefixsum<delta>, to aligned
+// output; prev holds the four integers decoded before the block and the last
+// four of the block are returned
+template <uint32_t bit, uint32_t delta>
+inline __m128i verticalunpackdelta(__m128i prev, const __m128i *__restrict__ in,
+                                   uint32_t *__restrict__ out) {
+  __m128i *dst = reinterpret_cast<__m128i *>(out);
+  if (bit == 0) {
+    for (uint32_t k = 0; k < 32; ++k) {
+      prev = prefixsum<delta>(_mm_setzero_si128(), prev);
+      _mm_store_si128(dst + k, prev);
+    }
+    return prev;
+  }
+  return VerticalUnpacker<bit, 0, true, delta>::run(in, dst, prev);
+}
+
+template <uint32_t bit, bool aligned, bool mask>
+inline void verticalpack(const uint32_t *__restrict__ in,
+                         __m128i *__restrict__ out) {
+  if (bit == 0)
+    return;
+  VerticalPacker<bit, 0, aligned, mask>::run(
+      reinterpret_cast<const __m128i *>(in), out, _mm_setzero_si128());
+}
+
+} // namespace FastPForLib
+
+#define FASTPFOR_FOR_EACH_BIT(X)                                               \
+  X(0) X(1) X(2) X(3) X(4) X(5) X(6) X(7) X(8) X(9) X(10) X(11) X(12) X(13)    \
+  X(14) X(15) X(16) X(17) X(18) X(19) X(20) X(21) X(22) X(23) X(24) X(25)      \
+  X(26) X(27) X(28) X(29) X(30) X(31) X(32)
+
+#endif /* GENERICBITPACKING_H_ */
@@ -31,8 +31,46 @@
 
 namespace FastPForLib {
 
+// 16 * bit bytes to 128 integers, with the widest of the unpackers below
+// that the build allows (no AVX-512 unless the target enables it) and the
+// processor supports
 void simdhunpack(const uint8_t *__restrict__ in, uint32_t *__restrict__ out,
                  uint32_t bit);
+// "sse", "avx2" or "avx512"
+const char *simdhunpackname();
+
+// simdhunpack fused with the decoding of D1, D2 or D4 deltas: the output is
+// out[i] = delta[i] + out[i - 1], out[i - 2] or out[i - 4], the integers
+// before the block being taken from offset, the last four integers decoded
+// before it (zeros for the first block). Returns the last four integers of the
+// block, the offset of the next one. "out" must be 16-byte aligned.
+__m128i simdhunpackd1(__m128i offset, const uint8_t *__restrict__ in,
+                      uint32_t *__restrict__ out, uint32_t bit);
+__m128i simdhunpackd2(__m128i offset, const uint8_t *__restrict__ in,
+                      uint32_t *__restrict__ out, uint32_t bit);
+__m128i simdhunpackd4(__m128i offset, const uint8_t *__restrict__ in,
+                      uint32_t *__restrict__ out, uint32_t bit);
+
+void ssehunpack(const uint8_t *__restrict__ in, uint32_t *__restrict__ out,
+                uint32_t bit);
+void avx2hunpack(const uint8_t *__restrict__ in, uint32_t *__restrict__ out,
+                 uint32_t bit);
+#ifdef __AVX512F__
+void avx512hunpack(const uint8_t *__restrict__ in, uint32_t *__restrict__ out,
+                   uint32_t bit);
+#endif
+
+// 128 integers to 16 * bit bytes, the layout read by simdhunpack
+void simdhpack(const uint32_t *__restrict__ in, uint8_t *__restrict__ out,
+               uint32_t bit);
+#ifdef __AVX2__
+void avx2hpack(const uint32_t *__restrict__ in, uint8_t *__restrict__ out,
+               uint32_t bit);
+#endif
+#ifdef __AVX512VBMI__
+void avx512hpack(const uint32_t *__restrict__ in, uint8_t *__restrict__ out,
+                 uint32_t bit);
+#endif
 }
 
 #endif /* HORIZONTALBITPACKING_H_ */
@@ -0,0 +1,108 @@
+/**
+ * This code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ */
+
+/**
+ * Intersection of sorted lists of distinct integers (posting lists), decoded
+ * or compressed.
+ *
+ * Every function writes the common integers to "out", in order, and returns
+ * how many there are. The SIMD versions store whole vectors, so "out" must
+ * have room for the length of the shorter list plus 16 integers.
+ */
+
+#ifndef INTERSECTION_H_
+#define INTERSECTION_H_
+
+#include "common.h"
+#include "memutil.h"
+
+namespace FastPForLib {
+
+// merge, one comparison per step
+size_t scalarintersect(const uint32_t *A, size_t lenA, const uint32_t *B,
+                       size_t lenB, uint32_t *out);
+
+// every integer of "small" is looked up in "large" by an exponential search
+// from the position of the previous one: O(lenSmall log(lenLarge / lenSmall))
+size_t gallopingintersect(const uint32_t *small, size_t lenSmall,
+                          const uint32_t *large, size_t lenLarge,
+                          uint32_t *out);
+
+// block merges: a vector of A is compared with every lane of a vector of B
+// (4, 8 or 16 integers), the matches are compacted to "out" and the vector
+// with the smaller last integer is replaced by the next one
+size_t sseintersect(const uint32_t *A, size_t lenA, const uint32_t *B,
+                    size_t lenB, uint32_t *out);
+size_t avx2intersect(const uint32_t *A, size_t lenA, const uint32_t *B,
+                     size_t lenB, uint32_t *out);
+#ifdef __AVX512F__
+size_t avx512intersect(const uint32_t *A, size_t lenA, const uint32_t *B,
+                       size_t lenB, uint32_t *out);
+#endif
+
+// avx512intersect (in builds with AVX-512, if the processor supports it) when
+// neither list is AVX512Ratio times longer than the other, where it is the
+// fastest merge; otherwise avx2intersect if the processor supports it, else
+// sseintersect
+const size_t AVX512Ratio = 16;
+size_t simdintersect(const uint32_t *A, size_t lenA, const uint32_t *B,
+                     size_t lenB, uint32_t *out);
+// "sse", "avx2" or "avx512/avx2"
+const char *simdintersectname();
+
+// gallopingintersect when a list is more than GallopingRatio times longer
+// than the other, simdintersect otherwise
+const size_t GallopingRatio = 128;
+size_t intersect(const uint32_t *A, size_t lenA, const uint32_t *B,
+                 size_t lenB, uint32_t *out);
+
+/**
+ * A sorted list of distinct integers in blocks of BlockSize integers, each
+ * block D1-coded from the last integer of the previous one and packed with
+ * simdpack to the bit width of its largest delta (the last block is padded
+ * with zero deltas), plus a skip index holding the largest integer, bit width
+ * and position of every block. The skip index tells which blocks may hold a
+ * given integer without decoding any of them.
+ */
+class CompressedSortedList {
+public:
+  enum { BlockSize = 128 };
+
+  CompressedSortedList(const uint32_t *data, size_t length);
+
+  size_t size() const { return length; }
+  size_t blocks() const { return blockmax.size(); }
+  // in 32-bit words, the skip index included
+  size_t sizeInWords() const {
+    return packed.size() + blockmax.size() + blockoffset.size() +
+           blockbits.size() / 4;
+  }
+
+  // decodes block b to "out" (16-byte aligned, room for BlockSize integers)
+  // and returns its number of integers
+  size_t decodeblock(size_t b, uint32_t *out) const;
+  // decodes the whole list to "out" (16-byte aligned, room for the size
+  // rounded up to BlockSize)
+  void decode(uint32_t *out) const;
+
+  // intersects the decoded list "small" with this one, decoding only the
+  // blocks whose range holds an integer of "small"; returns the number of
+  // integers written to "out"
+  size_t intersect(const uint32_t *small, size_t lenSmall, uint32_t *out) const;
+  // the number of blocks the last call to intersect decoded
+  size_t decodedblocks() const { return lastdecodedblocks; }
+
+private:
+  size_t length;
+  std::vector<uint32_t, cacheallocator> packed;
+  std::vector<uint32_t> blockmax;
+  std::vector<uint32_t> blockoffset;
+  std::vector<uint8_t> blockbits;
+  mutable size_t lastdecodedblocks;
+};
+
+} // namespace FastPForLib
+
+#endif /* INTERSECTION_H_ */
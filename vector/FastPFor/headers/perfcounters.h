@@ -0,0 +1,122 @@
+/**
+ * This code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ */
+
+#ifndef PERFCOUNTERS
+#define PERFCOUNTERS
+
+#include "common.h"
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace FastPForLib {
+
+/**
+ * Hardware counters of the calling thread (Linux perf_event): cycles,
+ * instructions, L1D read misses, LLC read misses and branch misses.
+ * Used like WallClockTimer: reset() before, split() after the measured
+ * code; values accumulate over several splits. When perf_event is not
+ * available every counter stays at zero.
+ */
+class PerfCounters {
+public:
+  enum { CYCLES, INSTRUCTIONS, L1D_MISSES, LLC_MISSES, BRANCH_MISSES, COUNT };
+
+  uint64_t total[COUNT];
+
+  PerfCounters() : leader(-1), opened(0) {
+    for (int i = 0; i < COUNT; ++i) {
+      fd[i] = index[i] = -1;
+      total[i] = start[i] = 0;
+    }
+#ifdef __linux__
+    const uint64_t cache = PERF_COUNT_HW_CACHE_OP_READ << 8 |
+                           PERF_COUNT_HW_CACHE_RESULT_MISS << 16;
+    const uint32_t types[COUNT] = {PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE,
+                                   PERF_TYPE_HW_CACHE, PERF_TYPE_HW_CACHE,
+                                   PERF_TYPE_HARDWARE};
+    const uint64_t configs[COUNT] = {
+        PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+        PERF_COUNT_HW_CACHE_L1D | cache, PERF_COUNT_HW_CACHE_LL | cache,
+        PERF_COUNT_HW_BRANCH_MISSES};
+    for (int i = 0; i < COUNT; ++i) {
+      perf_event_attr attr;
+      memset(&attr, 0, sizeof(attr));
+      attr.type = types[i];
+      attr.size = sizeof(attr);
+      attr.config = configs[i];
+      attr.disabled = leader < 0;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      attr.read_format = PERF_FORMAT_GROUP;
+      fd[i] = (int)syscall(__NR_perf_event_open, &attr, 0, -1, leader, 0);
+      if (fd[i] < 0) {
+        if (i == CYCLES)
+          return;
+        continue;
+      }
+      if (i == CYCLES)
+        leader = fd[i];
+      index[i] = opened++;
+    }
+    ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+  }
+
+  ~PerfCounters() {
+#ifdef __linux__
+    for (int i = 0; i < COUNT; ++i)
+      if (fd[i] >= 0)
+        close(fd[i]);
+#endif
+  }
+
+  bool enabled() const { return leader >= 0; }
+
+  void reset() { read(start); }
+
+  void split() {
+    uint64_t current[COUNT];
+    read(current);
+    for (int i = 0; i < COUNT; ++i)
+      total[i] += current[i] - start[i];
+  }
+
+  void clear() {
+    for (int i = 0; i < COUNT; ++i)
+      total[i] = 0;
+  }
+
+  double ipc() const {
+    return total[CYCLES] ? double(total[INSTRUCTIONS]) / double(total[CYCLES])
+                         : 0.0;
+  }
+
+private:
+  int leader, opened;
+  int fd[COUNT], index[COUNT];
+  uint64_t start[COUNT];
+
+  void read(uint64_t *values) const {
+    uint64_t buffer[COUNT + 1] = {0};
+#ifdef __linux__
+    if (enabled() &&
+        ::read(leader, buffer, sizeof(buffer)) < (ssize_t)sizeof(uint64_t))
+      buffer[0] = 0;
+#endif
+    for (int i = 0; i < COUNT; ++i)
+      values[i] = index[i] >= 0 && index[i] < (int)buffer[0]
+                      ? buffer[1 + index[i]]
+                      : 0;
+  }
+};
+
+} // namespace FastPForLib
+
+#endif
@@ -18,6 +18,18 @@ void simdpackwithoutmask(const uint32_t *__restrict__ in,
 void simdunpack(const __m128i *__restrict__ in, uint32_t *__restrict__ out,
                 uint32_t bit);
 
+// simdunpack fused with the decoding of D1, D2 or D4 deltas: the output is
+// out[i] = delta[i] + out[i - 1], out[i - 2] or out[i - 4], the integers
+// before the block being taken from offset, the last four integers decoded
+// before it (zeros for the first block). Returns the last four integers of the
+// block, the offset of the next one.
+__m128i simdunpackd1(__m128i offset, const __m128i *__restrict__ in,
+                     uint32_t *__restrict__ out, uint32_t bit);
+__m128i simdunpackd2(__m128i offset, const __m128i *__restrict__ in,
+                     uint32_t *__restrict__ out, uint32_t bit);
+__m128i simdunpackd4(__m128i offset, const __m128i *__restrict__ in,
+                     uint32_t *__restrict__ out, uint32_t bit);
+
 void SIMD_fastunpack_32(const __m128i *__restrict__ in,
                         uint32_t *__restrict__ out, const uint32_t bit);
 void SIMD_fastpackwithoutmask_32(const uint32_t *__restrict__ in,
@@ -0,0 +1,165 @@
+/**
+ * Runs every codec registered in CODECFactory (codecfactory.h) over the
+ * synthetic.h generators and reports, for each distribution and codec, the
+ * compressed size in bits per integer and the encode and decode speeds in
+ * millions of integers per second. Each codec first has to give back its
+ * input exactly; a codec that does not, or that throws, is reported as
+ * failed and the benchmark exits with an error once all codecs have run.
+ *
+ * The uniform and clustered arrays are sorted lists of distinct integers, as
+ * posting lists are, and are compressed as gaps (Delta::fastDelta), which is
+ * not timed. The Zipfian array is compressed as is.
+ *
+ * This tree holds the FastPFor headers but not the library sources, so the
+ * bit packing and Stream VByte routines the codecs link against were written
+ * for it under src/ and are not the upstream kernels. The "kernels" column
+ * names the files of those a codec calls, or "upstream" if it runs on the
+ * headers only. In particular the maskedvbyte row measures varintdecode.cpp,
+ * which lacks the shuffle tables of the MaskedVByte decoder.
+ */
+
+#include <exception>
+#include <iostream>
+#include <iomanip>
+#include <map>
+#include <vector>
+#include "codecfactory.h"
+#include "deltautil.h"
+#include "synthetic.h"
+#include "ztimer.h"
+
+using namespace std;
+using namespace FastPForLib;
+
+struct Dataset {
+  string name;
+  vector<uint32_t, cacheallocator> data;
+};
+
+// N integers each; the sorted lists are drawn from [0, N * gap)
+vector<Dataset> generatedatasets(uint32_t N, uint32_t gap, uint32_t seed) {
+  vector<Dataset> datasets(3);
+  datasets[0].name = "uniform";
+  datasets[0].data = UniformDataGenerator(seed).generateUniform(N, N * gap);
+  datasets[1].name = "clustered";
+  datasets[1].data =
+      ClusteredDataGenerator(seed).generateClustered(N, N * gap);
+  for (size_t d = 0; d < 2; ++d)
+    Delta::fastDelta(&datasets[d].data[0], N);
+
+  // as generateZipfianArray32, with a fixed seed
+  ZipfianGenerator zipf(seed);
+  zipf.init(1U << 20, 1.0);
+  datasets[2].name = "zipfian";
+  datasets[2].data.resize(N);
+  for (size_t k = 0; k < N; ++k)
+    datasets[2].data[k] = zipf.nextInt();
+  return datasets;
+}
+
+// the src/ files, written for this tree, whose kernels a codec calls; kept by
+// hand from the functions each codec header calls, so a codec or a src/ file
+// added to the Makefile needs an entry here
+string kernels(const string &name) {
+  static const map<string, string> local = {
+      {"fastbinarypacking8", "bitpackingaligned"},
+      {"fastbinarypacking16", "bitpackingaligned"},
+      {"fastbinarypacking32", "bitpacking"},
+      {"BP32", "bitpacking"},
+      {"fastpfor128", "bitpacking"},
+      {"fastpfor256", "bitpacking"},
+      {"simdfastpfor128", "bitpacking,simdbitpacking,usimdbitpacking"},
+      {"simdfastpfor256", "bitpacking,simdbitpacking,usimdbitpacking"},
+      {"simplepfor", "bitpacking"},
+      {"simdsimplepfor", "usimdbitpacking"},
+      {"pfor", "bitpacking"},
+      {"simdpfor", "usimdbitpacking"},
+      {"pfor2008", "bitpacking"},
+      {"simdnewpfor", "usimdbitpacking"},
+      {"newpfor", "bitpacking"},
+      {"optpfor", "bitpacking"},
+      {"simdoptpfor", "usimdbitpacking"},
+      {"streamvbyte", "streamvbyte"},
+      {"maskedvbyte", "varintdecode"},
+      {"simdbinarypacking", "simdbitpacking"}};
+  const map<string, string>::const_iterator i = local.find(name);
+  return i == local.end() ? "upstream" : i->second;
+}
+
+// returns false if the codec does not give back its input
+bool benchmark(IntegerCODEC &codec, const vector<uint32_t, cacheallocator> &data,
+               uint32_t T, double &bitsperint, double &encodespeed,
+               double &decodespeed) {
+  const size_t N = data.size();
+  vector<uint32_t, cacheallocator> compressed(2 * N + 1024);
+  vector<uint32_t, cacheallocator> recovered(N + 1024);
+  WallClockTimer z;
+  uint64_t encodetime = 0, decodetime = 0;
+  size_t compressedsize = 0;
+
+  // the first pass warms up and checks the round trip
+  for (uint32_t t = 0; t <= T; ++t) {
+    compressedsize = compressed.size();
+    z.reset();
+    codec.encodeArray(&data[0], N, &compressed[0], compressedsize);
+    if (t > 0)
+      encodetime += z.split();
+    if (compressedsize > compressed.size())
+      return false;
+
+    size_t recoveredsize = recovered.size();
+    z.reset();
+    codec.decodeArray(&compressed[0], compressedsize, &recovered[0],
+                      recoveredsize);
+    if (t > 0)
+      decodetime += z.split();
+    if (t == 0 && (recoveredsize != N ||
+                   !equal(data.begin(), data.end(), recovered.begin())))
+      return false;
+  }
+
+  bitsperint = 32.0 * compressedsize / N;
+  encodespeed = double(N) * T / max<uint64_t>(encodetime, 1);
+  decodespeed = double(N) * T / max<uint64_t>(decodetime, 1);
+  return true;
+}
+
+bool codecbenchmark(uint32_t N = 1U << 16, uint32_t gap = 1U << 6,
+                    uint32_t T = 1U << 6) {
+  const vector<Dataset> datasets = generatedatasets(N, gap, 12345);
+  const vector<string> names = CODECFactory::allNames();
+  bool ok = true;
+
+  cout << "# " << N << " integers per array, average gap " << gap
+       << " in the sorted lists, " << T << " repetitions" << endl;
+  cout << "# distribution\tcodec\tkernels\tbits/int\tencode mis/s\t"
+          "decode mis/s"
+       << endl;
+  for (const Dataset &dataset : datasets) {
+    for (const string &name : names) {
+      double bitsperint = 0, encodespeed = 0, decodespeed = 0;
+      bool passed = false;
+      try {
+        passed = benchmark(*CODECFactory::getFromName(name), dataset.data, T,
+                           bitsperint, encodespeed, decodespeed);
+      } catch (const exception &e) {
+        cout << "# " << name << ": " << e.what() << endl;
+      }
+      cout << dataset.name << "\t" << left << setw(24) << name << "\t"
+           << kernels(name) << right;
+      if (passed) {
+        cout << fixed << setprecision(2) << "\t" << bitsperint << "\t"
+             << encodespeed << "\t" << decodespeed << endl;
+      } else {
+        cout << "\tfailed" << endl;
+        ok = false;
+      }
+    }
+    cout << endl;
+  }
+  return ok;
+}
+
+int main() {
+  return codecbenchmark() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,200 @@
+/**
+ * Decodes delta-coded sorted lists, packed in blocks of 128 integers with the
+ * vertical (simdpack) and the horizontal (simdhpack) layouts, in two ways:
+ *
+ * - two passes, as Delta::process does: every block is unpacked, then the
+ *   deltas of the whole output are undone (Delta::fastinverseDelta2 for D1,
+ *   Delta::inverseDeltaSIMD for D4, the in-register sums of prefixsum<2> for
+ *   D2, which deltautil.h lacks);
+ * - fused, with simdunpackd1/d2/d4 and simdhunpackd1/d2/d4, which prefix-sum
+ *   each vector before storing it, so the output is written once and never
+ *   read back.
+ *
+ * Each block uses the bit width of its largest delta. For every distribution,
+ * layout and delta coding the benchmark reports the bits per integer and the
+ * speeds, in millions of integers per second, of the plain unpacking (no
+ * deltas undone, the bound of the two others), of the two-pass and of the
+ * fused decoding, and the speedup of the latter. Both decodings must give back
+ * the list exactly, or the benchmark exits with an error.
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include "deltautil.h"
+#include "genericbitpacking.h"
+#include "horizontalbitpacking.h"
+#include "simdbitpacking.h"
+#include "synthetic.h"
+#include "ztimer.h"
+
+using namespace std;
+using namespace FastPForLib;
+
+typedef vector<uint32_t, cacheallocator> uint32vector;
+
+typedef void (*packfnc)(const uint32_t *, uint32_t *, uint32_t);
+typedef void (*unpackfnc)(const uint32_t *, uint32_t *, uint32_t);
+typedef __m128i (*fusedfnc)(__m128i, const uint32_t *, uint32_t *, uint32_t);
+
+// 128 integers of "bit" bits take 4 * bit words in both layouts
+struct Layout {
+  const char *name;
+  packfnc pack;
+  unpackfnc unpack;
+  fusedfnc fused[3]; // D1, D2, D4
+};
+
+const Layout layouts[] = {
+    {"vertical",
+     [](const uint32_t *in, uint32_t *out, uint32_t bit) {
+       simdpack(in, reinterpret_cast<__m128i *>(out), bit);
+     },
+     [](const uint32_t *in, uint32_t *out, uint32_t bit) {
+       simdunpack(reinterpret_cast<const __m128i *>(in), out, bit);
+     },
+     {[](__m128i offset, const uint32_t *in, uint32_t *out, uint32_t bit) {
+        return simdunpackd1(offset, reinterpret_cast<const __m128i *>(in), out,
+                            bit);
+      },
+      [](__m128i offset, const uint32_t *in, uint32_t *out, uint32_t bit) {
+        return simdunpackd2(offset, reinterpret_cast<const __m128i *>(in), out,
+                            bit);
+      },
+      [](__m128i offset, const uint32_t *in, uint32_t *out, uint32_t bit) {
+        return simdunpackd4(offset, reinterpret_cast<const __m128i *>(in), out,
+                            bit);
+      }}},
+    {"horizontal",
+     [](const uint32_t *in, uint32_t *out, uint32_t bit) {
+       simdhpack(in, reinterpret_cast<uint8_t *>(out), bit);
+     },
+     [](const uint32_t *in, uint32_t *out, uint32_t bit) {
+       simdhunpack(reinterpret_cast<const uint8_t *>(in), out, bit);
+     },
+     {[](__m128i offset, const uint32_t *in, uint32_t *out, uint32_t bit) {
+        return simdhunpackd1(offset, reinterpret_cast<const uint8_t *>(in),
+                             out, bit);
+      },
+      [](__m128i offset, const uint32_t *in, uint32_t *out, uint32_t bit) {
+        return simdhunpackd2(offset, reinterpret_cast<const uint8_t *>(in),
+                             out, bit);
+      },
+      [](__m128i offset, const uint32_t *in, uint32_t *out, uint32_t bit) {
+        return simdhunpackd4(offset, reinterpret_cast<const uint8_t *>(in),
+                             out, bit);
+      }}}};
+
+const uint32_t deltas[3] = {1, 2, 4};
+
+// the second pass of the two-pass decoding
+void inverseprefix(uint32_t *data, size_t N, uint32_t delta) {
+  if (delta == 1) {
+    Delta::fastinverseDelta2(data, N);
+  } else if (delta == 4) {
+    Delta::inverseDeltaSIMD(data, N);
+  } else {
+    __m128i prev = _mm_setzero_si128();
+    __m128i *pCurr = reinterpret_cast<__m128i *>(data);
+    for (size_t k = 0; k < N / 4; ++k, ++pCurr) {
+      prev = prefixsum<2>(_mm_load_si128(pCurr), prev);
+      _mm_store_si128(pCurr, prev);
+    }
+  }
+}
+
+// returns false if a decoding does not give back the list
+bool benchmark(const Layout &layout, const uint32vector &data, uint32_t d,
+               uint32_t T) {
+  const size_t N = data.size(), blocks = N / 128;
+  const uint32_t delta = deltas[d];
+  uint32vector deltacoded(data);
+  for (size_t i = N - 1; i >= delta; --i)
+    deltacoded[i] -= deltacoded[i - delta];
+
+  vector<uint32_t> bits(blocks);
+  uint32vector compressed(N + 128);
+  size_t compressedsize = 0;
+  for (size_t b = 0; b < blocks; ++b) {
+    bits[b] = maxbits(deltacoded.begin() + 128 * b,
+                      deltacoded.begin() + 128 * (b + 1));
+    layout.pack(&deltacoded[128 * b], &compressed[compressedsize], bits[b]);
+    compressedsize += 4 * bits[b];
+  }
+
+  uint32vector recovered(N);
+  WallClockTimer z;
+  uint64_t unpacktime = 0, twopasstime = 0, fusedtime = 0;
+  // the first pass warms up and checks the decodings
+  for (uint32_t t = 0; t <= T; ++t) {
+    z.reset();
+    for (size_t b = 0, pos = 0; b < blocks; pos += 4 * bits[b++])
+      layout.unpack(&compressed[pos], &recovered[128 * b], bits[b]);
+    if (t > 0)
+      unpacktime += z.split();
+
+    z.reset();
+    for (size_t b = 0, pos = 0; b < blocks; pos += 4 * bits[b++])
+      layout.unpack(&compressed[pos], &recovered[128 * b], bits[b]);
+    inverseprefix(&recovered[0], N, delta);
+    if (t > 0)
+      twopasstime += z.split();
+    if (t == 0 && !equal(data.begin(), data.end(), recovered.begin()))
+      return false;
+    if (t == 0)
+      fill(recovered.begin(), recovered.end(), 0);
+
+    z.reset();
+    __m128i offset = _mm_setzero_si128();
+    for (size_t b = 0, pos = 0; b < blocks; pos += 4 * bits[b++])
+      offset = layout.fused[d](offset, &compressed[pos], &recovered[128 * b],
+                               bits[b]);
+    if (t > 0)
+      fusedtime += z.split();
+    if (t == 0 && !equal(data.begin(), data.end(), recovered.begin()))
+      return false;
+  }
+
+  const double twopass = double(N) * T / max<uint64_t>(twopasstime, 1);
+  const double fused = double(N) * T / max<uint64_t>(fusedtime, 1);
+  cout << fixed << setprecision(2) << "\tD" << delta << "\t"
+       << 32.0 * compressedsize / N << "\t"
+       << double(N) * T / max<uint64_t>(unpacktime, 1) << "\t" << twopass
+       << "\t" << fused << "\t" << fused / twopass << endl;
+  return true;
+}
+
+bool deltabenchmark(uint32_t N = 1U << 22, uint32_t gap = 1U << 4,
+                    uint32_t T = 1U << 5) {
+  vector<pair<string, uint32vector>> datasets;
+  datasets.push_back(make_pair(
+      "uniform", UniformDataGenerator(12345).generateUniform(N, N * gap)));
+  datasets.push_back(make_pair(
+      "clustered",
+      ClusteredDataGenerator(12345).generateClustered(N, N * gap)));
+  bool ok = true;
+
+  cout << "# " << N << " sorted integers per list, average gap " << gap << ", "
+       << T << " repetitions, horizontal unpacker: " << simdhunpackname()
+       << endl;
+  cout << "# distribution\tlayout\tdelta\tbits/int\tunpack mis/s\t"
+          "two-pass mis/s\tfused mis/s\tspeedup"
+       << endl;
+  for (const pair<string, uint32vector> &dataset : datasets) {
+    for (const Layout &layout : layouts) {
+      for (uint32_t d = 0; d < 3; ++d) {
+        cout << dataset.first << "\t" << layout.name;
+        if (!benchmark(layout, dataset.second, d, T)) {
+          cout << "\tD" << deltas[d] << "\tfailed" << endl;
+          ok = false;
+        }
+      }
+    }
+    cout << endl;
+  }
+  return ok;
+}
+
+int main() {
+  return deltabenchmark() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
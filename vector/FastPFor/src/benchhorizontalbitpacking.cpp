@@ -7,6 +7,7 @@
 #include "rolledbitpacking.h"
 #include "synthetic.h"
 #include "ztimer.h"
+#include "perfcounters.h"
 //#include "horizontalbitpacking.h"
 
 using namespace std;
@@ -14,6 +15,53 @@ using namespace FastPForLib;
 
 namespace FastPForLib {
 void simdhunpack(const uint8_t * in, uint32_t * out, uint32_t bit);
+const char *simdhunpackname();
+void ssehunpack(const uint8_t * in, uint32_t * out, uint32_t bit);
+void avx2hunpack(const uint8_t * in, uint32_t * out, uint32_t bit);
+#ifdef __AVX512F__
+void avx512hunpack(const uint8_t * in, uint32_t * out, uint32_t bit);
+#endif
+void simdhpack(const uint32_t * in, uint8_t * out, uint32_t bit);
+#ifdef __AVX2__
+void avx2hpack(const uint32_t * in, uint8_t * out, uint32_t bit);
+#endif
+#ifdef __AVX512VBMI__
+void avx512hpack(const uint32_t * in, uint8_t * out, uint32_t bit);
+#endif
+}
+
+// the horizontal packers built for this target, narrowest first
+typedef void (*hpackfnc)(const uint32_t *, uint8_t *, uint32_t);
+const hpackfnc hpackers[] = {simdhpack,
+#ifdef __AVX2__
+                             avx2hpack,
+#endif
+#ifdef __AVX512VBMI__
+                             avx512hpack,
+#endif
+};
+const char *const hpackernames[] = {"sse",
+#ifdef __AVX2__
+                                    "avx2",
+#endif
+#ifdef __AVX512VBMI__
+                                    "avx512",
+#endif
+};
+const uint32_t hpackercount = sizeof(hpackers) / sizeof(hpackers[0]);
+
+// the horizontal unpackers of this build that the processor supports, SSE first
+typedef void (*hunpackfnc)(const uint8_t *, uint32_t *, uint32_t);
+vector<pair<hunpackfnc, string>> hunpackers() {
+  vector<pair<hunpackfnc, string>> ans(1, make_pair(ssehunpack, string("sse")));
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2"))
+    ans.push_back(make_pair(avx2hunpack, string("avx2")));
+#ifdef __AVX512F__
+  if (__builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("avx512vbmi"))
+    ans.push_back(make_pair(avx512hunpack, string("avx512")));
+#endif
+  return ans;
 }
 
 void maskfnc(vector<uint32_t, cacheallocator> &out, const uint32_t L) {
@@ -26,14 +74,32 @@ void maskfnc(vector<uint32_t, cacheallocator> &out, const uint32_t L) {
 
 void horizontalunpack(const vector<uint32_t, cacheallocator> &data,
                       vector<uint32_t, cacheallocator> &out,
-                      const uint32_t bit) {
+                      const uint32_t bit, hunpackfnc hunpack = simdhunpack) {
   const size_t N = out.size();
   for (size_t k = 0; k < N / 128; ++k) {
-    simdhunpack(reinterpret_cast<const uint8_t *>(&data[0] + 4 * bit * k),
+    hunpack(reinterpret_cast<const uint8_t *>(&data[0] + 4 * bit * k),
                 &out[0] + 128 * k, bit);
   }
 }
 
+// scalar reference for horizontalunpack: the rolled unpack of the same layout
+void scalarunpack(const vector<uint32_t, cacheallocator> &data,
+                  vector<uint32_t, cacheallocator> &out, const uint32_t bit) {
+  const size_t N = out.size();
+  for (size_t k = 0; k < N / 32; ++k) {
+    unpack(&data[0] + bit * k, &out[0] + 32 * k, bit);
+  }
+}
+
+void horizontalpack(hpackfnc hpack, const vector<uint32_t, cacheallocator> &data,
+                    vector<uint32_t, cacheallocator> &out, const uint32_t bit) {
+  const size_t N = data.size();
+  for (size_t k = 0; k < N / 128; ++k) {
+    hpack(&data[0] + 128 * k,
+          reinterpret_cast<uint8_t *>(&out[0] + 4 * bit * k), bit);
+  }
+}
+
 void pack(const vector<uint32_t, cacheallocator> &data,
           vector<uint32_t, cacheallocator> &out, const uint32_t bit) {
   const size_t N = data.size();
@@ -63,15 +129,42 @@ void simplebenchmark(string label, uint32_t N = 1U << 16, uint32_t T = 1U << 9,
   vector<uint32_t, cacheallocator> data = generateArray32(N);
   vector<uint32_t, cacheallocator> compressed(N, 0);
   vector<uint32_t, cacheallocator> recovered(N, 0);
+  vector<uint32_t, cacheallocator> scalarrecovered(N, 0);
+  vector<uint32_t, cacheallocator> hcompressed(N, 0);
   WallClockTimer z;
+  PerfCounters counters;
   uint64_t packtime, packtimewm, unpacktime;
   uint64_t simdpacktime, simdpacktimewm, simdunpacktime;
-  uint64_t horizontalunpacktime;
+  uint64_t horizontalunpacktime, scalarunpacktime;
+  uint64_t scalarpacktime, horizontalpacktime[hpackercount];
+  const vector<pair<hunpackfnc, string>> unpackers = hunpackers();
+  vector<uint64_t> isaunpacktime(unpackers.size());
+  vector<vector<uint64_t>> isaunpacktimes(unpackers.size(), vector<uint64_t>(32));
 
   uint64_t horizontalunpacktimes[32] = {0};
+  uint64_t scalarunpacktimes[32] = {0};
+  uint64_t horizontalunpackcycles[32] = {0};
+  uint64_t horizontalunpackinstructions[32] = {0};
+  uint64_t horizontalunpackmisses[32][3] = {{0}};
+  uint64_t scalarpacktimes[32] = {0};
+  uint64_t horizontalpacktimes[hpackercount][32] = {{0}};
+
+  if (!counters.enabled())
+    cout << "# hardware performance counters are not available" << endl;
 
   //cout << "#million of integers per second: higher is better" << endl;
   //cout << "#bit, pack, pack without mask, unpack" << endl;
+  cout << "# bit, unpack mis/s (" << simdhunpackname() << "), IPC, cycles/int, "
+          "L1D/LLC/branch misses per 1000 ints, scalar unpack mis/s, unpack "
+          "speedup, scalar pack mis/s";
+  for (uint32_t p = 0; p < hpackercount; ++p)
+    cout << ", " << hpackernames[p] << " pack mis/s";
+  cout << ", pack speedup (" << hpackernames[hpackercount - 1] << ")";
+  for (size_t u = 0; u < unpackers.size(); ++u)
+    cout << ", " << unpackers[u].second << " unpack mis/s";
+  for (size_t u = 1; u < unpackers.size(); ++u)
+    cout << ", " << unpackers[u].second << "/sse unpack speedup";
+  cout << endl;
 
   for (uint32_t repeat = 1; repeat <= R; ++repeat) {
     cout << label << endl;
@@ -80,29 +173,115 @@ void simplebenchmark(string label, uint32_t N = 1U << 16, uint32_t T = 1U << 9,
       uint32_t bit = 32 - bitindex;
       maskfnc(data, bit);
       horizontalunpacktime = 0;
+      scalarunpacktime = 0;
+      scalarpacktime = 0;
+      for (uint32_t p = 0; p < hpackercount; ++p)
+        horizontalpacktime[p] = 0;
+      for (size_t u = 0; u < unpackers.size(); ++u)
+        isaunpacktime[u] = 0;
+      counters.clear();
 
       for (uint32_t t = 0; t < T; ++t) {
         compressed.clear();
         compressed.resize(N * bit / 32, 0);
         recovered.clear();
         recovered.resize(N, 0);
+        scalarrecovered.clear();
+        scalarrecovered.resize(N, 0);
 
+        z.reset();
         pack(data, compressed, bit);
+        if (t > 0)
+          scalarpacktime += z.split();
+
+        // round trip: the horizontal packers must write what the scalar pack
+        // writes, which the unpackers below must read back
+        for (uint32_t p = 0; p < hpackercount; ++p) {
+          hcompressed.clear();
+          hcompressed.resize(N * bit / 32, 0);
+          z.reset();
+          horizontalpack(hpackers[p], data, hcompressed, bit);
+          if (t > 0)
+            horizontalpacktime[p] += z.split();
+          if (hcompressed != compressed) {
+            cout << " Bug3! " << hpackernames[p]
+                 << " horizontal and scalar packing differ" << endl;
+            return;
+          }
+        }
 
         z.reset();
+        counters.reset();
         horizontalunpack(compressed, recovered, bit);
-        if (t > 0)
+        if (t > 0) {
           horizontalunpacktime += z.split();
+          counters.split();
+        }
 
         if (!equalOnFirstBits(data, recovered, bit)) {
           cout << " Bug1!" << endl;
           return;
         }
+
+        z.reset();
+        scalarunpack(compressed, scalarrecovered, bit);
+        if (t > 0)
+          scalarunpacktime += z.split();
+
+        if (scalarrecovered != recovered) {
+          cout << " Bug2! horizontal and scalar unpacking differ" << endl;
+          return;
+        }
+
+        for (size_t u = 0; u < unpackers.size(); ++u) {
+          recovered.clear();
+          recovered.resize(N, 0);
+          z.reset();
+          horizontalunpack(compressed, recovered, bit, unpackers[u].first);
+          if (t > 0)
+            isaunpacktime[u] += z.split();
+          if (scalarrecovered != recovered) {
+            cout << " Bug4! " << unpackers[u].second
+                 << " horizontal and scalar unpacking differ" << endl;
+            return;
+          }
+        }
       }
 
       horizontalunpacktimes[bitindex] += horizontalunpacktime;
+      scalarunpacktimes[bitindex] += scalarunpacktime;
+      scalarpacktimes[bitindex] += scalarpacktime;
+      for (uint32_t p = 0; p < hpackercount; ++p)
+        horizontalpacktimes[p][bitindex] += horizontalpacktime[p];
+      for (size_t u = 0; u < unpackers.size(); ++u)
+        isaunpacktimes[u][bitindex] += isaunpacktime[u];
+      horizontalunpackcycles[bitindex] += counters.total[PerfCounters::CYCLES];
+      horizontalunpackinstructions[bitindex] += counters.total[PerfCounters::INSTRUCTIONS];
+      horizontalunpackmisses[bitindex][0] += counters.total[PerfCounters::L1D_MISSES];
+      horizontalunpackmisses[bitindex][1] += counters.total[PerfCounters::LLC_MISSES];
+      horizontalunpackmisses[bitindex][2] += counters.total[PerfCounters::BRANCH_MISSES];
 
+      // bit, mis/s, IPC, cycles/int, L1D/LLC/branch misses per 1000 ints,
+      // then the scalar unpack mis/s and the speedup of the horizontal unpack over it,
+      // the scalar pack mis/s, the mis/s of each horizontal packer and the
+      // speedup of the widest one over the scalar pack, the mis/s of each
+      // horizontal unpacker and the speedup of the wider ones over SSE
+      const double ints = double(N) * (T - 1) * repeat;
       cout << bit << "\t" << N * (T - 1) * repeat / double(horizontalunpacktimes[bitindex]) << "\t\t";
+      cout << (horizontalunpackcycles[bitindex] ? double(horizontalunpackinstructions[bitindex]) / horizontalunpackcycles[bitindex] : 0.0) << "\t";
+      cout << horizontalunpackcycles[bitindex] / ints << "\t";
+      for (int m = 0; m < 3; ++m)
+        cout << 1000 * horizontalunpackmisses[bitindex][m] / ints << "\t";
+      cout << N * (T - 1) * repeat / double(scalarunpacktimes[bitindex]) << "\t";
+      cout << double(scalarunpacktimes[bitindex]) / horizontalunpacktimes[bitindex] << "\t";
+      cout << N * (T - 1) * repeat / double(scalarpacktimes[bitindex]) << "\t";
+      for (uint32_t p = 0; p < hpackercount; ++p)
+        cout << N * (T - 1) * repeat / double(horizontalpacktimes[p][bitindex]) << "\t";
+      cout << double(scalarpacktimes[bitindex]) / horizontalpacktimes[hpackercount - 1][bitindex] << "\t";
+      for (size_t u = 0; u < unpackers.size(); ++u)
+        cout << N * (T - 1) * repeat / double(isaunpacktimes[u][bitindex]) << "\t";
+      for (size_t u = 1; u < unpackers.size(); ++u)
+        cout << double(isaunpacktimes[0][bitindex]) / isaunpacktimes[u][bitindex] << "\t";
       cout << endl;
     }
   }
@@ -0,0 +1,168 @@
+/**
+ * Intersects a short sorted list with a long one, for several ratios of their
+ * lengths, with every algorithm of intersection.h: on decoded lists the
+ * scalar merge, galloping, the SSE, AVX2 and AVX-512 block merges (those the
+ * processor supports) and the adaptive intersect; on the long list compressed
+ * in a CompressedSortedList, decoding it whole then calling intersect, and
+ * CompressedSortedList::intersect, which decodes only the blocks its skip
+ * index points to. Every algorithm must find the same integers as the scalar
+ * merge, or the benchmark exits with an error.
+ *
+ * Both lists of a pair are drawn independently from the same range [0, Max),
+ * either clustered (ClusteredDataGenerator of synthetic.h) or Zipfian: gaps
+ * drawn from a ZipfianGenerator, mostly small with a heavy tail, scaled to the
+ * range, as bursty posting lists are. Speeds are in millions of input
+ * integers (both lists) per second.
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include "intersection.h"
+#include "synthetic.h"
+#include "ztimer.h"
+
+using namespace std;
+using namespace FastPForLib;
+
+typedef vector<uint32_t, cacheallocator> uint32vector;
+
+// about N distinct sorted integers in [0, Max), with Zipfian gaps
+uint32vector generateZipfianList(uint32_t N, uint32_t Max, uint32_t seed) {
+  // the smallest number of gap values whose mean gap reaches Max / N
+  uint32_t items = 2;
+  for (double harmonic = 1.5; items / harmonic < double(Max) / N; items *= 2)
+    harmonic += log(2.0);
+  ZipfianGenerator zipf(seed);
+  zipf.init(items, 1.0);
+  vector<uint64_t> sums(N);
+  uint64_t sum = 0;
+  for (uint32_t k = 0; k < N; ++k)
+    sums[k] = sum += zipf.nextInt() + 1;
+  uint32vector ans(N);
+  for (uint32_t k = 0; k < N; ++k)
+    ans[k] = static_cast<uint32_t>((sums[k] - 1) * (Max - 1) / (sum - 1));
+  ans.erase(unique(ans.begin(), ans.end()), ans.end());
+  return ans;
+}
+
+typedef size_t (*intersectfnc)(const uint32_t *, size_t, const uint32_t *,
+                               size_t, uint32_t *);
+
+size_t galloping(const uint32_t *A, size_t lenA, const uint32_t *B,
+                 size_t lenB, uint32_t *out) {
+  return lenA <= lenB ? gallopingintersect(A, lenA, B, lenB, out)
+                      : gallopingintersect(B, lenB, A, lenA, out);
+}
+
+vector<pair<intersectfnc, string>> intersectors() {
+  vector<pair<intersectfnc, string>> ans;
+  ans.push_back(make_pair(scalarintersect, string("scalar")));
+  ans.push_back(make_pair(galloping, string("galloping")));
+  ans.push_back(make_pair(sseintersect, string("sse")));
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2"))
+    ans.push_back(make_pair(avx2intersect, string("avx2")));
+#ifdef __AVX512F__
+  if (__builtin_cpu_supports("avx512f"))
+    ans.push_back(make_pair(avx512intersect, string("avx512")));
+#endif
+  ans.push_back(make_pair(intersect, string("intersect")));
+  return ans;
+}
+
+// returns false if an algorithm does not find the intersection
+bool benchmark(const uint32vector &small, const uint32vector &large,
+               uint32_t T) {
+  const vector<pair<intersectfnc, string>> algorithms = intersectors();
+  const CompressedSortedList compressed(large.data(), large.size());
+  const double ints = double(small.size() + large.size()) * T;
+  uint32vector expected(small.size() + 16), out(small.size() + 16);
+  uint32vector decoded(compressed.blocks() * CompressedSortedList::BlockSize);
+  const size_t matches = scalarintersect(small.data(), small.size(),
+                                         large.data(), large.size(),
+                                         expected.data());
+  WallClockTimer z;
+
+  cout << fixed << setprecision(2) << "\t" << small.size() << "\t"
+       << large.size() << "\t" << matches << "\t"
+       << 32.0 * compressed.sizeInWords() / large.size();
+  for (const pair<intersectfnc, string> &algorithm : algorithms) {
+    uint64_t time = 0;
+    // the first pass warms up and checks the result
+    for (uint32_t t = 0; t <= T; ++t) {
+      z.reset();
+      const size_t count = algorithm.first(small.data(), small.size(),
+                                           large.data(), large.size(),
+                                           out.data());
+      if (t > 0)
+        time += z.split();
+      if (t == 0 && (count != matches ||
+                     !equal(out.begin(), out.begin() + count,
+                            expected.begin())))
+        return false;
+    }
+    cout << "\t" << ints / max<uint64_t>(time, 1);
+  }
+
+  uint64_t decodetime = 0, skiptime = 0;
+  for (uint32_t t = 0; t <= T; ++t) {
+    z.reset();
+    compressed.decode(decoded.data());
+    size_t count = intersect(small.data(), small.size(), decoded.data(),
+                             large.size(), out.data());
+    if (t > 0)
+      decodetime += z.split();
+    if (t == 0 && (count != matches ||
+                   !equal(out.begin(), out.begin() + count, expected.begin())))
+      return false;
+
+    z.reset();
+    count = compressed.intersect(small.data(), small.size(), out.data());
+    if (t > 0)
+      skiptime += z.split();
+    if (t == 0 && (count != matches ||
+                   !equal(out.begin(), out.begin() + count, expected.begin())))
+      return false;
+  }
+  cout << "\t" << ints / max<uint64_t>(decodetime, 1) << "\t"
+       << ints / max<uint64_t>(skiptime, 1) << "\t"
+       << 100.0 * compressed.decodedblocks() / compressed.blocks() << endl;
+  return true;
+}
+
+bool intersectionbenchmark(uint32_t N = 1U << 20, uint32_t gap = 1U << 6,
+                           uint32_t T = 1U << 4) {
+  const uint32_t Max = N * gap;
+  const uint32_t ratios[] = {1, 4, 16, 64, 256, 1024};
+  bool ok = true;
+
+  cout << "# long lists of " << N << " integers in [0, " << Max << "), " << T
+       << " repetitions, simdintersect: " << simdintersectname() << endl;
+  cout << "# distribution\tratio\tshort\tlong\tmatches\tbits/int";
+  for (const pair<intersectfnc, string> &algorithm : intersectors())
+    cout << "\t" << algorithm.second << " mis/s";
+  cout << "\tdecode+intersect mis/s\tskip mis/s\tblocks decoded %" << endl;
+  for (uint32_t d = 0; d < 2; ++d) {
+    const char *name = d == 0 ? "clustered" : "zipfian";
+    const uint32vector large =
+        d == 0 ? ClusteredDataGenerator(1).generateClustered(N, Max)
+               : generateZipfianList(N, Max, 1);
+    for (uint32_t ratio : ratios) {
+      const uint32vector small =
+          d == 0 ? ClusteredDataGenerator(2).generateClustered(N / ratio, Max)
+                 : generateZipfianList(N / ratio, Max, 2);
+      cout << name << "\t" << ratio;
+      if (!benchmark(small, large, T)) {
+        cout << "\tfailed" << endl;
+        ok = false;
+      }
+    }
+    cout << endl;
+  }
+  return ok;
+}
+
+int main() {
+  return intersectionbenchmark() ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,32 @@
+/**
+ * This code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ */
+
+/**
+ * Definitions of the __fastunpackN, __fastpackN and __fastpackwithoutmaskN
+ * functions declared in bitpacking.h: 32 integers of N bits to/from N words,
+ * in the layout of genericbitpacking.h.
+ */
+
+#include "bitpacking.h"
+#include "genericbitpacking.h"
+
+using FastPForLib::genericpack;
+using FastPForLib::genericunpack;
+
+#define FASTPFOR_FASTPACKING(bit)                                              \
+  void __fastunpack##bit(const uint32_t *__restrict__ in,                      \
+                         uint32_t *__restrict__ out) {                         \
+    genericunpack<bit, 32>(in, out);                                           \
+  }                                                                            \
+  void __fastpack##bit(const uint32_t *__restrict__ in,                        \
+                       uint32_t *__restrict__ out) {                           \
+    genericpack<bit, 32, true>(in, out);                                       \
+  }                                                                            \
+  void __fastpackwithoutmask##bit(const uint32_t *__restrict__ in,             \
+                                  uint32_t *__restrict__ out) {                \
+    genericpack<bit, 32, false>(in, out);                                      \
+  }
+
+FASTPFOR_FOR_EACH_BIT(FASTPFOR_FASTPACKING)
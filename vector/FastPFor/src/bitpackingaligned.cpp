@@ -0,0 +1,96 @@
+/**
+ * This code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ */
+
+/**
+ * Definitions of the functions declared in bitpackingaligned.h: groups of 8,
+ * 16, 24 or 32 integers of "bit" bits, each group padded to whole 32-bit words
+ * ((length * bit + 31) / 32 of them). Both functions return the word that
+ * follows the group.
+ */
+
+#include "bitpackingaligned.h"
+#include "genericbitpacking.h"
+
+namespace FastPForLib {
+
+namespace {
+
+typedef void (*packingfnc)(const uint32_t *__restrict__, uint32_t *__restrict__);
+
+template <uint32_t length> struct AlignedPacking {
+  static const packingfnc unpackers[33];
+  static const packingfnc packers[33];
+
+  static const uint32_t *unpack(const uint32_t *__restrict__ in,
+                                uint32_t *__restrict__ out,
+                                const uint32_t bit) {
+    unpackers[bit](in, out);
+    return in + (length * bit + 31) / 32;
+  }
+
+  static uint32_t *pack(const uint32_t *__restrict__ in,
+                        uint32_t *__restrict__ out, const uint32_t bit) {
+    packers[bit](in, out);
+    return out + (length * bit + 31) / 32;
+  }
+};
+
+#define FASTPFOR_ALIGNED_UNPACKER(bit) &genericunpack<bit, length>,
+#define FASTPFOR_ALIGNED_PACKER(bit) &genericpack<bit, length, false>,
+
+template <uint32_t length>
+const packingfnc AlignedPacking<length>::unpackers[33] = {
+    FASTPFOR_FOR_EACH_BIT(FASTPFOR_ALIGNED_UNPACKER)};
+
+template <uint32_t length>
+const packingfnc AlignedPacking<length>::packers[33] = {
+    FASTPFOR_FOR_EACH_BIT(FASTPFOR_ALIGNED_PACKER)};
+
+} // namespace
+
+const uint32_t *fastunpack_8(const uint32_t *__restrict__ in,
+                             uint32_t *__restrict__ out, const uint32_t bit) {
+  return AlignedPacking<8>::unpack(in, out, bit);
+}
+
+uint32_t *fastpackwithoutmask_8(const uint32_t *__restrict__ in,
+                                uint32_t *__restrict__ out, const uint32_t bit) {
+  return AlignedPacking<8>::pack(in, out, bit);
+}
+
+const uint32_t *fastunpack_16(const uint32_t *__restrict__ in,
+                              uint32_t *__restrict__ out, const uint32_t bit) {
+  return AlignedPacking<16>::unpack(in, out, bit);
+}
+
+uint32_t *fastpackwithoutmask_16(const uint32_t *__restrict__ in,
+                                 uint32_t *__restrict__ out,
+                                 const uint32_t bit) {
+  return AlignedPacking<16>::pack(in, out, bit);
+}
+
+const uint32_t *fastunpack_24(const uint32_t *__restrict__ in,
+                              uint32_t *__restrict__ out, const uint32_t bit) {
+  return AlignedPacking<24>::unpack(in, out, bit);
+}
+
+uint32_t *fastpackwithoutmask_24(const uint32_t *__restrict__ in,
+                                 uint32_t *__restrict__ out,
+                                 const uint32_t bit) {
+  return AlignedPacking<24>::pack(in, out, bit);
+}
+
+const uint32_t *fastunpack_32(const uint32_t *__restrict__ in,
+                              uint32_t *__restrict__ out, const uint32_t bit) {
+  return AlignedPacking<32>::unpack(in, out, bit);
+}
+
+uint32_t *fastpackwithoutmask_32(const uint32_t *__restrict__ in,
+                                 uint32_t *__restrict__ out,
+                                 const uint32_t bit) {
+  return AlignedPacking<32>::pack(in, out, bit);
+}
+
+} // namespace FastPForLib
@@ -17,6 +17,7 @@
  */
 
 #include "horizontalbitpacking.h"
+#include "genericbitpacking.h"
 
 namespace FastPForLib {
 
@@ -925,7 +926,7 @@ static void simdhunpack32(const uint8_t * __restrict__ in, uint32_t * __restrict
   }
 }
 
-void simdhunpack(const uint8_t * __restrict__ in, uint32_t * __restrict__ out, uint32_t bit) {
+void ssehunpack(const uint8_t * __restrict__ in, uint32_t * __restrict__ out, uint32_t bit) {
   switch (bit) {
   case 0:
     SIMD_nullunpacker32(in, out);
@@ -1065,4 +1066,634 @@ void simdhunpack(const uint8_t * __restrict__ in, uint32_t * __restrict__ out, u
   throw logic_error("number of bits is unsupported");
 }
 
+
+/**
+ * Wider horizontal unpackers, selected at run time by simdhunpack.
+ *
+ * Integer i of a group of eight starts at byte i * bit / 8 and bit
+ * i * bit % 8 of it, like in the packers above. The AVX2 version reads a group
+ * per iteration, the bytes of integers 0-3 in the low 128-bit lane and those
+ * of integers 4-7 in the high one (the two loads of the SSE version), gathers
+ * the bytes of each integer in its 32-bit lane with PSHUFB and aligns it with
+ * VPSRLVD; above 25 bits the fifth byte comes from a second shuffle and
+ * VPSLLVD. The AVX-512 version reads two groups (2 * bit bytes) per iteration
+ * with a masked load: VPERMB moves the bytes of two consecutive integers into
+ * each 64-bit lane and VPMULTISHIFTQB extracts both at once; above 28 bits a
+ * lane holds one integer and VPMOVQD narrows the lanes.
+ *
+ * The kernels also exist fused with the decoding of D1, D2 and D4 deltas
+ * (delta = 1, 2, 4; 0 for none): each vector is prefix-summed in registers,
+ * as in prefixsum of genericbitpacking.h but across the 8 or 16 lanes, before
+ * it is stored. They take and return the four integers decoded before and at
+ * the end of the block.
+ */
+
+namespace {
+
+struct HUnpackTables {
+  // AVX2: low and fifth-byte shuffles, right and left shifts
+  uint8_t key256[33][2][32] __attribute__((aligned(32)));
+  uint32_t shift256[33][2][8] __attribute__((aligned(32)));
+  // AVX-512: permutations and multishift controls of the two integers per
+  // lane, or above 28 bits of integers 0-7 and 8-15
+  uint8_t index512[33][2][64] __attribute__((aligned(64)));
+  uint8_t control512[33][64] __attribute__((aligned(64)));
+
+  HUnpackTables() {
+    memset(this, 0, sizeof(*this));
+    for (uint32_t bit = 1; bit < 32; ++bit) {
+      for (uint32_t i = 0; i < 8; ++i) {
+        const uint32_t first = i * bit / 8, last = (i * bit + bit - 1) / 8;
+        const uint32_t base = i < 4 ? 0 : bit / 2;
+        const uint32_t shift = i * bit % 8;
+        for (uint32_t k = 0; k < 4; ++k)
+          key256[bit][0][4 * i + k] =
+              first + k <= last ? static_cast<uint8_t>(first + k - base) : 0x80;
+        for (uint32_t k = 0; k < 4; ++k)
+          key256[bit][1][4 * i + k] =
+              k == 0 && first + 4 <= last
+                  ? static_cast<uint8_t>(first + 4 - base)
+                  : 0x80;
+        shift256[bit][0][i] = shift;
+        shift256[bit][1][i] = 32 - shift;
+      }
+      for (uint32_t lane = 0; lane < 8; ++lane) {
+        for (uint32_t h = 0; h < 2; ++h) {
+          const uint32_t i = bit <= 28 ? 2 * lane : lane + 8 * h;
+          for (uint32_t k = 0; k < 8; ++k)
+            index512[bit][h][8 * lane + k] =
+                static_cast<uint8_t>(std::min<uint32_t>(i * bit / 8 + k, 63));
+        }
+        const uint32_t shift = 2 * lane * bit % 8;
+        for (uint32_t k = 0; k < 4; ++k) {
+          control512[bit][8 * lane + k] = static_cast<uint8_t>(shift + 8 * k);
+          control512[bit][8 * lane + 4 + k] =
+              static_cast<uint8_t>(shift + bit + 8 * k);
+        }
+        if (bit > 28)
+          for (uint32_t k = 0; k < 4; ++k)
+            control512[bit][8 * lane + k] =
+                static_cast<uint8_t>(lane * bit % 8 + 8 * k);
+      }
+    }
+  }
+};
+
+const HUnpackTables hunpacktables;
+
+// prefixsum<delta> over eight lanes: the sums of the low 128-bit lane are
+// carried into the high one, and those of prev into both
+template <uint32_t delta>
+__attribute__((target("avx2"))) static inline __m256i
+avx2prefixsum(__m256i value, __m256i prev) {
+  if (delta == 0)
+    return value;
+  if (delta < 2)
+    value = _mm256_add_epi32(value, _mm256_slli_si256(value, 4));
+  if (delta < 4)
+    value = _mm256_add_epi32(value, _mm256_slli_si256(value, 8));
+  __m256i low = value;
+  prev = _mm256_permute2x128_si256(prev, prev, 0x11);
+  if (delta == 1) {
+    low = _mm256_shuffle_epi32(low, _MM_SHUFFLE(3, 3, 3, 3));
+    prev = _mm256_shuffle_epi32(prev, _MM_SHUFFLE(3, 3, 3, 3));
+  } else if (delta == 2) {
+    low = _mm256_shuffle_epi32(low, _MM_SHUFFLE(3, 2, 3, 2));
+    prev = _mm256_shuffle_epi32(prev, _MM_SHUFFLE(3, 2, 3, 2));
+  }
+  value = _mm256_add_epi32(value, _mm256_permute2x128_si256(low, low, 0x08));
+  return _mm256_add_epi32(value, prev);
+}
+
+template <uint32_t delta, uint32_t b>
+__attribute__((target("avx2"))) static __m128i
+avx2hunpackN(const uint8_t *__restrict__ in, uint32_t *__restrict__ out,
+             __m128i offset) {
+  const __m256i lokey = _mm256_load_si256(
+      reinterpret_cast<const __m256i *>(hunpacktables.key256[b][0]));
+  const __m256i hikey = _mm256_load_si256(
+      reinterpret_cast<const __m256i *>(hunpacktables.key256[b][1]));
+  const __m256i rshift = _mm256_load_si256(
+      reinterpret_cast<const __m256i *>(hunpacktables.shift256[b][0]));
+  const __m256i lshift = _mm256_load_si256(
+      reinterpret_cast<const __m256i *>(hunpacktables.shift256[b][1]));
+  const __m256i mask = _mm256_set1_epi32((1U << b) - 1);
+  __m256i *pCurr = reinterpret_cast<__m256i *>(out);
+  __m256i prev = _mm256_broadcastsi128_si256(offset);
+  for (uint32_t j = 0; j < 16; ++j) {
+    const __m256i data = _mm256_inserti128_si256(
+        _mm256_castsi128_si256(
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + b * j))),
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(in + b * j + b / 2)),
+        1);
+    __m256i ca = _mm256_srlv_epi32(_mm256_shuffle_epi8(data, lokey), rshift);
+    if (b > 25)
+      ca = _mm256_or_si256(
+          ca, _mm256_sllv_epi32(_mm256_shuffle_epi8(data, hikey), lshift));
+    prev = avx2prefixsum<delta>(_mm256_and_si256(ca, mask), prev);
+    _mm256_storeu_si256(pCurr++, prev);
+  }
+  return _mm256_extracti128_si256(prev, 1);
+}
+
+template <uint32_t delta>
+__attribute__((target("avx2"))) static __m128i
+avx2hunpack0(const uint8_t *, uint32_t *__restrict__ out, __m128i offset) {
+  __m256i *pCurr = reinterpret_cast<__m256i *>(out);
+  __m256i prev = _mm256_broadcastsi128_si256(offset);
+  for (uint32_t j = 0; j < 16; ++j) {
+    prev = avx2prefixsum<delta>(_mm256_setzero_si256(), prev);
+    _mm256_storeu_si256(pCurr++, prev);
+  }
+  return _mm256_extracti128_si256(prev, 1);
+}
+
+template <uint32_t delta>
+__attribute__((target("avx2"))) static __m128i
+avx2hunpack32(const uint8_t *__restrict__ in, uint32_t *__restrict__ out,
+              __m128i offset) {
+  __m256i prev = _mm256_broadcastsi128_si256(offset);
+  for (uint32_t j = 0; j < 16; ++j) {
+    prev = avx2prefixsum<delta>(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(in) + j), prev);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(out) + j, prev);
+  }
+  return _mm256_extracti128_si256(prev, 1);
+}
+
+#ifdef __AVX512F__
+#define AVX512_HUNPACK_TARGET                                                  \
+  __attribute__((target("avx512f,avx512bw,avx512vbmi")))
+
+// prefixsum<delta> over sixteen lanes, with VALIGND shifting in zeros
+template <uint32_t delta>
+AVX512_HUNPACK_TARGET static inline __m512i avx512prefixsum(__m512i value,
+                                                            __m512i prev) {
+  if (delta == 0)
+    return value;
+  const __m512i zero = _mm512_setzero_si512();
+  if (delta < 2)
+    value = _mm512_add_epi32(value, _mm512_alignr_epi32(value, zero, 15));
+  if (delta < 4)
+    value = _mm512_add_epi32(value, _mm512_alignr_epi32(value, zero, 14));
+  value = _mm512_add_epi32(value, _mm512_alignr_epi32(value, zero, 12));
+  value = _mm512_add_epi32(value, _mm512_alignr_epi32(value, zero, 8));
+  prev = _mm512_shuffle_i32x4(prev, prev, _MM_SHUFFLE(3, 3, 3, 3));
+  if (delta == 1)
+    prev = _mm512_shuffle_epi32(prev, _MM_PERM_DDDD);
+  else if (delta == 2)
+    prev = _mm512_shuffle_epi32(prev, _MM_PERM_DCDC);
+  return _mm512_add_epi32(value, prev);
+}
+
+template <uint32_t delta, uint32_t b>
+AVX512_HUNPACK_TARGET static __m128i
+avx512hunpackN(const uint8_t *__restrict__ in, uint32_t *__restrict__ out,
+               __m128i offset) {
+  const __m512i index0 = _mm512_load_si512(hunpacktables.index512[b][0]);
+  const __m512i index1 = _mm512_load_si512(hunpacktables.index512[b][1]);
+  const __m512i control = _mm512_load_si512(hunpacktables.control512[b]);
+  const __m512i mask = _mm512_set1_epi32((1U << b) - 1);
+  const __mmask64 loadmask = ~uint64_t(0) >> (64 - 2 * b);
+  __m512i prev = _mm512_broadcast_i32x4(offset);
+  for (uint32_t j = 0; j < 8; ++j) {
+    const __m512i data = _mm512_maskz_loadu_epi8(loadmask, in + 2 * b * j);
+    __m512i ca;
+    if (b <= 28) {
+      ca = _mm512_multishift_epi64_epi8(
+          control, _mm512_permutexvar_epi8(index0, data));
+    } else {
+      const __m256i lo = _mm512_cvtepi64_epi32(_mm512_multishift_epi64_epi8(
+          control, _mm512_permutexvar_epi8(index0, data)));
+      const __m256i hi = _mm512_cvtepi64_epi32(_mm512_multishift_epi64_epi8(
+          control, _mm512_permutexvar_epi8(index1, data)));
+      ca = _mm512_inserti64x4(_mm512_castsi256_si512(lo), hi, 1);
+    }
+    prev = avx512prefixsum<delta>(_mm512_and_si512(ca, mask), prev);
+    _mm512_storeu_si512(out + 16 * j, prev);
+  }
+  return _mm512_extracti32x4_epi32(prev, 3);
+}
+
+template <uint32_t delta>
+AVX512_HUNPACK_TARGET static __m128i
+avx512hunpack0(const uint8_t *, uint32_t *__restrict__ out, __m128i offset) {
+  __m512i prev = _mm512_broadcast_i32x4(offset);
+  for (uint32_t j = 0; j < 8; ++j) {
+    prev = avx512prefixsum<delta>(_mm512_setzero_si512(), prev);
+    _mm512_storeu_si512(out + 16 * j, prev);
+  }
+  return _mm512_extracti32x4_epi32(prev, 3);
+}
+
+template <uint32_t delta>
+AVX512_HUNPACK_TARGET static __m128i
+avx512hunpack32(const uint8_t *__restrict__ in, uint32_t *__restrict__ out,
+                __m128i offset) {
+  __m512i prev = _mm512_broadcast_i32x4(offset);
+  for (uint32_t j = 0; j < 8; ++j) {
+    prev = avx512prefixsum<delta>(_mm512_loadu_si512(in + 64 * j), prev);
+    _mm512_storeu_si512(out + 16 * j, prev);
+  }
+  return _mm512_extracti32x4_epi32(prev, 3);
+}
+#endif
+
+typedef __m128i (*hunpackfnc)(const uint8_t *__restrict__,
+                              uint32_t *__restrict__, __m128i);
+
+#define HUNPACK_KERNELS(isa, delta)                                            \
+  {                                                                            \
+    &isa##hunpack0<delta>, &isa##hunpackN<delta, 1>, &isa##hunpackN<delta, 2>, \
+        &isa##hunpackN<delta, 3>, &isa##hunpackN<delta, 4>,                    \
+        &isa##hunpackN<delta, 5>, &isa##hunpackN<delta, 6>,                    \
+        &isa##hunpackN<delta, 7>, &isa##hunpackN<delta, 8>,                    \
+        &isa##hunpackN<delta, 9>, &isa##hunpackN<delta, 10>,                   \
+        &isa##hunpackN<delta, 11>, &isa##hunpackN<delta, 12>,                  \
+        &isa##hunpackN<delta, 13>, &isa##hunpackN<delta, 14>,                  \
+        &isa##hunpackN<delta, 15>, &isa##hunpackN<delta, 16>,                  \
+        &isa##hunpackN<delta, 17>, &isa##hunpackN<delta, 18>,                  \
+        &isa##hunpackN<delta, 19>, &isa##hunpackN<delta, 20>,                  \
+        &isa##hunpackN<delta, 21>, &isa##hunpackN<delta, 22>,                  \
+        &isa##hunpackN<delta, 23>, &isa##hunpackN<delta, 24>,                  \
+        &isa##hunpackN<delta, 25>, &isa##hunpackN<delta, 26>,                  \
+        &isa##hunpackN<delta, 27>, &isa##hunpackN<delta, 28>,                  \
+        &isa##hunpackN<delta, 29>, &isa##hunpackN<delta, 30>,                  \
+        &isa##hunpackN<delta, 31>, &isa##hunpack32<delta>                      \
+  }
+
+// indexed by no delta, D1, D2, D4
+const hunpackfnc avx2hunpackers[4][33] = {
+    HUNPACK_KERNELS(avx2, 0), HUNPACK_KERNELS(avx2, 1),
+    HUNPACK_KERNELS(avx2, 2), HUNPACK_KERNELS(avx2, 4)};
+#ifdef __AVX512F__
+const hunpackfnc avx512hunpackers[4][33] = {
+    HUNPACK_KERNELS(avx512, 0), HUNPACK_KERNELS(avx512, 1),
+    HUNPACK_KERNELS(avx512, 2), HUNPACK_KERNELS(avx512, 4)};
+#endif
+
+typedef void (*simdhunpackfnc)(const uint8_t *__restrict__,
+                               uint32_t *__restrict__, uint32_t);
+
+// the widest unpacker that the build allows and the processor supports
+simdhunpackfnc selecthunpack() {
+  __builtin_cpu_init();
+#ifdef __AVX512F__
+  if (__builtin_cpu_supports("avx512bw") &&
+      __builtin_cpu_supports("avx512vbmi"))
+    return &avx512hunpack;
+#endif
+  if (__builtin_cpu_supports("avx2"))
+    return &avx2hunpack;
+  return &ssehunpack;
+}
+
+const simdhunpackfnc selectedhunpack = selecthunpack();
+
+// the fused kernels of the selected unpacker; without AVX2 the block is
+// unpacked by ssehunpack and prefix-summed while it is in L1
+template <uint32_t delta>
+__m128i hunpackdelta(__m128i offset, const uint8_t *__restrict__ in,
+                     uint32_t *__restrict__ out, uint32_t bit) {
+  if (bit > 32)
+    throw logic_error("number of bits is unsupported");
+  const uint32_t kernels = delta == 4 ? 3 : delta;
+#ifdef __AVX512F__
+  if (selectedhunpack == &avx512hunpack)
+    return avx512hunpackers[kernels][bit](in, out, offset);
+#endif
+  if (selectedhunpack == &avx2hunpack)
+    return avx2hunpackers[kernels][bit](in, out, offset);
+  ssehunpack(in, out, bit);
+  __m128i *pCurr = reinterpret_cast<__m128i *>(out);
+  for (uint32_t k = 0; k < 32; ++k, ++pCurr) {
+    offset = prefixsum<delta>(_mm_load_si128(pCurr), offset);
+    _mm_store_si128(pCurr, offset);
+  }
+  return offset;
+}
+
+} // namespace
+
+void avx2hunpack(const uint8_t *__restrict__ in, uint32_t *__restrict__ out,
+                 uint32_t bit) {
+  if (bit > 32)
+    throw logic_error("number of bits is unsupported");
+  avx2hunpackers[0][bit](in, out, _mm_setzero_si128());
+}
+
+#ifdef __AVX512F__
+void avx512hunpack(const uint8_t *__restrict__ in, uint32_t *__restrict__ out,
+                   uint32_t bit) {
+  if (bit > 32)
+    throw logic_error("number of bits is unsupported");
+  avx512hunpackers[0][bit](in, out, _mm_setzero_si128());
+}
+#endif
+
+void simdhunpack(const uint8_t *__restrict__ in, uint32_t *__restrict__ out,
+                 uint32_t bit) {
+  selectedhunpack(in, out, bit);
+}
+
+__m128i simdhunpackd1(__m128i offset, const uint8_t *__restrict__ in,
+                      uint32_t *__restrict__ out, uint32_t bit) {
+  return hunpackdelta<1>(offset, in, out, bit);
+}
+
+__m128i simdhunpackd2(__m128i offset, const uint8_t *__restrict__ in,
+                      uint32_t *__restrict__ out, uint32_t bit) {
+  return hunpackdelta<2>(offset, in, out, bit);
+}
+
+__m128i simdhunpackd4(__m128i offset, const uint8_t *__restrict__ in,
+                      uint32_t *__restrict__ out, uint32_t bit) {
+  return hunpackdelta<4>(offset, in, out, bit);
+}
+
+const char *simdhunpackname() {
+#ifdef __AVX512F__
+  if (selectedhunpack == &avx512hunpack)
+    return "avx512";
+#endif
+  return selectedhunpack == &avx2hunpack ? "avx2" : "sse";
+}
+
+/**
+ * Horizontal packers: the inverse of simdhunpack. They write 128 integers of
+ * "bit" bits as one bit stream of 16 * bit bytes, integer k at bits
+ * [k * bit, (k + 1) * bit), which is also the layout of the scalar pack<true>
+ * of rolledbitpacking.h applied to consecutive groups of 32 integers. Input
+ * integers are masked to "bit" bits.
+ *
+ * Eight integers always fill "bit" whole bytes. Within such a group, integer i
+ * starts at byte i * bit / 8 and bit i * bit % 8 of it: PMULUDQ shifts the
+ * integers by those bit offsets into 64-bit lanes (the even and the odd ones
+ * apart, so that no two integers of a lane set meet in a byte when bit >= 7),
+ * and byte shuffles move each lane to its bytes, the boundary bytes being
+ * OR-ed. The SSE and AVX2 versions use PSHUFB, the AVX-512 version VPERMB on
+ * two groups at once with masked stores. Below 7 bits each half of a group is
+ * shifted with PMULLD into one 32-bit word instead.
+ */
+
+namespace {
+
+// the integers of a shuffle source: integer index and its first byte there
+struct HPackSlot {
+  uint32_t integer, offset;
+};
+
+struct HPackTables {
+  // SSE: sources are the integers (0, 2), (1, 3), (4, 6) and (5, 7) of a group
+  // and the outputs its bytes [0, 16) and [16, 32)
+  __m128i multi[33][4];
+  __m128i key[33][4][2];
+  __m128i foldmulti[7];
+#ifdef __AVX2__
+  // AVX2: sources are the even and the odd integers, then the same with their
+  // 128-bit lanes swapped
+  __m256i multi256[33][2];
+  __m256i key256[33][4];
+#endif
+#ifdef __AVX512VBMI__
+  // AVX-512: the even and the odd integers of two groups
+  __m512i multi512[33][2];
+  __m512i key512[33][2];
+  __mmask64 mask512[33][2];
+#endif
+
+  // index in "source" of output byte "base + q" for q < width, 0x80 if none
+  // of the slots covers it; returns the mask of the bytes covered
+  static uint64_t fillkey(uint8_t *key, uint32_t width, uint32_t base,
+                          uint32_t bit, const HPackSlot *slots,
+                          uint32_t slotcount) {
+    uint64_t covered = 0;
+    for (uint32_t q = 0; q < width; ++q) {
+      key[q] = 0x80;
+      for (uint32_t s = 0; s < slotcount; ++s) {
+        const uint32_t first = slots[s].integer * bit / 8;
+        const uint32_t last = (slots[s].integer * bit + bit - 1) / 8;
+        if (base + q >= first && base + q <= last) {
+          key[q] = static_cast<uint8_t>(slots[s].offset + base + q - first);
+          covered |= uint64_t(1) << q;
+        }
+      }
+    }
+    return covered;
+  }
+
+  // 2^(shift of integer first + 2 k) in the low word of 64-bit lane k
+  static void fillmulti(uint32_t *multi, uint32_t lanes, uint32_t bit,
+                        uint32_t first) {
+    for (uint32_t k = 0; k < lanes; ++k) {
+      multi[2 * k] = 1U << ((first + 2 * k) * bit % 8);
+      multi[2 * k + 1] = 0;
+    }
+  }
+
+  HPackTables() {
+    for (uint32_t bit = 1; bit < 32; ++bit) {
+      for (uint32_t s = 0; s < 4; ++s) {
+        const uint32_t first = (s / 2) * 4 + s % 2;
+        const HPackSlot slots[2] = {{first, 0}, {first + 2, 8}};
+        fillmulti(reinterpret_cast<uint32_t *>(&multi[bit][s]), 2, bit, first);
+        for (uint32_t o = 0; o < 2; ++o)
+          fillkey(reinterpret_cast<uint8_t *>(&key[bit][s][o]), 16, 16 * o,
+                  bit, slots, 2);
+      }
+#ifdef __AVX2__
+      for (uint32_t s = 0; s < 2; ++s) {
+        const HPackSlot low[2] = {{s, 0}, {s + 2, 8}};
+        const HPackSlot high[2] = {{s + 4, 0}, {s + 6, 8}};
+        uint8_t *k = reinterpret_cast<uint8_t *>(&key256[bit][s]);
+        uint8_t *kswapped = reinterpret_cast<uint8_t *>(&key256[bit][s + 2]);
+        fillmulti(reinterpret_cast<uint32_t *>(&multi256[bit][s]), 4, bit, s);
+        fillkey(k, 16, 0, bit, low, 2);
+        fillkey(k + 16, 16, 16, bit, high, 2);
+        fillkey(kswapped, 16, 0, bit, high, 2);
+        memset(kswapped + 16, 0x80, 16);
+      }
+#endif
+#ifdef __AVX512VBMI__
+      for (uint32_t s = 0; s < 2; ++s) {
+        HPackSlot slots[8];
+        for (uint32_t k = 0; k < 8; ++k)
+          slots[k] = HPackSlot{s + 2 * k, 8 * k};
+        fillmulti(reinterpret_cast<uint32_t *>(&multi512[bit][s]), 8, bit, s);
+        mask512[bit][s] = fillkey(reinterpret_cast<uint8_t *>(&key512[bit][s]),
+                                  64, 0, bit, slots, 8);
+      }
+#endif
+    }
+    for (uint32_t bit = 1; bit <= 6; ++bit)
+      foldmulti[bit] = _mm_setr_epi32(1, 1 << bit, 1 << (2 * bit), 1 << (3 * bit));
+  }
+};
+
+const HPackTables hpacktables;
+
+template <uint32_t b> inline __m128i hpackmask() {
+  return _mm_set1_epi32((1U << b) - 1);
+}
+
+// the last group of a block is written through a buffer so that the wide
+// stores of the others never pass the end of the block
+template <uint32_t b, class Group>
+inline void hpackgroups(const uint32_t *__restrict__ in,
+                        uint8_t *__restrict__ out, Group group) {
+  for (uint32_t j = 0; j < 15; ++j)
+    group(in + 8 * j, out + b * j);
+  uint8_t last[32] __attribute__((aligned(16)));
+  group(in + 8 * 15, last);
+  memcpy(out + b * 15, last, b);
+}
+
+// bit < 7: each half of a group shifted into one word
+template <uint32_t b>
+static void simdhpackfold(const uint32_t *__restrict__ in,
+                          uint8_t *__restrict__ out) {
+  hpackgroups<b>(in, out, [](const uint32_t *i, uint8_t *o) {
+    const __m128i mask = hpackmask<b>();
+    const __m128i lo = _mm_mullo_epi32(
+        _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(i)),
+                      mask),
+        hpacktables.foldmulti[b]);
+    const __m128i hi = _mm_mullo_epi32(
+        _mm_and_si128(
+            _mm_loadu_si128(reinterpret_cast<const __m128i *>(i + 4)), mask),
+        hpacktables.foldmulti[b]);
+    __m128i w = _mm_or_si128(_mm_unpacklo_epi64(lo, hi),
+                             _mm_unpackhi_epi64(lo, hi));
+    w = _mm_or_si128(w, _mm_srli_epi64(w, 32));
+    const uint64_t word =
+        static_cast<uint32_t>(_mm_cvtsi128_si32(w)) |
+        static_cast<uint64_t>(static_cast<uint32_t>(_mm_extract_epi32(w, 2)))
+            << (4 * b);
+    memcpy(o, &word, 8);
+  });
+}
+
+template <uint32_t b>
+static void simdhpackN(const uint32_t *__restrict__ in,
+                       uint8_t *__restrict__ out) {
+  hpackgroups<b>(in, out, [](const uint32_t *i, uint8_t *o) {
+    const __m128i mask = hpackmask<b>();
+    const __m128i *multi = hpacktables.multi[b];
+    const __m128i(*key)[2] = hpacktables.key[b];
+    __m128i src[4];
+    for (uint32_t h = 0; h < 2; ++h) {
+      const __m128i v = _mm_and_si128(
+          _mm_loadu_si128(reinterpret_cast<const __m128i *>(i + 4 * h)), mask);
+      src[2 * h] = _mm_mul_epu32(v, multi[2 * h]);
+      src[2 * h + 1] = _mm_mul_epu32(_mm_srli_epi64(v, 32), multi[2 * h + 1]);
+    }
+    for (uint32_t k = 0; k < (b > 16 ? 2 : 1); ++k) {
+      __m128i w = _mm_shuffle_epi8(src[0], key[0][k]);
+      for (uint32_t s = 1; s < 4; ++s)
+        w = _mm_or_si128(w, _mm_shuffle_epi8(src[s], key[s][k]));
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(o + 16 * k), w);
+    }
+  });
+}
+
+#ifdef __AVX2__
+template <uint32_t b>
+static void avx2hpackN(const uint32_t *__restrict__ in,
+                       uint8_t *__restrict__ out) {
+  hpackgroups<b>(in, out, [](const uint32_t *i, uint8_t *o) {
+    const __m256i *multi = hpacktables.multi256[b];
+    const __m256i *key = hpacktables.key256[b];
+    const __m256i v = _mm256_and_si256(
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(i)),
+        _mm256_set1_epi32((1U << b) - 1));
+    const __m256i even = _mm256_mul_epu32(v, multi[0]);
+    const __m256i odd = _mm256_mul_epu32(_mm256_srli_epi64(v, 32), multi[1]);
+    __m256i w = _mm256_or_si256(_mm256_shuffle_epi8(even, key[0]),
+                                _mm256_shuffle_epi8(odd, key[1]));
+    w = _mm256_or_si256(
+        w, _mm256_shuffle_epi8(_mm256_permute2x128_si256(even, even, 1), key[2]));
+    w = _mm256_or_si256(
+        w, _mm256_shuffle_epi8(_mm256_permute2x128_si256(odd, odd, 1), key[3]));
+    if (b > 16)
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(o), w);
+    else
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(o),
+                       _mm256_castsi256_si128(w));
+  });
+}
+#endif
+
+#ifdef __AVX512VBMI__
+template <uint32_t b>
+static void avx512hpackN(const uint32_t *__restrict__ in,
+                         uint8_t *__restrict__ out) {
+  const __m512i *multi = hpacktables.multi512[b];
+  const __m512i *key = hpacktables.key512[b];
+  const __mmask64 *mask = hpacktables.mask512[b];
+  const __mmask64 storemask = ~uint64_t(0) >> (64 - 2 * b);
+  for (uint32_t j = 0; j < 8; ++j) {
+    const __m512i v = _mm512_and_si512(_mm512_loadu_si512(in + 16 * j),
+                                       _mm512_set1_epi32((1U << b) - 1));
+    const __m512i even = _mm512_mul_epu32(v, multi[0]);
+    const __m512i odd = _mm512_mul_epu32(_mm512_srli_epi64(v, 32), multi[1]);
+    const __m512i w =
+        _mm512_or_si512(_mm512_maskz_permutexvar_epi8(mask[0], key[0], even),
+                        _mm512_maskz_permutexvar_epi8(mask[1], key[1], odd));
+    _mm512_mask_storeu_epi8(out + 2 * b * j, storemask, w);
+  }
+}
+#endif
+
+static void hpack0(const uint32_t *__restrict__, uint8_t *__restrict__) {}
+
+static void hpack32(const uint32_t *__restrict__ in,
+                    uint8_t *__restrict__ out) {
+  memcpy(out, in, 128 * 4);
+}
+
+typedef void (*hpackfnc)(const uint32_t *__restrict__, uint8_t *__restrict__);
+
+#define HPACK_SSE(b) (b) < 7 ? &simdhpackfold<(b) < 7 ? (b) : 6> : &simdhpackN<b>,
+#define HPACK_KERNELS(X)                                                       \
+  &hpack0, X(1) X(2) X(3) X(4) X(5) X(6) X(7) X(8) X(9) X(10) X(11) X(12)      \
+      X(13) X(14) X(15) X(16) X(17) X(18) X(19) X(20) X(21) X(22) X(23)        \
+          X(24) X(25) X(26) X(27) X(28) X(29) X(30) X(31) &hpack32
+
+const hpackfnc simdhpackers[33] = {HPACK_KERNELS(HPACK_SSE)};
+#ifdef __AVX2__
+#define HPACK_AVX2(b) (b) < 7 ? &simdhpackfold<(b) < 7 ? (b) : 6> : &avx2hpackN<b>,
+const hpackfnc avx2hpackers[33] = {HPACK_KERNELS(HPACK_AVX2)};
+#endif
+#ifdef __AVX512VBMI__
+#define HPACK_AVX512(b) (b) < 7 ? &simdhpackfold<(b) < 7 ? (b) : 6> : &avx512hpackN<b>,
+const hpackfnc avx512hpackers[33] = {HPACK_KERNELS(HPACK_AVX512)};
+#endif
+
+} // namespace
+
+void simdhpack(const uint32_t *__restrict__ in, uint8_t *__restrict__ out,
+               uint32_t bit) {
+  if (bit > 32)
+    throw logic_error("number of bits is unsupported");
+  simdhpackers[bit](in, out);
+}
+
+#ifdef __AVX2__
+void avx2hpack(const uint32_t *__restrict__ in, uint8_t *__restrict__ out,
+               uint32_t bit) {
+  if (bit > 32)
+    throw logic_error("number of bits is unsupported");
+  avx2hpackers[bit](in, out);
+}
+#endif
+
+#ifdef __AVX512VBMI__
+void avx512hpack(const uint32_t *__restrict__ in, uint8_t *__restrict__ out,
+                 uint32_t bit) {
+  if (bit > 32)
+    throw logic_error("number of bits is unsupported");
+  avx512hpackers[bit](in, out);
+}
+#endif
+
 } // namespace FastPFor
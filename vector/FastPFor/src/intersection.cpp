@@ -0,0 +1,330 @@
+/**
+ * This code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ */
+
+/**
+ * Definitions of the functions declared in intersection.h.
+ *
+ * The block merges follow Schlegel, Willhalm and Lehner (Fast sorted-set
+ * intersection using SIMD instructions, ADMS 2011) and Katsov: the integers
+ * of a vector of A are compared with every lane of a vector of B by comparing
+ * A with rotations of B, which gives the mask of the lanes of A found in B.
+ * Since the integers are distinct, a lane of A matches at most one of B. The
+ * matching lanes are moved to the front with PSHUFB (SSE), VPERMD (AVX2) or
+ * VPCOMPRESSD (AVX-512) and stored, and "out" advances by the number of
+ * matches. Then the vector whose last integer is smaller (both if they are
+ * equal) is replaced: its integers cannot match any later one of the other
+ * list. The shorter tails are merged by scalarintersect.
+ */
+
+#include "intersection.h"
+#include "simdbitpacking.h"
+
+namespace FastPForLib {
+
+namespace {
+
+struct IntersectTables {
+  // SSE: PSHUFB moving the lanes set in a 4-bit mask to the front
+  uint8_t shuffle128[16][16] __attribute__((aligned(16)));
+  // AVX2: VPERMD moving the lanes set in an 8-bit mask to the front
+  uint32_t permute256[256][8] __attribute__((aligned(32)));
+
+  IntersectTables() {
+    memset(this, 0, sizeof(*this));
+    for (uint32_t mask = 0; mask < 16; ++mask)
+      for (uint32_t lane = 0, k = 0; lane < 4; ++lane)
+        if (mask & (1U << lane)) {
+          for (uint32_t b = 0; b < 4; ++b)
+            shuffle128[mask][4 * k + b] = static_cast<uint8_t>(4 * lane + b);
+          ++k;
+        }
+    for (uint32_t mask = 0; mask < 256; ++mask)
+      for (uint32_t lane = 0, k = 0; lane < 8; ++lane)
+        if (mask & (1U << lane))
+          permute256[mask][k++] = lane;
+  }
+};
+
+const IntersectTables intersecttables;
+
+} // namespace
+
+size_t scalarintersect(const uint32_t *A, size_t lenA, const uint32_t *B,
+                       size_t lenB, uint32_t *out) {
+  const uint32_t *const initout = out;
+  const uint32_t *const endA = A + lenA, *const endB = B + lenB;
+  while (A < endA && B < endB) {
+    if (*A < *B) {
+      ++A;
+    } else if (*B < *A) {
+      ++B;
+    } else {
+      *out++ = *A++;
+      ++B;
+    }
+  }
+  return out - initout;
+}
+
+size_t gallopingintersect(const uint32_t *small, size_t lenSmall,
+                          const uint32_t *large, size_t lenLarge,
+                          uint32_t *out) {
+  const uint32_t *const initout = out;
+  size_t pos = 0;
+  for (size_t i = 0; i < lenSmall && pos < lenLarge; ++i) {
+    const uint32_t x = small[i];
+    if (large[pos] < x) {
+      // doubles the step until large[lo] < x <= large[lo + step]
+      size_t lo = pos, step = 1;
+      while (lo + step < lenLarge && large[lo + step] < x) {
+        lo += step;
+        step *= 2;
+      }
+      pos = std::lower_bound(large + lo + 1,
+                             large + std::min(lo + step, lenLarge), x) -
+            large;
+      if (pos == lenLarge)
+        break;
+    }
+    if (large[pos] == x)
+      *out++ = x;
+  }
+  return out - initout;
+}
+
+size_t sseintersect(const uint32_t *A, size_t lenA, const uint32_t *B,
+                    size_t lenB, uint32_t *out) {
+  const uint32_t *const initout = out;
+  size_t i = 0, j = 0;
+  while (i + 4 <= lenA && j + 4 <= lenB) {
+    const __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i *>(A + i));
+    const __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i *>(B + j));
+    __m128i cmp = _mm_cmpeq_epi32(va, vb);
+    cmp = _mm_or_si128(cmp, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(
+                                                    vb, _MM_SHUFFLE(0, 3, 2, 1))));
+    cmp = _mm_or_si128(cmp, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(
+                                                    vb, _MM_SHUFFLE(1, 0, 3, 2))));
+    cmp = _mm_or_si128(cmp, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(
+                                                    vb, _MM_SHUFFLE(2, 1, 0, 3))));
+    const uint32_t mask = _mm_movemask_ps(_mm_castsi128_ps(cmp));
+    _mm_storeu_si128(
+        reinterpret_cast<__m128i *>(out),
+        _mm_shuffle_epi8(va, _mm_load_si128(reinterpret_cast<const __m128i *>(
+                                 intersecttables.shuffle128[mask]))));
+    out += _mm_popcnt_u32(mask);
+    const uint32_t amax = A[i + 3], bmax = B[j + 3];
+    i += amax <= bmax ? 4 : 0;
+    j += bmax <= amax ? 4 : 0;
+  }
+  out += scalarintersect(A + i, lenA - i, B + j, lenB - j, out);
+  return out - initout;
+}
+
+__attribute__((target("avx2,popcnt"))) size_t
+avx2intersect(const uint32_t *A, size_t lenA, const uint32_t *B, size_t lenB,
+              uint32_t *out) {
+  const uint32_t *const initout = out;
+  size_t i = 0, j = 0;
+  while (i + 8 <= lenA && j + 8 <= lenB) {
+    const __m256i va =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(A + i));
+    const __m256i vb =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i *>(B + j));
+    // the rotations within each 128-bit lane, of vb and of vb with its
+    // 128-bit lanes swapped
+    const __m256i vbx = _mm256_permute2x128_si256(vb, vb, 0x01);
+    __m256i cmp = _mm256_or_si256(_mm256_cmpeq_epi32(va, vb),
+                                  _mm256_cmpeq_epi32(va, vbx));
+    cmp = _mm256_or_si256(
+        cmp, _mm256_cmpeq_epi32(va, _mm256_shuffle_epi32(
+                                        vb, _MM_SHUFFLE(0, 3, 2, 1))));
+    cmp = _mm256_or_si256(
+        cmp, _mm256_cmpeq_epi32(va, _mm256_shuffle_epi32(
+                                        vb, _MM_SHUFFLE(1, 0, 3, 2))));
+    cmp = _mm256_or_si256(
+        cmp, _mm256_cmpeq_epi32(va, _mm256_shuffle_epi32(
+                                        vb, _MM_SHUFFLE(2, 1, 0, 3))));
+    cmp = _mm256_or_si256(
+        cmp, _mm256_cmpeq_epi32(va, _mm256_shuffle_epi32(
+                                        vbx, _MM_SHUFFLE(0, 3, 2, 1))));
+    cmp = _mm256_or_si256(
+        cmp, _mm256_cmpeq_epi32(va, _mm256_shuffle_epi32(
+                                        vbx, _MM_SHUFFLE(1, 0, 3, 2))));
+    cmp = _mm256_or_si256(
+        cmp, _mm256_cmpeq_epi32(va, _mm256_shuffle_epi32(
+                                        vbx, _MM_SHUFFLE(2, 1, 0, 3))));
+    const uint32_t mask = _mm256_movemask_ps(_mm256_castsi256_ps(cmp));
+    _mm256_storeu_si256(
+        reinterpret_cast<__m256i *>(out),
+        _mm256_permutevar8x32_epi32(
+            va, _mm256_load_si256(reinterpret_cast<const __m256i *>(
+                    intersecttables.permute256[mask]))));
+    out += _mm_popcnt_u32(mask);
+    const uint32_t amax = A[i + 7], bmax = B[j + 7];
+    i += amax <= bmax ? 8 : 0;
+    j += bmax <= amax ? 8 : 0;
+  }
+  out += sseintersect(A + i, lenA - i, B + j, lenB - j, out);
+  return out - initout;
+}
+
+#ifdef __AVX512F__
+__attribute__((target("avx512f,popcnt"))) size_t
+avx512intersect(const uint32_t *A, size_t lenA, const uint32_t *B, size_t lenB,
+                uint32_t *out) {
+  const uint32_t *const initout = out;
+  size_t i = 0, j = 0;
+  while (i + 16 <= lenA && j + 16 <= lenB) {
+    const __m512i va = _mm512_loadu_si512(A + i);
+    const __m512i vb = _mm512_loadu_si512(B + j);
+    // a lane of va is in vb if its XOR with one of the rotations of vb is
+    // zero; the minimum of the XORs needs a single compare to a mask, which
+    // like VALIGND only issues on one port
+    __m512i x0 = _mm512_xor_si512(va, vb);
+    __m512i x1 = _mm512_xor_si512(va, _mm512_alignr_epi32(vb, vb, 1));
+    __m512i x2 = _mm512_xor_si512(va, _mm512_alignr_epi32(vb, vb, 2));
+    __m512i x3 = _mm512_xor_si512(va, _mm512_alignr_epi32(vb, vb, 3));
+#define AVX512_INTERSECT_ROTATIONS(k)                                          \
+  x0 = _mm512_min_epu32(x0, _mm512_xor_si512(                                  \
+                                va, _mm512_alignr_epi32(vb, vb, k)));          \
+  x1 = _mm512_min_epu32(x1, _mm512_xor_si512(                                  \
+                                va, _mm512_alignr_epi32(vb, vb, k + 1)));      \
+  x2 = _mm512_min_epu32(x2, _mm512_xor_si512(                                  \
+                                va, _mm512_alignr_epi32(vb, vb, k + 2)));      \
+  x3 = _mm512_min_epu32(x3, _mm512_xor_si512(                                  \
+                                va, _mm512_alignr_epi32(vb, vb, k + 3)));
+    AVX512_INTERSECT_ROTATIONS(4)
+    AVX512_INTERSECT_ROTATIONS(8)
+    AVX512_INTERSECT_ROTATIONS(12)
+#undef AVX512_INTERSECT_ROTATIONS
+    x0 = _mm512_min_epu32(_mm512_min_epu32(x0, x1), _mm512_min_epu32(x2, x3));
+    const __mmask16 mask = _mm512_testn_epi32_mask(x0, x0);
+    _mm512_mask_compressstoreu_epi32(out, mask, va);
+    out += _mm_popcnt_u32(mask);
+    const uint32_t amax = A[i + 15], bmax = B[j + 15];
+    i += amax <= bmax ? 16 : 0;
+    j += bmax <= amax ? 16 : 0;
+  }
+  out += avx2intersect(A + i, lenA - i, B + j, lenB - j, out);
+  return out - initout;
+}
+#endif
+
+namespace {
+
+typedef size_t (*intersectfnc)(const uint32_t *, size_t, const uint32_t *,
+                               size_t, uint32_t *);
+
+// AVX2 when the processor supports it, else SSE: the merge for lists of
+// unequal lengths, and for all lists without AVX-512
+intersectfnc selectintersect() {
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2"))
+    return &avx2intersect;
+  return &sseintersect;
+}
+
+const intersectfnc selectedintersect = selectintersect();
+
+#ifdef __AVX512F__
+const bool useavx512 = __builtin_cpu_supports("avx512f");
+#endif
+
+} // namespace
+
+// the AVX-512 merge compares twice the integers per step, which pays off when
+// both lists advance at about the same pace; with one list many times longer
+// most steps only skip a vector of it, and the AVX2 merge does that cheaper
+size_t simdintersect(const uint32_t *A, size_t lenA, const uint32_t *B,
+                     size_t lenB, uint32_t *out) {
+#ifdef __AVX512F__
+  if (useavx512 && lenA < AVX512Ratio * lenB && lenB < AVX512Ratio * lenA)
+    return avx512intersect(A, lenA, B, lenB, out);
+#endif
+  return selectedintersect(A, lenA, B, lenB, out);
+}
+
+const char *simdintersectname() {
+#ifdef __AVX512F__
+  if (useavx512)
+    return "avx512/avx2";
+#endif
+  return selectedintersect == &avx2intersect ? "avx2" : "sse";
+}
+
+size_t intersect(const uint32_t *A, size_t lenA, const uint32_t *B,
+                 size_t lenB, uint32_t *out) {
+  if (lenA > GallopingRatio * lenB)
+    return gallopingintersect(B, lenB, A, lenA, out);
+  if (lenB > GallopingRatio * lenA)
+    return gallopingintersect(A, lenA, B, lenB, out);
+  return simdintersect(A, lenA, B, lenB, out);
+}
+
+CompressedSortedList::CompressedSortedList(const uint32_t *data, size_t length)
+    : length(length), packed(length + BlockSize),
+      blockmax((length + BlockSize - 1) / BlockSize),
+      blockoffset(blockmax.size()), blockbits(blockmax.size()),
+      lastdecodedblocks(0) {
+  uint32_t deltas[BlockSize] __attribute__((aligned(16)));
+  uint32_t previous = 0;
+  size_t pos = 0;
+  for (size_t b = 0; b < blocks(); ++b) {
+    const size_t count = std::min<size_t>(BlockSize, length - b * BlockSize);
+    uint32_t accumulator = 0;
+    for (size_t k = 0; k < count; ++k) {
+      deltas[k] = data[b * BlockSize + k] - previous;
+      previous = data[b * BlockSize + k];
+      accumulator |= deltas[k];
+    }
+    std::fill(deltas + count, deltas + BlockSize, 0);
+    const uint32_t bit = accumulator == 0 ? 0 : 32 - __builtin_clz(accumulator);
+    blockmax[b] = previous;
+    blockoffset[b] = static_cast<uint32_t>(pos);
+    blockbits[b] = static_cast<uint8_t>(bit);
+    simdpack(deltas, reinterpret_cast<__m128i *>(packed.data() + pos), bit);
+    pos += BlockSize / 32 * bit;
+  }
+  packed.resize(pos);
+}
+
+size_t CompressedSortedList::decodeblock(size_t b, uint32_t *out) const {
+  simdunpackd1(_mm_set1_epi32(b == 0 ? 0 : blockmax[b - 1]),
+               reinterpret_cast<const __m128i *>(packed.data() + blockoffset[b]),
+               out, blockbits[b]);
+  return std::min<size_t>(BlockSize, length - b * BlockSize);
+}
+
+void CompressedSortedList::decode(uint32_t *out) const {
+  for (size_t b = 0; b < blocks(); ++b)
+    decodeblock(b, out + b * BlockSize);
+}
+
+size_t CompressedSortedList::intersect(const uint32_t *small, size_t lenSmall,
+                                       uint32_t *out) const {
+  uint32_t block[BlockSize] __attribute__((aligned(16)));
+  const uint32_t *const initout = out;
+  const uint32_t *const end = small + lenSmall;
+  const uint32_t *const maxbegin = blockmax.data();
+  const uint32_t *const maxend = maxbegin + blockmax.size();
+  const uint32_t *next = maxbegin;
+  lastdecodedblocks = 0;
+  while (small < end) {
+    // the first block that may hold *small, from the skip index
+    next = std::lower_bound(next, maxend, *small);
+    if (next == maxend)
+      break;
+    // the integers of small up to the largest of that block
+    const uint32_t *const stop = std::upper_bound(small, end, *next);
+    const size_t count = decodeblock(next - maxbegin, block);
+    ++lastdecodedblocks;
+    out += FastPForLib::intersect(small, stop - small, block, count, out);
+    small = stop;
+    ++next;
+  }
+  return out - initout;
+}
+
+} // namespace FastPForLib
@@ -0,0 +1,91 @@
+/**
+ * This code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ */
+
+/**
+ * Definitions of the functions declared in simdbitpacking.h: 128 integers of
+ * "bit" bits to/from "bit" aligned vectors, in the four-lane vertical layout of
+ * genericbitpacking.h.
+ */
+
+#include "simdbitpacking.h"
+#include "genericbitpacking.h"
+
+namespace FastPForLib {
+
+namespace {
+
+typedef void (*unpackfnc)(const __m128i *__restrict__, uint32_t *__restrict__);
+typedef void (*packfnc)(const uint32_t *__restrict__, __m128i *__restrict__);
+typedef __m128i (*deltaunpackfnc)(__m128i, const __m128i *__restrict__,
+                                  uint32_t *__restrict__);
+
+#define FASTPFOR_VERTICAL_UNPACKER(bit) &verticalunpack<bit, true>,
+#define FASTPFOR_VERTICAL_PACKER(bit) &verticalpack<bit, true, true>,
+#define FASTPFOR_VERTICAL_PACKER_WM(bit) &verticalpack<bit, true, false>,
+#define FASTPFOR_VERTICAL_UNPACKER_D1(bit) &verticalunpackdelta<bit, 1>,
+#define FASTPFOR_VERTICAL_UNPACKER_D2(bit) &verticalunpackdelta<bit, 2>,
+#define FASTPFOR_VERTICAL_UNPACKER_D4(bit) &verticalunpackdelta<bit, 4>,
+
+const unpackfnc unpackers[33] = {
+    FASTPFOR_FOR_EACH_BIT(FASTPFOR_VERTICAL_UNPACKER)};
+const packfnc packers[33] = {FASTPFOR_FOR_EACH_BIT(FASTPFOR_VERTICAL_PACKER)};
+const packfnc packerswithoutmask[33] = {
+    FASTPFOR_FOR_EACH_BIT(FASTPFOR_VERTICAL_PACKER_WM)};
+const deltaunpackfnc unpackersd1[33] = {
+    FASTPFOR_FOR_EACH_BIT(FASTPFOR_VERTICAL_UNPACKER_D1)};
+const deltaunpackfnc unpackersd2[33] = {
+    FASTPFOR_FOR_EACH_BIT(FASTPFOR_VERTICAL_UNPACKER_D2)};
+const deltaunpackfnc unpackersd4[33] = {
+    FASTPFOR_FOR_EACH_BIT(FASTPFOR_VERTICAL_UNPACKER_D4)};
+
+} // namespace
+
+void SIMD_fastunpack_32(const __m128i *__restrict__ in,
+                        uint32_t *__restrict__ out, const uint32_t bit) {
+  unpackers[bit](in, out);
+}
+
+void SIMD_fastpackwithoutmask_32(const uint32_t *__restrict__ in,
+                                 __m128i *__restrict__ out,
+                                 const uint32_t bit) {
+  packerswithoutmask[bit](in, out);
+}
+
+void SIMD_fastpack_32(const uint32_t *__restrict__ in,
+                      __m128i *__restrict__ out, const uint32_t bit) {
+  packers[bit](in, out);
+}
+
+void simdunpack(const __m128i *__restrict__ in, uint32_t *__restrict__ out,
+                uint32_t bit) {
+  unpackers[bit](in, out);
+}
+
+__m128i simdunpackd1(__m128i offset, const __m128i *__restrict__ in,
+                     uint32_t *__restrict__ out, uint32_t bit) {
+  return unpackersd1[bit](offset, in, out);
+}
+
+__m128i simdunpackd2(__m128i offset, const __m128i *__restrict__ in,
+                     uint32_t *__restrict__ out, uint32_t bit) {
+  return unpackersd2[bit](offset, in, out);
+}
+
+__m128i simdunpackd4(__m128i offset, const __m128i *__restrict__ in,
+                     uint32_t *__restrict__ out, uint32_t bit) {
+  return unpackersd4[bit](offset, in, out);
+}
+
+void simdpackwithoutmask(const uint32_t *__restrict__ in,
+                         __m128i *__restrict__ out, uint32_t bit) {
+  packerswithoutmask[bit](in, out);
+}
+
+void simdpack(const uint32_t *__restrict__ in, __m128i *__restrict__ out,
+              uint32_t bit) {
+  packers[bit](in, out);
+}
+
+} // namespace FastPForLib
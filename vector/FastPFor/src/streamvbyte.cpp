@@ -0,0 +1,120 @@
+/**
+ * This code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ */
+
+/**
+ * Stream VByte (Lemire, Kurz and Rupp), the encoder and the decoder used by
+ * the StreamVByte codec of streamvariablebyte.h.
+ *
+ * Each integer is stored on 1 to 4 little-endian bytes; the byte counts minus
+ * one are kept apart as 2-bit keys, four per key byte, the first integer in
+ * the low bits. With type == 1 the stream starts with the integer count. The
+ * decoder turns each key byte into a PSHUFB mask that scatters the data bytes
+ * of four integers into their lanes. Written for this tree; the upstream
+ * streamvbyte sources are not included.
+ */
+
+#include "streamvariablebyte.h"
+
+namespace FastPForLib {
+
+namespace {
+
+inline uint32_t svb_code(uint32_t val) {
+  return val < (1U << 8) ? 0 : val < (1U << 16) ? 1 : val < (1U << 24) ? 2 : 3;
+}
+
+inline uint32_t svb_read(const uint8_t *dataPtr, uint32_t code) {
+  uint32_t val = dataPtr[0];
+  for (uint32_t b = 1; b <= code; ++b)
+    val |= static_cast<uint32_t>(dataPtr[b]) << (8 * b);
+  return val;
+}
+
+struct ShuffleTable {
+  uint8_t shuffle[256][16] __attribute__((aligned(16)));
+  uint8_t length[256];
+
+  ShuffleTable() {
+    for (uint32_t key = 0; key < 256; ++key) {
+      uint8_t offset = 0;
+      for (uint32_t lane = 0; lane < 4; ++lane) {
+        const uint32_t bytes = ((key >> (2 * lane)) & 3) + 1;
+        for (uint32_t b = 0; b < 4; ++b)
+          shuffle[key][4 * lane + b] = b < bytes ? offset + b : 0x80;
+        offset += bytes;
+      }
+      length[key] = offset;
+    }
+  }
+};
+
+const ShuffleTable svb_table;
+
+} // namespace
+
+extern "C" {
+
+uint64_t svb_encode(uint8_t *out, const uint32_t *in, uint32_t count, int delta,
+                    int type) {
+  uint8_t *keyPtr = out;
+  if (type == 1) {
+    memcpy(keyPtr, &count, sizeof(count));
+    keyPtr += sizeof(count);
+  }
+  uint8_t *dataPtr = keyPtr + (count + 3) / 4;
+  uint32_t prev = 0, shift = 0;
+  uint8_t key = 0;
+  for (uint32_t i = 0; i < count; ++i) {
+    if (shift == 8) {
+      *keyPtr++ = key;
+      key = 0;
+      shift = 0;
+    }
+    const uint32_t val = delta ? in[i] - prev : in[i];
+    prev = in[i];
+    const uint32_t code = svb_code(val);
+    for (uint32_t b = 0; b <= code; ++b)
+      *dataPtr++ = static_cast<uint8_t>(val >> (8 * b));
+    key = static_cast<uint8_t>(key | (code << shift));
+    shift += 2;
+  }
+  if (count > 0)
+    *keyPtr = key;
+  return dataPtr - out;
+}
+
+uint8_t *svb_decode_avx_simple(uint32_t *out, uint8_t *keyPtr, uint8_t *dataPtr,
+                               uint64_t count) {
+  uint64_t i = 0;
+#ifdef __SSSE3__
+  // the next 16 integers use at least 16 data bytes, so the 16-byte load
+  // never reads past the stream
+  for (; i + 16 <= count; i += 4) {
+    const uint8_t key = *keyPtr++;
+    const __m128i data =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(dataPtr));
+    const __m128i shuffle = _mm_load_si128(
+        reinterpret_cast<const __m128i *>(svb_table.shuffle[key]));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out + i),
+                     _mm_shuffle_epi8(data, shuffle));
+    dataPtr += svb_table.length[key];
+  }
+#endif
+  for (uint32_t shift = 0; i < count; ++i) {
+    const uint32_t code = (*keyPtr >> shift) & 3;
+    out[i] = svb_read(dataPtr, code);
+    dataPtr += code + 1;
+    shift += 2;
+    if (shift == 8) {
+      ++keyPtr;
+      shift = 0;
+    }
+  }
+  return dataPtr;
+}
+
+} // extern "C"
+
+} // namespace FastPForLib
@@ -0,0 +1,49 @@
+/**
+ * This code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ */
+
+/**
+ * Definitions of the functions declared in usimdbitpacking.h: 128 integers of
+ * "bit" bits to/from "bit" unaligned vectors, in the four-lane vertical layout of
+ * genericbitpacking.h.
+ */
+
+#include "usimdbitpacking.h"
+#include "genericbitpacking.h"
+
+namespace FastPForLib {
+
+namespace {
+
+typedef void (*unpackfnc)(const __m128i *__restrict__, uint32_t *__restrict__);
+typedef void (*packfnc)(const uint32_t *__restrict__, __m128i *__restrict__);
+
+#define FASTPFOR_VERTICAL_UNPACKER(bit) &verticalunpack<bit, false>,
+#define FASTPFOR_VERTICAL_PACKER(bit) &verticalpack<bit, false, true>,
+#define FASTPFOR_VERTICAL_PACKER_WM(bit) &verticalpack<bit, false, false>,
+
+const unpackfnc unpackers[33] = {
+    FASTPFOR_FOR_EACH_BIT(FASTPFOR_VERTICAL_UNPACKER)};
+const packfnc packers[33] = {FASTPFOR_FOR_EACH_BIT(FASTPFOR_VERTICAL_PACKER)};
+const packfnc packerswithoutmask[33] = {
+    FASTPFOR_FOR_EACH_BIT(FASTPFOR_VERTICAL_PACKER_WM)};
+
+} // namespace
+
+void usimdunpack(const __m128i *__restrict__ in, uint32_t *__restrict__ out,
+                 uint32_t bit) {
+  unpackers[bit](in, out);
+}
+
+void usimdpackwithoutmask(const uint32_t *__restrict__ in,
+                          __m128i *__restrict__ out, uint32_t bit) {
+  packerswithoutmask[bit](in, out);
+}
+
+void usimdpack(const uint32_t *__restrict__ in, __m128i *__restrict__ out,
+               uint32_t bit) {
+  packers[bit](in, out);
+}
+
+} // namespace FastPForLib
@@ -0,0 +1,86 @@
+/**
+ * This code is released under the
+ * Apache License Version 2.0 http://www.apache.org/licenses/.
+ */
+
+/**
+ * Decoder of the MaskedVByte codec of simdvariablebyte.h: the usual variable
+ * byte format (7 bits per byte, least significant group first, the high bit
+ * set on every byte but the last one of an integer).
+ *
+ * As in the decoder of Plaisance, Kurz and Lemire, the high bits of 16 input
+ * bytes are gathered with one PMOVMSKB. When that mask shows 8 or 16
+ * single-byte integers, they are widened with PMOVZXBD at once; otherwise the
+ * integers that start in the first 8 bytes go through the scalar decoder. The
+ * per-mask shuffle tables of the original, which also vectorize the multi-byte
+ * cases, are not reproduced here, so this is not the MaskedVByte decoder, and
+ * benchcodecs labels the maskedvbyte row with this file.
+ */
+
+#include "simdvariablebyte.h"
+
+namespace {
+
+// decodes one integer, returns NULL if the input ends within it (the 0xFF
+// padding at the end of the stream)
+inline const uint8_t *read_varint(const uint8_t *in, const uint8_t *end,
+                                  uint32_t *out) {
+  uint32_t val = 0;
+  for (uint32_t shift = 0; in < end; shift += 7) {
+    const uint8_t byte = *in++;
+    val |= static_cast<uint32_t>(byte & 0x7F) << shift;
+    if (byte < 128) {
+      *out = val;
+      return in;
+    }
+  }
+  return NULL;
+}
+
+#ifdef __SSE4_1__
+inline void widen_bytes(__m128i bytes, uint32_t *out) {
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(out), _mm_cvtepu8_epi32(bytes));
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(out + 4),
+                   _mm_cvtepu8_epi32(_mm_srli_si128(bytes, 4)));
+}
+#endif
+
+} // namespace
+
+extern "C" {
+
+size_t masked_vbyte_read_loop_fromcompressedsize(const uint8_t *in,
+                                                 uint32_t *out,
+                                                 size_t inputsize) {
+  const uint8_t *const end = in + inputsize;
+  const uint32_t *const initout = out;
+#ifdef __SSE4_1__
+  while (end - in >= 16) {
+    const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(in));
+    const int mask = _mm_movemask_epi8(bytes);
+    if (mask == 0) {
+      widen_bytes(bytes, out);
+      widen_bytes(_mm_srli_si128(bytes, 8), out + 8);
+      in += 16;
+      out += 16;
+    } else if ((mask & 0xFF) == 0) {
+      widen_bytes(bytes, out);
+      in += 8;
+      out += 8;
+    } else {
+      // an integer takes at most 5 bytes, so it ends before "end"
+      for (const uint8_t *const stop = in + 8; in < stop;)
+        in = read_varint(in, end, out++);
+    }
+  }
+#endif
+  while (in < end) {
+    in = read_varint(in, end, out);
+    if (in == NULL)
+      break;
+    ++out;
+  }
+  return out - initout;
+}
+
+} // extern "C"
@@ -30,13 +30,16 @@ if [ "$bench" == "simd" ]; then
 
     test_files=""
     for test_file in test/*$individual*.cpp; do
+	avx512bw=`expr "$test_file" : '.*\(test_avx512bw.*\).cpp'`
 	avx2=`expr "$test_file" : '.*\(test_avx2.*\).cpp'`
 	avx1=`expr "$test_file" : '.*\(test_avx1.*\).cpp'`
 	sse2=`expr "$test_file" : '.*\(test_sse2.*\).cpp'`
 	ssse3=`expr "$test_file" : '.*\(test_ssse3.*\).cpp'`
 
 	file=""
-	if [ "$avx2" != "" ]; then
+	if [ "$avx512bw" != "" ]; then
+	    file=$avx512bw
+	elif [ "$avx2" != "" ]; then
 	    file=$avx2
 	elif [ "$avx1" != "" ]; then
 	    file=$avx1
@@ -56,12 +59,54 @@ if [ "$bench" == "simd" ]; then
     done
 
     if [ "$action" == "run" ]; then
+	# one machine-readable report per compiler/EXEC directory (csv or json)
+	report=execs_$exec/results.${5:-csv}
+	# outcome of the scalar-vs-vector correctness checks of every test
+	status=execs_$exec/status.csv
+	rm -f $report
+	echo "test,status" > $status
 	for test_file in $test_files; do
 	    echo "running $test_file"
-	    ./$test_file
+	    if ./$test_file -pr=$report "${@:6}"; then
+		echo "`basename $test_file`,ok" >> $status
+	    else
+		echo "`basename $test_file`,fail" >> $status
+	    fi
 	done
+	# per-kernel Base / hand-vectorized speedup matrix
+	python3 speedup.py $report $status > execs_$exec/speedup.csv
+	echo "speedup matrix written to simd/execs_$exec/speedup.csv"
     fi
     
+elif [ "$bench" == "x265" ] || [ "$bench" == "pfor" ]; then
+    if [ "$bench" == "x265" ]; then
+	echo "${red}running x265 benchmarks${reset}"
+	cd x265
+	benchmarks="256 512"
+    else
+	echo "${red}running FastPFor benchmarks${reset}"
+	cd FastPFor
+	benchmarks="256_benchhorizontalbitpacking 512_benchhorizontalbitpacking 256_benchcodecs 512_benchcodecs 256_benchdelta 512_benchdelta 256_benchintersection 512_benchintersection"
+    fi
+
+    if [ "$4" == "" ]; then # we assume a default compiler in this case
+	exec="default"
+    else
+	exec=$4
+    fi
+
+    # the C/scalar references are built with the same compiler and flags as the
+    # hand-vectorized kernels; each benchmark prints its timings followed by the
+    # speedup over the reference and whether the outputs are identical
+    make OUTPUT_DIR=execs_$exec all
+
+    if [ "$action" == "run" ]; then
+	for benchmark in $benchmarks; do
+	    echo "running execs_$exec/$benchmark"
+	    ./execs_$exec/$benchmark | tee execs_$exec/$benchmark.out
+	done
+    fi
+
 fi
 
 
@@ -172,6 +172,8 @@ namespace Simd
             \param [in] roi - a 8-bit image mask which defines Region Of Interest. User can restricts detection region with using this mask.
                               The mask affects to the center of detected object.
             \param [in] threadNumber - a number of work threads. It useful for multi core CPU. Use value -1 to auto choose of thread number. 
+                                      If it is greater than 1 the detection runs on so many threads of the global thread pool (see Simd::ThreadPool).
+                                      It is limited by the size of the pool.
             \return a result of this operation.
         */
         bool Init(const Size & imageSize, double scaleFactor = 1.1, const Size & sizeMin = Size(0, 0),
@@ -180,7 +182,7 @@ namespace Simd
             if (_data.empty())
                 return false;
             _imageSize = imageSize;
-            ptrdiff_t threadNumberMax = std::thread::hardware_concurrency();
+            ptrdiff_t threadNumberMax = ThreadPool::Global().Size();
             _threadNumber = (threadNumber <= 0 || threadNumber > threadNumberMax) ? threadNumberMax : threadNumber;
             return InitLevels(scaleFactor, sizeMin, sizeMax, roi);
         }
@@ -205,9 +207,7 @@ namespace Simd
 
             FillLevels(src);
 
-            typedef std::map<Tag, Objects> Candidates;
-            Candidates candidates;
-
+            _hids.clear();
             for (size_t i = 0; i < _levels.size(); ++i)
             {
                 Level & level = _levels[i];
@@ -222,13 +222,28 @@ namespace Simd
                     continue;
                 for (size_t j = 0; j < level.hids.size(); ++j)
                 {
-                    Hid & hid = level.hids[j];
+                    level.hids[j].Init(mask, rect);
+                    _hids.push_back(&level.hids[j]);
+                }
+            }
+
+            Run(_hids.size(), [this](size_t i)
+            {
+                _hids[i]->Prepare();
+            });
 
-                    hid.Detect(mask, rect, level.dst, _threadNumber, level.throughColumn);
+            InitBands();
+            Run(_bands.size(), [this](size_t i)
+            {
+                _bands[i].hid->Detect(_bands[i].top, _bands[i].bottom);
+            });
 
-                    AddObjects(candidates[hid.data->tag], level.dst, rect, hid.data->size, level.scale,
-                        level.throughColumn ? 2 : 1, hid.data->tag);
-                }
+            typedef std::map<Tag, Objects> Candidates;
+            Candidates candidates;
+            for (size_t i = 0; i < _hids.size(); ++i)
+            {
+                const Hid & hid = *_hids[i];
+                AddObjects(candidates[hid.data->tag], hid.dst, hid.rect, hid.data->size, hid.scale, hid.step, hid.data->tag);
             }
 
             objects.clear();
@@ -266,22 +281,42 @@ namespace Simd
             Handle handle;
             Data * data;
             DetectPtr detect;
+            double scale;
+            ptrdiff_t step;
+
+            View dst;
+            View mask;
+            Rect rect;
+            Rect window;
 
-            void Detect(const View & mask, const Rect & rect, View & dst, size_t threadNumber, bool throughColumn)
+            void Init(const View & m, const Rect & r)
             {
                 Size s = dst.Size() - data->size;
-                View m = mask.Region(s, View::MiddleCenter);
-                Rect r = rect.Shifted(-data->size / 2).Intersection(Rect(s));
+                mask = m.Region(s, View::MiddleCenter);
+                rect = r;
+                window = r.Shifted(-data->size / 2).Intersection(Rect(s));
+            }
+
+            void Prepare()
+            {
                 Simd::Fill(dst, 0);
                 ::SimdDetectionPrepare(handle);
+            }
 
-                Parallel(r.top, r.bottom, [&](size_t thread, size_t begin, size_t end)
-                {
-                    detect(handle, m.data, m.stride, r.left, begin, r.right, end, dst.data, dst.stride);
-                }, threadNumber, throughColumn ? 2 : 1);
+            void Detect(ptrdiff_t top, ptrdiff_t bottom)
+            {
+                detect(handle, mask.data, mask.stride, window.left, top, window.right, bottom, dst.data, dst.stride);
             }
         };
         typedef std::vector<Hid> Hids;
+        typedef std::vector<Hid*> HidPtrs;
+
+        struct Band
+        {
+            Hid * hid;
+            ptrdiff_t top, bottom;
+        };
+        typedef std::vector<Band> Bands;
 
         struct Level
         {
@@ -298,8 +333,6 @@ namespace Simd
             View sqsum;
             View tilted;
 
-            View dst;
-
             bool throughColumn;
             bool needSqsum;
             bool needTilted;
@@ -317,6 +350,43 @@ namespace Simd
         bool _needNormalization;
         ptrdiff_t _threadNumber;
         Levels _levels;
+        HidPtrs _hids;
+        Bands _bands;
+
+        template<class Task> void Run(size_t count, const Task & task)
+        {
+            if (_threadNumber > 1)
+                ThreadPool::Global().Run(count, task, size_t(_threadNumber));
+            else
+            {
+                for (size_t i = 0; i < count; ++i)
+                    task(i);
+            }
+        }
+
+        void InitBands()
+        {
+            size_t area = 0;
+            for (size_t i = 0; i < _hids.size(); ++i)
+                area += _hids[i]->window.Area();
+            size_t bandArea = std::max<size_t>(area / (size_t(_threadNumber) * 8), 1);
+
+            _bands.clear();
+            for (size_t i = 0; i < _hids.size(); ++i)
+            {
+                Hid & hid = *_hids[i];
+                const Rect & w = hid.window;
+                if (w.Empty())
+                    continue;
+                ptrdiff_t height = std::max<ptrdiff_t>(bandArea / w.Width(), 1);
+                height = (height + hid.step - 1) / hid.step * hid.step;
+                for (ptrdiff_t top = w.top; top < w.bottom; top += height)
+                {
+                    Band band = { &hid, top, std::min(top + height, w.bottom) };
+                    _bands.push_back(band);
+                }
+            }
+        }
 
         bool InitLevels(double scaleFactor, const Size & sizeMin, const Size & sizeMax, const View & roi)
         {
@@ -359,9 +429,8 @@ namespace Simd
                     level.sqsum.Recreate(scaledSize + Size(1, 1), View::Int32);
                     level.tilted.Recreate(scaledSize + Size(1, 1), View::Int32);
 
-                    level.dst.Recreate(scaledSize, View::Gray8);
-
                     level.needSqsum = false, level.needTilted = false;
+                    level.hids.reserve(_data.size());
                     for (size_t i = 0; i < _data.size(); ++i)
                     {
                         if (!inserts[i])
@@ -373,6 +442,8 @@ namespace Simd
                             Hid hid;
                             hid.handle = handle;
                             hid.data = &_data[i];
+                            hid.scale = scale;
+                            hid.step = level.throughColumn ? 2 : 1;
                             if (_data[i].Haar())
                                 hid.detect = level.throughColumn ? ::SimdDetectionHaarDetect32fi : ::SimdDetectionHaarDetect32fp;
                             else
@@ -383,6 +454,7 @@ namespace Simd
                                     hid.detect = level.throughColumn ? ::SimdDetectionLbpDetect32fi : ::SimdDetectionLbpDetect32fp;
                             }
                             level.hids.push_back(hid);
+                            level.hids.back().dst.Recreate(scaledSize, View::Gray8);
                         }
                         else
                             return false;
@@ -420,11 +492,11 @@ namespace Simd
             if (_needNormalization)
                 Simd::NormalizeHistogram(_levels[0].src, _levels[0].src);
             EstimateIntegral(_levels[0]);
-            for (size_t i = 1; i < _levels.size(); ++i)
+            Run(_levels.size() - 1, [this](size_t i)
             {
-                Simd::ResizeBilinear(_levels[0].src, _levels[i].src);
-                EstimateIntegral(_levels[i]);
-            }
+                Simd::ResizeBilinear(_levels[0].src, _levels[i + 1].src);
+                EstimateIntegral(_levels[i + 1]);
+            });
         }
 
         void EstimateIntegral(Level & level)        
@@ -77,6 +77,7 @@ namespace Simd
 
             // Ecx:
             SSE3 = 1 << 0,
+            PCLMULQDQ = 1 << 1,
             SSSE3 =	1 << 9,
             SSE41 = 1 << 19,
             SSE42 = 1 << 20,
@@ -91,6 +92,7 @@ namespace Simd
 
             // Ecx:
             AVX512VBMI = 1 << 1,
+            VPCLMULQDQ = 1 << 10,
         };
 
         SIMD_INLINE bool CheckBit(Level level, Register index, Bit bit)
@@ -312,6 +314,8 @@ namespace Simd
         }
 
         const bool Enable = SupportedByCPU() && SupportedByOS();
+
+        const bool PclmulEnable = Enable && Cpuid::CheckBit(Cpuid::Ordinary, Cpuid::Ecx, Cpuid::PCLMULQDQ);
     }
 #endif
 
@@ -377,6 +381,71 @@ namespace Simd
 	}
 #endif
 
+#ifdef SIMD_AVX512F_ENABLE
+    namespace Avx512f
+    {
+        SIMD_INLINE bool SupportedByCPU()
+        {
+            return
+                Cpuid::CheckBit(Cpuid::Ordinary, Cpuid::Ecx, Cpuid::OSXSAVE) &&
+                Cpuid::CheckBit(Cpuid::Extended, Cpuid::Ebx, Cpuid::AVX512F);
+        }
+
+        SIMD_INLINE bool SupportedByOS()
+        {
+#if defined(_MSC_VER)
+            __try
+            {
+                __m512 value = _mm512_abs_ps(_mm512_set1_ps(1.0f));// try to execute of AVX-512F instructions;
+                return true;
+            }
+            __except(EXCEPTION_EXECUTE_HANDLER)
+            {
+                return false;
+            }
+#else
+            return true;
+#endif
+        }
+
+        const bool Enable = SupportedByCPU() && SupportedByOS();
+    }
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+    namespace Avx512bw
+    {
+        SIMD_INLINE bool SupportedByCPU()
+        {
+            return
+                Cpuid::CheckBit(Cpuid::Ordinary, Cpuid::Ecx, Cpuid::OSXSAVE) &&
+                Cpuid::CheckBit(Cpuid::Extended, Cpuid::Ebx, Cpuid::AVX512F) &&
+                Cpuid::CheckBit(Cpuid::Extended, Cpuid::Ebx, Cpuid::AVX512BW);
+        }
+
+        SIMD_INLINE bool SupportedByOS()
+        {
+#if defined(_MSC_VER)
+            __try
+            {
+                __m512i value = _mm512_abs_epi8(_mm512_set1_epi8(1));// try to execute of AVX-512BW instructions;
+                return true;
+            }
+            __except(EXCEPTION_EXECUTE_HANDLER)
+            {
+                return false;
+            }
+#else
+            return true;
+#endif
+        }
+
+        const bool Enable = SupportedByCPU() && SupportedByOS();
+
+        const bool VpclmulqdqEnable = Enable && Cpuid::CheckBit(Cpuid::Extended, Cpuid::Ecx, Cpuid::VPCLMULQDQ);
+    }
+#endif
+
 #ifdef SIMD_VMX_ENABLE
     namespace Vmx
     {
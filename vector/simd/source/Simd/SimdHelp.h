@@ -168,7 +168,7 @@
 
 /*! @ingroup cpp_types
     @defgroup cpp_allocator Allocator
-    \short Simd::Allocator structure. 
+    \short Simd::Allocator and Simd::PoolAllocator structures. 
 */
 
 /*! @ingroup cpp_types
@@ -251,6 +251,11 @@
     \short Drawing functions.
 */
 
+/*! @ingroup cpp_types
+    @defgroup cpp_pipeline Pipeline
+    \short Simd::GradientPipeline and Simd::BackgroundPipeline structures (fused strip-by-strip processing of a chain of functions).
+*/
+
 /*! @defgroup functions Functions
     \short Functions of %Simd Library API.
 */
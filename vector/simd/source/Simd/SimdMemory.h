@@ -155,6 +155,21 @@ namespace Simd
     }
 #endif// SIMD_AVX2_ENABLE
 
+#ifdef SIMD_AVX512BW_ENABLE
+    namespace Avx512bw
+    {
+        SIMD_INLINE bool Aligned(size_t size, size_t align = sizeof(__m512i))
+        {
+            return Simd::Aligned(size, align);
+        }
+
+        SIMD_INLINE bool Aligned(const void * ptr, size_t align = sizeof(__m512i))
+        {
+            return Simd::Aligned(ptr, align);
+        }
+    }
+#endif// SIMD_AVX512BW_ENABLE
+
 #ifdef SIMD_VMX_ENABLE
     namespace Vmx
     {
@@ -24,36 +24,288 @@
 #ifndef __SimdParallel_hpp__
 #define __SimdParallel_hpp__
 
+#include <stdint.h>
+#include <string.h>
+
 #include <thread>
 #include <future>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <vector>
+#include <algorithm>
 
 namespace Simd
 {
+    /*! @ingroup cpp_parallel
+
+        \short Persistent work-stealing thread pool.
+
+        The tasks of one Run call are split into a contiguous range per participant (the workers and the calling thread).
+        Every participant takes tasks from its own range and then steals from the ranges of the others.
+        A Run can be limited to the first participants of the pool, the others stay idle.
+        A Run called from inside a task is executed serially in the calling thread.
+    */
+    class ThreadPool
+    {
+    public:
+        ThreadPool(size_t threadNumber)
+            : _queues(std::max<size_t>(threadNumber, 1))
+            , _task(NULL)
+            , _active(0)
+            , _generation(0)
+            , _pending(0)
+            , _stop(false)
+        {
+            Start();
+        }
+
+        ~ThreadPool()
+        {
+            Stop();
+        }
+
+        static ThreadPool & Global()
+        {
+            static ThreadPool pool(std::thread::hardware_concurrency());
+            return pool;
+        }
+
+        size_t Size() const
+        {
+            return _queues.size();
+        }
+
+        /*!
+            Changes the number of participants of the pool (the workers and the calling thread).
+            It waits for the current Run to finish and must not be called from inside a task.
+
+            \param [in] threadNumber - a new number of threads.
+        */
+        void Resize(size_t threadNumber)
+        {
+            std::lock_guard<std::mutex> run(_run);
+            Stop();
+            std::vector<Queue>(std::max<size_t>(threadNumber, 1)).swap(_queues);
+            Start();
+        }
+
+        static bool InTask()
+        {
+            return Current();
+        }
+
+        template<class Task> void Run(size_t count, const Task & task, size_t threadNumber = size_t(-1))
+        {
+            const size_t active = std::min(threadNumber, _queues.size());
+            if (count <= 1 || active <= 1 || InTask())
+            {
+                for (size_t i = 0; i < count; ++i)
+                    task(i);
+                return;
+            }
+            std::lock_guard<std::mutex> run(_run);
+            std::function<void(size_t)> function(task);
+            for (size_t i = 0; i < active; ++i)
+            {
+                _queues[i].next = count*i/active;
+                _queues[i].end = count*(i + 1)/active;
+            }
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _task = &function;
+                _active = active;
+                _pending = _workers.size();
+                _generation++;
+            }
+            _start.notify_all();
+            Work(0);
+            std::unique_lock<std::mutex> lock(_mutex);
+            _done.wait(lock, [this] { return _pending == 0; });
+            _task = NULL;
+        }
+
+    private:
+        struct Queue
+        {
+            std::atomic<size_t> next;
+            size_t end;
+            char padding[64 - sizeof(std::atomic<size_t>) - sizeof(size_t)];
+
+            Queue() : next(0), end(0) {}
+        };
+
+        std::vector<Queue> _queues;
+        std::vector<std::thread> _workers;
+        std::mutex _run, _mutex;
+        std::condition_variable _start, _done;
+        const std::function<void(size_t)> * _task;
+        size_t _active, _generation, _pending;
+        bool _stop;
+
+        static bool & Current()
+        {
+            static thread_local bool current = false;
+            return current;
+        }
+
+        void Work(size_t id)
+        {
+            if (id >= _active)
+                return;
+            Current() = true;
+            for (size_t i = 0; i < _active; ++i)
+            {
+                Queue & queue = _queues[(id + i) % _active];
+                for (size_t task = queue.next++; task < queue.end; task = queue.next++)
+                    (*_task)(task);
+            }
+            Current() = false;
+        }
+
+        void Start()
+        {
+            for (size_t i = 1; i < _queues.size(); ++i)
+                _workers.push_back(std::thread(&ThreadPool::Worker, this, i, _generation));
+        }
+
+        void Stop()
+        {
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                _stop = true;
+            }
+            _start.notify_all();
+            for (size_t i = 0; i < _workers.size(); ++i)
+                _workers[i].join();
+            _workers.clear();
+            _stop = false;
+        }
+
+        void Worker(size_t id, size_t generation)
+        {
+            for (;;)
+            {
+                {
+                    std::unique_lock<std::mutex> lock(_mutex);
+                    _start.wait(lock, [this, generation] { return _stop || _generation != generation; });
+                    if (_stop)
+                        return;
+                    generation = _generation;
+                }
+                Work(id);
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    if (--_pending == 0)
+                        _done.notify_one();
+                }
+            }
+        }
+    };
+
+    /*! @ingroup cpp_parallel
+
+        \short Number of threads used by the row-tiled filters of the library (1 by default, see ::SimdSetThreadNumber).
+    */
+    inline size_t & ThreadNumber()
+    {
+        static size_t threadNumber = 1;
+        return threadNumber;
+    }
+
     template<class Function> inline void Parallel(size_t begin, size_t end, const Function & function, size_t threadNumber, size_t blockStepMin = 1) 
     {
-        threadNumber = std::min<size_t>(threadNumber, std::thread::hardware_concurrency());
+        threadNumber = std::min<size_t>(threadNumber, ThreadPool::Global().Size());
         if (threadNumber <= 1)
             function(0, begin, end);
         else
         {
-            std::vector<std::future<void>> futures;
-
             size_t blockSize = (end - begin + threadNumber - 1)/threadNumber;
             if (blockStepMin > 1)
                 blockSize += blockSize%blockStepMin;
-            size_t blockBegin = begin;
-            size_t blockEnd = blockBegin + blockSize;
+            size_t blockCount = (end - begin + blockSize - 1)/blockSize;
+
+            ThreadPool::Global().Run(blockCount, [begin, end, blockSize, &function](size_t block)
+            {
+                size_t blockBegin = begin + block*blockSize;
+                function(block, blockBegin, std::min(blockBegin + blockSize, end));
+            }, threadNumber);
+        }
+    }
+
+    /*! @ingroup cpp_parallel
+
+        \short Runs a row filter in horizontal bands on ThreadNumber() threads of the global thread pool.
+
+        The filter must compute every output row from the input rows within 'radius' of it, replicating the first and
+        the last rows at the image borders. The rows closer than 'radius' to an inner band border are recomputed
+        from a window of 3*radius input rows, so the result is identical to a single call for the whole image.
+
+        \param [in] src - a pointer to the first row of the input image.
+        \param [in] srcStride - a row size of the input image.
+        \param [in] height - an image height.
+        \param [out] dst - a pointer to the first row of the output image.
+        \param [in] dstStride - a row size of the output image.
+        \param [in] dstRowSize - a size in bytes of the useful part of an output row.
+        \param [in] radius - a vertical radius of the filter.
+        \param [in] filter - a functor filter(src, height, dst, dstStride) processing a part of the image.
+        \return false if the image must be processed by a single call (one thread, a nested call or a small image).
+    */
+    template<class Filter> inline bool ParallelRows(const uint8_t * src, size_t srcStride, size_t height,
+        uint8_t * dst, size_t dstStride, size_t dstRowSize, size_t radius, const Filter & filter)
+    {
+        const size_t threadNumber = std::min(ThreadNumber(), ThreadPool::Global().Size());
+        if (threadNumber <= 1 || ThreadPool::InTask())
+            return false;
+        const size_t bandCount = std::min(threadNumber*4, height/std::max<size_t>(16, 4*radius));
+        if (bandCount <= 1)
+            return false;
+
+        ThreadPool::Global().Run(bandCount, [=, &filter](size_t band)
+        {
+            const size_t begin = height*band/bandCount, end = height*(band + 1)/bandCount;
+            filter(src + begin*srcStride, end - begin, dst + begin*dstStride, dstStride);
 
-            for (size_t thread = 0; thread < threadNumber && blockBegin < end; ++thread)
+            std::vector<uint8_t> buffer;
+            const size_t borders[2] = { begin, end - radius };
+            for (size_t i = 0; i < 2; ++i)
             {
-                futures.push_back(std::move(std::async(std::launch::async, [blockBegin, blockEnd, thread, &function] { function(thread, blockBegin, blockEnd); })));
-                blockBegin += blockSize;
-                blockEnd = std::min(blockBegin + blockSize, end);
+                if ((i == 0 && begin == 0) || (i == 1 && end == height))
+                    continue;
+                const size_t top = borders[i] - radius, bottom = std::min(borders[i] + 2*radius, height);
+                buffer.resize((bottom - top)*dstRowSize);
+                filter(src + top*srcStride, bottom - top, buffer.data(), dstRowSize);
+                for (size_t row = 0; row < radius; ++row)
+                    memcpy(dst + (borders[i] + row)*dstStride, buffer.data() + (radius + row)*dstRowSize, dstRowSize);
             }
+        }, threadNumber);
+        return true;
+    }
 
-            for (size_t i = 0; i < futures.size(); ++i)
-                futures[i].wait();        
-        }
+    /*! @ingroup cpp_parallel
+
+        \short Runs a functor over independent items in contiguous blocks on ThreadNumber() threads of the global thread pool.
+
+        \param [in] size - a number of items.
+        \param [in] blockMin - a minimal number of items in one block.
+        \param [in] function - a functor function(begin, end) processing the items [begin, end).
+        \return false if the items must be processed by a single call (one thread, a nested call or too few items).
+    */
+    template<class Function> inline bool ParallelRange(size_t size, size_t blockMin, const Function & function)
+    {
+        const size_t threadNumber = std::min(ThreadNumber(), ThreadPool::Global().Size());
+        if (threadNumber <= 1 || ThreadPool::InTask())
+            return false;
+        const size_t blockCount = std::min(threadNumber*4, size/std::max<size_t>(blockMin, 1));
+        if (blockCount <= 1)
+            return false;
+
+        ThreadPool::Global().Run(blockCount, [=, &function](size_t block)
+        {
+            function(size*block/blockCount, size*(block + 1)/blockCount);
+        }, threadNumber);
+        return true;
     }
 }
 
@@ -0,0 +1,363 @@
+/*
+* Simd Library (http://simd.sourceforge.net).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdPoolAllocator_hpp__
+#define __SimdPoolAllocator_hpp__
+
+#include "SimdAllocator.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace Simd
+{
+    namespace Detail
+    {
+        /*
+            Size-class pool of aligned memory blocks.
+            Sizes are rounded up to 4 classes per power of two (at most 25% overhead), starting from 256 bytes.
+            A freed block goes to the cache of the current thread, then to the shared lists, and is returned
+            to the system only when both are full. The cache of a thread is moved to the shared lists at the thread exit.
+        */
+        class Pool
+        {
+        public:
+            struct Statistic
+            {
+                size_t allocations, systemAllocations, systemFrees, cachedBytes;
+            };
+
+            // The pool is never destroyed: the caches of worker threads can be released after the end of main().
+            static Pool & Global()
+            {
+                static Pool * pool = new Pool();
+                return *pool;
+            }
+
+            void * Allocate(size_t size, size_t align)
+            {
+                _allocations++;
+                size_t index = Index(size);
+                if (index >= CLASS_COUNT || align > ALIGN || (align & (align - 1)))
+                {
+                    const size_t offset = Allocator<uint8_t>::Align(sizeof(Header), align);
+                    uint8_t * raw = (uint8_t*)SystemAllocate(size + offset, align);
+                    return Init(raw + offset, CLASS_COUNT, raw);
+                }
+
+                Cache & cache = Local();
+                if (!cache.blocks[index].empty())
+                {
+                    void * ptr = cache.blocks[index].back();
+                    cache.blocks[index].pop_back();
+                    cache.bytes -= ClassSize(index);
+                    _cachedBytes -= ClassSize(index);
+                    return ptr;
+                }
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    if (!_blocks[index].empty())
+                    {
+                        void * ptr = _blocks[index].back();
+                        _blocks[index].pop_back();
+                        _bytes -= ClassSize(index);
+                        _cachedBytes -= ClassSize(index);
+                        return ptr;
+                    }
+                }
+                uint8_t * raw = (uint8_t*)SystemAllocate(ClassSize(index) + ALIGN, ALIGN);
+                return Init(raw + ALIGN, index, raw);
+            }
+
+            void Free(void * ptr)
+            {
+                if (ptr == NULL)
+                    return;
+                const Header & header = ((Header*)ptr)[-1];
+                if (header.index >= CLASS_COUNT)
+                {
+                    SystemFree(header.raw);
+                    return;
+                }
+
+                const size_t size = ClassSize(header.index);
+                Cache & cache = Local();
+                if (cache.blocks[header.index].size() < LOCAL_BLOCKS && cache.bytes + size <= LOCAL_BYTES)
+                {
+                    cache.blocks[header.index].push_back(ptr);
+                    cache.bytes += size;
+                    _cachedBytes += size;
+                    return;
+                }
+                Put(ptr, header.index);
+            }
+
+            void Clear()
+            {
+                Cache & cache = Local();
+                for (size_t i = 0; i < CLASS_COUNT; ++i)
+                {
+                    for (size_t j = 0; j < cache.blocks[i].size(); ++j)
+                        SystemFree(((Header*)cache.blocks[i][j])[-1].raw);
+                    _cachedBytes -= cache.blocks[i].size()*ClassSize(i);
+                    cache.blocks[i].clear();
+                }
+                cache.bytes = 0;
+
+                std::lock_guard<std::mutex> lock(_mutex);
+                for (size_t i = 0; i < CLASS_COUNT; ++i)
+                {
+                    for (size_t j = 0; j < _blocks[i].size(); ++j)
+                        SystemFree(((Header*)_blocks[i][j])[-1].raw);
+                    _cachedBytes -= _blocks[i].size()*ClassSize(i);
+                    _blocks[i].clear();
+                }
+                _bytes = 0;
+            }
+
+            Statistic GetStatistic() const
+            {
+                Statistic statistic = { _allocations, _systemAllocations, _systemFrees, _cachedBytes };
+                return statistic;
+            }
+
+        private:
+            static const size_t ALIGN = 64, CLASS_MIN = 256, CLASS_COUNT = 1 + 4*32;
+            static const size_t LOCAL_BLOCKS = 8, LOCAL_BYTES = size_t(64)*1024*1024, GLOBAL_BYTES = size_t(512)*1024*1024;
+
+            struct Header
+            {
+                void * raw;
+                size_t index;
+            };
+
+            struct Cache
+            {
+                std::vector<void*> blocks[CLASS_COUNT];
+                size_t bytes;
+
+                Cache() : bytes(0) {}
+
+                ~Cache()
+                {
+                    Pool & pool = Global();
+                    for (size_t i = 0; i < CLASS_COUNT; ++i)
+                        for (size_t j = 0; j < blocks[i].size(); ++j)
+                        {
+                            pool._cachedBytes -= ClassSize(i);
+                            pool.Put(blocks[i][j], i);
+                        }
+                }
+            };
+
+            std::mutex _mutex;
+            std::vector<void*> _blocks[CLASS_COUNT];
+            size_t _bytes;
+            std::atomic<size_t> _allocations, _systemAllocations, _systemFrees, _cachedBytes;
+
+            Pool() : _bytes(0), _allocations(0), _systemAllocations(0), _systemFrees(0), _cachedBytes(0) {}
+
+            static Cache & Local()
+            {
+                static thread_local Cache cache;
+                return cache;
+            }
+
+            // Class 0 holds blocks up to CLASS_MIN bytes; class 1 + 4*k + i holds blocks up to (5 + i)*2^(k + 6) bytes.
+            static size_t Index(size_t size)
+            {
+                if (size <= CLASS_MIN)
+                    return 0;
+                size_t n = size - 1, k = 0;
+                while ((n >> k) > 7)
+                    k++;
+                return 1 + 4*(k - 6) + (n >> k) - 4;
+            }
+
+            static size_t ClassSize(size_t index)
+            {
+                if (index == 0)
+                    return CLASS_MIN;
+                const size_t k = (index - 1)/4 + 6, i = (index - 1)%4;
+                return (5 + i) << k;
+            }
+
+            static void * Init(uint8_t * ptr, size_t index, void * raw)
+            {
+                Header & header = ((Header*)ptr)[-1];
+                header.raw = raw;
+                header.index = index;
+                return ptr;
+            }
+
+            void * SystemAllocate(size_t size, size_t align)
+            {
+                _systemAllocations++;
+                return Allocator<uint8_t>::Allocate(size, align);
+            }
+
+            void SystemFree(void * raw)
+            {
+                _systemFrees++;
+                Allocator<uint8_t>::Free(raw);
+            }
+
+            void Put(void * ptr, size_t index)
+            {
+                const size_t size = ClassSize(index);
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    if (_bytes + size <= GLOBAL_BYTES)
+                    {
+                        _blocks[index].push_back(ptr);
+                        _bytes += size;
+                        _cachedBytes += size;
+                        return;
+                    }
+                }
+                SystemFree(((Header*)ptr)[-1].raw);
+            }
+        };
+    }
+
+    /*! @ingroup cpp_allocator
+
+        \short Aligned memory allocator with a pool of reusable memory blocks.
+
+        It has the interface of Simd::Allocator and can be used as its replacement in Simd::View, Simd::Frame, 
+        Simd::Pyramid, Simd::Detection and STL containers. Freed blocks are kept in size classes (4 per power of two) 
+        in a cache of the calling thread (up to 8 blocks of a class and 64 MB) and in shared lists (up to 512 MB),
+        so images of the same size which are created and deleted for every frame do not go to the system allocator.
+        The memory cached by the pool is returned to the system by Simd::PoolAllocator::Clear.
+
+        Using example:
+        \verbatim
+        #include "SimdPoolAllocator.hpp"
+        #include "SimdFrame.hpp"
+
+        int main()
+        {
+            typedef Simd::Frame<Simd::PoolAllocator> Frame;
+
+            Frame nv12(1920, 1080, Frame::Nv12);
+            for (size_t i = 0; i < 100; ++i)
+            {
+                // the memory of the previous bgra frame is reused:
+                Frame bgra(nv12.Size(), Frame::Bgra32);
+                Simd::Convert(nv12, bgra);
+            }
+
+            return 0;
+        }
+        \endverbatim
+    */
+    template <class T> struct PoolAllocator : public Allocator<T>
+    {
+        typedef Detail::Pool::Statistic Statistic; /*!< A statistic of the pool: numbers of all and system allocations, of system frees and a size of cached memory. */
+
+        /*!
+            \fn void * Allocate(size_t size, size_t align);
+
+            \short Allocates aligned memory block from the pool.
+
+            \note The memory allocated by this function is must be deleted by function Simd::PoolAllocator::Free.
+
+            \param [in] size - a size of required memory block.
+            \param [in] align - an align of allocated memory address.
+            \return a pointer to allocated memory.
+        */
+        static SIMD_INLINE void * Allocate(size_t size, size_t align)
+        {
+            return Detail::Pool::Global().Allocate(size, align);
+        }
+
+        /*!
+            \fn void Free(void * ptr);
+
+            \short Returns aligned memory block to the pool.
+
+            \note This function frees a memory allocated by function Simd::PoolAllocator::Allocate.
+
+            \param [in] ptr - a pointer to the memory to be deleted.
+        */
+        static SIMD_INLINE void Free(void * ptr)
+        {
+            Detail::Pool::Global().Free(ptr);
+        }
+
+        /*!
+            \fn void Clear();
+
+            \short Returns the memory cached by the pool (shared lists and the cache of the calling thread) to the system.
+        */
+        static SIMD_INLINE void Clear()
+        {
+            Detail::Pool::Global().Clear();
+        }
+
+        /*!
+            \fn Statistic GetStatistic();
+
+            \short Gets a statistic of the pool.
+
+            \return a statistic of the pool.
+        */
+        static SIMD_INLINE Statistic GetStatistic()
+        {
+            return Detail::Pool::Global().GetStatistic();
+        }
+
+        //---------------------------------------------------------------------
+        // STL allocator interface implementation:
+
+        typedef typename Allocator<T>::pointer pointer;
+        typedef typename Allocator<T>::size_type size_type;
+
+        template <typename U>
+        struct rebind
+        {
+            typedef PoolAllocator<U> other;
+        };
+
+        SIMD_INLINE PoolAllocator()
+        {
+        }
+
+        template <typename U> SIMD_INLINE PoolAllocator(const PoolAllocator<U> & a)
+        {
+        }
+
+        SIMD_INLINE pointer allocate(size_type size, const void * ptr = NULL)
+        {
+            return static_cast<pointer>(Allocate(size*sizeof(T), Allocator<T>::Alignment()));
+        }
+
+        SIMD_INLINE void deallocate(pointer ptr, size_type size)
+        {
+            Free(ptr);
+        }
+    };
+}
+
+#endif//__SimdPoolAllocator_hpp__
@@ -151,6 +151,40 @@ namespace Simd
     }
 #endif//SIMD_SAVX2_ENABLE
 
+#ifdef SIMD_AVX512BW_INLINE_ENABLE
+    namespace Avx512bw
+    {
+        template <bool align> SIMD_INLINE void Store(__m512i * p, __m512i a);
+
+        template <> SIMD_INLINE void Store<false>(__m512i * p, __m512i a)
+        {
+            _mm512_storeu_si512(p, a);
+        }
+
+        template <> SIMD_INLINE void Store<true>(__m512i * p, __m512i a)
+        {
+            _mm512_store_si512(p, a);
+        }
+
+        SIMD_INLINE __m512i PackU16ToU8(__m512i lo, __m512i hi)
+        {
+            return _mm512_permutexvar_epi64(_mm512_setr_epi64(0, 2, 4, 6, 1, 3, 5, 7), _mm512_packus_epi16(lo, hi));
+        }
+
+        SIMD_INLINE __m512i PackI32ToI16(__m512i lo, __m512i hi)
+        {
+            return _mm512_permutexvar_epi64(_mm512_setr_epi64(0, 2, 4, 6, 1, 3, 5, 7), _mm512_packs_epi32(lo, hi));
+        }
+
+        SIMD_INLINE void Permute4x128(__m512i & lo, __m512i & hi)
+        {
+            __m512i _lo = lo;
+            lo = _mm512_permutex2var_epi64(lo, _mm512_setr_epi64(0, 1, 8, 9, 2, 3, 10, 11), hi);
+            hi = _mm512_permutex2var_epi64(_lo, _mm512_setr_epi64(4, 5, 12, 13, 6, 7, 14, 15), hi);
+        }
+    }
+#endif//SIMD_AVX512BW_INLINE_ENABLE
+
 #ifdef SIMD_VMX_ENABLE
     namespace Vmx
     {
@@ -0,0 +1,100 @@
+/*
+* Simd Library (http://simd.sourceforge.net).
+*
+* Copyright (c) 2011-2016 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdStore.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdConversion.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        SIMD_INLINE void StoreBgr(uint8_t * bgr, const __m256i * planes)
+        {
+            Store<false>((__m256i*)bgr + 0, InterleaveBgr<0>(planes[0], planes[1], planes[2]));
+            Store<false>((__m256i*)bgr + 1, InterleaveBgr<1>(planes[0], planes[1], planes[2]));
+            Store<false>((__m256i*)bgr + 2, InterleaveBgr<2>(planes[0], planes[1], planes[2]));
+        }
+
+        template <SimdPixelFormatType bayerFormat> void BayerToBgr(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, uint8_t * bgr, size_t bgrStride)
+        {
+            assert(width >= A + 4);
+
+            const uint8_t * src[6];
+            __m256i planes[6];
+            size_t lastCol = width - 2 - A;
+            for (size_t row = 0; row < height; row += 2)
+            {
+                src[0] = (row == 0 ? bayer : bayer - 2*bayerStride);
+                src[1] = src[0] + bayerStride;
+                src[2] = bayer;
+                src[3] = src[2] + bayerStride;
+                src[4] = (row == height - 2 ? bayer : bayer + 2*bayerStride);
+                src[5] = src[4] + bayerStride;
+
+                Base::BayerToBgr<bayerFormat>(src, 0, 1, 0, 1, 2, 3, bgr, bgr + 3, bgr + bgrStride, bgr + bgrStride + 3);
+
+                for (size_t col = 2; col < lastCol; col += A)
+                {
+                    BayerToBgr<bayerFormat>(src, col, planes);
+                    StoreBgr(bgr + 3*col, planes + 0);
+                    StoreBgr(bgr + bgrStride + 3*col, planes + 3);
+                }
+                BayerToBgr<bayerFormat>(src, lastCol, planes);
+                StoreBgr(bgr + 3*lastCol, planes + 0);
+                StoreBgr(bgr + bgrStride + 3*lastCol, planes + 3);
+
+                uint8_t * dst = bgr + 3*(width - 2);
+                Base::BayerToBgr<bayerFormat>(src, width - 4, width - 3, width - 2, width - 1, width - 2, width - 1, dst, dst + 3, dst + bgrStride, dst + bgrStride + 3);
+
+                bayer += 2*bayerStride;
+                bgr += 2*bgrStride;
+            }
+        }
+
+        void BayerToBgr(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride)
+        {
+            assert((width%2 == 0) && (height%2 == 0));
+
+            switch (bayerFormat)
+            {
+            case SimdPixelFormatBayerGrbg:
+                BayerToBgr<SimdPixelFormatBayerGrbg>(bayer, width, height, bayerStride, bgr, bgrStride);
+                break;
+            case SimdPixelFormatBayerGbrg:
+                BayerToBgr<SimdPixelFormatBayerGbrg>(bayer, width, height, bayerStride, bgr, bgrStride);
+                break;
+            case SimdPixelFormatBayerRggb:
+                BayerToBgr<SimdPixelFormatBayerRggb>(bayer, width, height, bayerStride, bgr, bgrStride);
+                break;
+            case SimdPixelFormatBayerBggr:
+                BayerToBgr<SimdPixelFormatBayerBggr>(bayer, width, height, bayerStride, bgr, bgrStride);
+                break;
+            default:
+                assert(0);
+            }
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
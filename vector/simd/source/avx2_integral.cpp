@@ -0,0 +1,253 @@
+/*
+* Simd Library (http://simd.sourceforge.net).
+*
+* Copyright (c) 2011-2016 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdConst.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        namespace
+        {
+            template <class T> struct Carry;
+            template <> struct Carry<uint32_t> { typedef __m256i Type; static Type Zero() { return _mm256_setzero_si256(); } };
+            template <> struct Carry<double> { typedef __m256d Type; static Type Zero() { return _mm256_setzero_pd(); } };
+        }
+
+        const __m256i K32_LAST = SIMD_MM256_SET1_EPI32(7);
+
+        SIMD_INLINE __m256i Last32(__m256i a)
+        {
+            return _mm256_permutevar8x32_epi32(a, K32_LAST);
+        }
+
+        SIMD_INLINE __m256i PrefixSum32(__m256i a)
+        {
+            a = _mm256_add_epi32(a, _mm256_slli_si256(a, 4));
+            a = _mm256_add_epi32(a, _mm256_slli_si256(a, 8));
+            __m256i last = _mm256_shuffle_epi32(a, 0xFF);
+            return _mm256_add_epi32(a, _mm256_permute2x128_si256(last, last, 0x08));
+        }
+
+        // Prefix sums of 16 pixels, within the block: each 128-bit lane does a 16-bit scan of 8 pixels
+        SIMD_INLINE void BlockSum(__m128i src, __m256i sum[2])
+        {
+            __m256i s = _mm256_cvtepu8_epi16(src);
+            s = _mm256_add_epi16(s, _mm256_slli_si256(s, 2));
+            s = _mm256_add_epi16(s, _mm256_slli_si256(s, 4));
+            s = _mm256_add_epi16(s, _mm256_slli_si256(s, 8));
+            sum[0] = _mm256_cvtepu16_epi32(_mm256_castsi256_si128(s));
+            sum[1] = _mm256_add_epi32(_mm256_cvtepu16_epi32(_mm256_extracti128_si256(s, 1)), Last32(sum[0]));
+        }
+
+        // Prefix sums of the squares of 16 pixels, within the block
+        SIMD_INLINE void BlockSqsum(__m128i src, __m256i sqsum[2])
+        {
+            __m256i s = _mm256_cvtepu8_epi16(src);
+            s = _mm256_mullo_epi16(s, s);
+            sqsum[0] = PrefixSum32(_mm256_cvtepu16_epi32(_mm256_castsi256_si128(s)));
+            sqsum[1] = _mm256_add_epi32(PrefixSum32(_mm256_cvtepu16_epi32(_mm256_extracti128_si256(s, 1))), Last32(sqsum[0]));
+        }
+
+        SIMD_INLINE void StoreSum(uint32_t * dst, const uint32_t * above, __m256i local, __m256i carry)
+        {
+            __m256i value = _mm256_add_epi32(_mm256_add_epi32(local, carry), _mm256_loadu_si256((__m256i*)above));
+            _mm256_storeu_si256((__m256i*)dst, value);
+        }
+
+        SIMD_INLINE void StoreSum(double * dst, const double * above, __m256i local, __m256d carry)
+        {
+            __m256d lo = _mm256_add_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(local)), carry);
+            __m256d hi = _mm256_add_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(local, 1)), carry);
+            _mm256_storeu_pd(dst + 0, _mm256_add_pd(lo, _mm256_loadu_pd(above + 0)));
+            _mm256_storeu_pd(dst + 4, _mm256_add_pd(hi, _mm256_loadu_pd(above + 4)));
+        }
+
+        SIMD_INLINE void UpdateCarry(__m256i & carry, __m256i local)
+        {
+            carry = _mm256_add_epi32(carry, Last32(local));
+        }
+
+        SIMD_INLINE void UpdateCarry(__m256d & carry, __m256i local)
+        {
+            carry = _mm256_add_pd(carry, _mm256_cvtepi32_pd(_mm256_castsi256_si128(Last32(local))));
+        }
+
+        SIMD_INLINE uint32_t ExtractCarry(__m256i carry)
+        {
+            return _mm_cvtsi128_si32(_mm256_castsi256_si128(carry));
+        }
+
+        SIMD_INLINE double ExtractCarry(__m256d carry)
+        {
+            return _mm256_cvtsd_f64(carry);
+        }
+
+        template <bool sqsumEnable, class TSqsum> void IntegralRow(const uint8_t * src, size_t width,
+            uint32_t * sum, const uint32_t * sumAbove, TSqsum * sqsum, const TSqsum * sqsumAbove)
+        {
+            size_t alignedWidth = AlignLo(width, HA);
+            __m256i sumCarry = _mm256_setzero_si256();
+            typename Carry<TSqsum>::Type sqsumCarry = Carry<TSqsum>::Zero();
+            __m256i local[2];
+            size_t col = 0;
+            for (; col < alignedWidth; col += HA)
+            {
+                __m128i _src = _mm_loadu_si128((__m128i*)(src + col));
+                BlockSum(_src, local);
+                StoreSum(sum + col + 0, sumAbove + col + 0, local[0], sumCarry);
+                StoreSum(sum + col + 8, sumAbove + col + 8, local[1], sumCarry);
+                UpdateCarry(sumCarry, local[1]);
+                if (sqsumEnable)
+                {
+                    BlockSqsum(_src, local);
+                    StoreSum(sqsum + col + 0, sqsumAbove + col + 0, local[0], sqsumCarry);
+                    StoreSum(sqsum + col + 8, sqsumAbove + col + 8, local[1], sqsumCarry);
+                    UpdateCarry(sqsumCarry, local[1]);
+                }
+            }
+            uint32_t rowSum = ExtractCarry(sumCarry);
+            TSqsum rowSqsum = sqsumEnable ? ExtractCarry(sqsumCarry) : 0;
+            for (; col < width; ++col)
+            {
+                uint32_t value = src[col];
+                rowSum += value;
+                sum[col] = rowSum + sumAbove[col];
+                if (sqsumEnable)
+                {
+                    rowSqsum += value*value;
+                    sqsum[col] = rowSqsum + sqsumAbove[col];
+                }
+            }
+        }
+
+        // See Sse2::IntegralTiltedRow for the recurrence
+        SIMD_INLINE void TiltedBlock(__m256i _src, uint32_t * buffer, uint32_t * tilted, const uint32_t * tiltedAbove)
+        {
+            __m256i b0 = _mm256_loadu_si256((__m256i*)buffer);
+            __m256i b1 = _mm256_loadu_si256((__m256i*)(buffer + 1));
+            __m256i t = _mm256_add_epi32(_mm256_add_epi32(b0, b1), _mm256_add_epi32(_src, _mm256_loadu_si256((__m256i*)(tiltedAbove - 1))));
+            _mm256_storeu_si256((__m256i*)buffer, _mm256_add_epi32(b1, _src));
+            _mm256_storeu_si256((__m256i*)tilted, t);
+        }
+
+        void IntegralTiltedRow(const uint8_t * src, size_t width, uint32_t * buffer, uint32_t * tilted, const uint32_t * tiltedAbove)
+        {
+            size_t alignedWidth = AlignLo(width, HA);
+            uint32_t first = tiltedAbove[0] + src[0] + buffer[1];
+            size_t col = 0;
+            for (; col < alignedWidth; col += HA)
+            {
+                __m128i _src = _mm_loadu_si128((__m128i*)(src + col));
+                TiltedBlock(_mm256_cvtepu8_epi32(_src), buffer + col + 0, tilted + col + 0, tiltedAbove + col + 0);
+                TiltedBlock(_mm256_cvtepu8_epi32(_mm_srli_si128(_src, 8)), buffer + col + 8, tilted + col + 8, tiltedAbove + col + 8);
+            }
+            for (; col < width; ++col)
+            {
+                uint32_t b1 = buffer[col + 1];
+                tilted[col] = buffer[col] + b1 + src[col] + tiltedAbove[col - 1];
+                buffer[col] = b1 + src[col];
+            }
+            tilted[0] = first;
+        }
+
+        template <bool sqsumEnable, class TSqsum> void Integral(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+            uint32_t * sum, size_t sumStride, TSqsum * sqsum, size_t sqsumStride, uint32_t * tilted, size_t tiltedStride)
+        {
+            memset(sum, 0, (width + 1)*sizeof(uint32_t));
+            sum += sumStride + 1;
+            if (sqsumEnable)
+            {
+                memset(sqsum, 0, (width + 1)*sizeof(TSqsum));
+                sqsum += sqsumStride + 1;
+            }
+            uint32_t * buffer = NULL;
+            if (tilted)
+            {
+                memset(tilted, 0, (width + 1)*sizeof(uint32_t));
+                tilted += tiltedStride + 1;
+                buffer = (uint32_t*)Allocate((width + 1)*sizeof(uint32_t));
+                buffer[width] = 0;
+            }
+
+            for (size_t row = 0; row < height; ++row)
+            {
+                sum[-1] = 0;
+                if (sqsumEnable)
+                    sqsum[-1] = 0;
+                IntegralRow<sqsumEnable>(src, width, sum, sum - sumStride, sqsum, sqsumEnable ? sqsum - sqsumStride : NULL);
+                if (tilted)
+                {
+                    tilted[-1] = row ? tilted[-tiltedStride] : 0;
+                    if (row)
+                        IntegralTiltedRow(src, width, buffer, tilted, tilted - tiltedStride);
+                    else
+                    {
+                        for (size_t col = 0; col < width; ++col)
+                            tilted[col] = buffer[col] = src[col];
+                    }
+                    tilted += tiltedStride;
+                }
+                src += srcStride;
+                sum += sumStride;
+                if (sqsumEnable)
+                    sqsum += sqsumStride;
+            }
+
+            if (buffer)
+                Free(buffer);
+        }
+
+        void Integral(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+            uint8_t * sum, size_t sumStride, uint8_t * sqsum, size_t sqsumStride, uint8_t * tilted, size_t tiltedStride,
+            SimdPixelFormatType sumFormat, SimdPixelFormatType sqsumFormat)
+        {
+            assert(sumFormat == SimdPixelFormatInt32 && sumStride%sizeof(uint32_t) == 0);
+            if (tilted)
+                assert(tiltedStride%sizeof(uint32_t) == 0);
+
+            if (sqsum)
+            {
+                switch (sqsumFormat)
+                {
+                case SimdPixelFormatInt32:
+                    Integral<true, uint32_t>(src, srcStride, width, height, (uint32_t*)sum, sumStride/sizeof(uint32_t),
+                        (uint32_t*)sqsum, sqsumStride/sizeof(uint32_t), (uint32_t*)tilted, tiltedStride/sizeof(uint32_t));
+                    break;
+                case SimdPixelFormatDouble:
+                    Integral<true, double>(src, srcStride, width, height, (uint32_t*)sum, sumStride/sizeof(uint32_t),
+                        (double*)sqsum, sqsumStride/sizeof(double), (uint32_t*)tilted, tiltedStride/sizeof(uint32_t));
+                    break;
+                default:
+                    assert(0);
+                }
+            }
+            else
+                Integral<false, uint32_t>(src, srcStride, width, height, (uint32_t*)sum, sumStride/sizeof(uint32_t),
+                    NULL, 0, (uint32_t*)tilted, tiltedStride/sizeof(uint32_t));
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
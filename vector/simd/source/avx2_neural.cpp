@@ -144,6 +144,69 @@ namespace Simd
                 NeuralProductSum<false>(a, b, size, sum);
         }
 
+        template <size_t M, size_t N> SIMD_INLINE void NeuralProductSums(const float * a, size_t aStride, const float * b, size_t bStride, size_t size, float * sums, size_t sumsStride)
+        {
+            size_t aligned = AlignLo(size, F);
+            __m256 _sums[M][N], _a, _b[N];
+            for (size_t m = 0; m < M; ++m)
+                for (size_t n = 0; n < N; ++n)
+                    _sums[m][n] = _mm256_setzero_ps();
+            for (size_t i = 0; i < aligned; i += F)
+            {
+                for (size_t n = 0; n < N; ++n)
+                    _b[n] = Load<false>(b + n*bStride + i);
+                for (size_t m = 0; m < M; ++m)
+                {
+                    _a = Load<false>(a + m*aStride + i);
+                    for (size_t n = 0; n < N; ++n)
+                        _sums[m][n] = _mm256_fmadd_ps(_a, _b[n], _sums[m][n]);
+                }
+            }
+            if (aligned < size)
+            {
+                size_t i = size - F;
+                __m256 tailMask = RightNotZero(size - aligned);
+                for (size_t n = 0; n < N; ++n)
+                    _b[n] = _mm256_and_ps(tailMask, Load<false>(b + n*bStride + i));
+                for (size_t m = 0; m < M; ++m)
+                {
+                    _a = Load<false>(a + m*aStride + i);
+                    for (size_t n = 0; n < N; ++n)
+                        _sums[m][n] = _mm256_fmadd_ps(_a, _b[n], _sums[m][n]);
+                }
+            }
+            for (size_t m = 0; m < M; ++m)
+                for (size_t n = 0; n < N; ++n)
+                    sums[m*sumsStride + n] = Avx::ExtractSum(_sums[m][n]);
+        }
+
+        template <size_t M, size_t N> void NeuralProductSums(const float * a, size_t aStride, size_t aCount, const float * b, size_t bStride, size_t size, float * sums, size_t sumsStride)
+        {
+            size_t i = 0;
+            for (; i + M <= aCount; i += M)
+                NeuralProductSums<M, N>(a + i*aStride, aStride, b, bStride, size, sums + i*sumsStride, sumsStride);
+            for (; i < aCount; ++i)
+                NeuralProductSums<1, N>(a + i*aStride, aStride, b, bStride, size, sums + i*sumsStride, sumsStride);
+        }
+
+        void NeuralProductSumBatch(const float * a, size_t aStride, size_t aCount, const float * b, size_t bStride, size_t bCount, size_t size, float * sums)
+        {
+            assert(size >= F);
+
+            size_t rowsBlock = Simd::Max<size_t>(L2_CACHE_SIZE/2/(size*sizeof(float)), 1);
+            for (size_t i = 0; i < aCount; i += rowsBlock)
+            {
+                size_t rows = Simd::Min(rowsBlock, aCount - i);
+                size_t j = 0;
+                for (; j + 3 <= bCount; j += 3)
+                    NeuralProductSums<4, 3>(a + i*aStride, aStride, rows, b + j*bStride, bStride, size, sums + i*bCount + j, bCount);
+                if (bCount - j == 2)
+                    NeuralProductSums<4, 2>(a + i*aStride, aStride, rows, b + j*bStride, bStride, size, sums + i*bCount + j, bCount);
+                if (bCount - j == 1)
+                    NeuralProductSums<8, 1>(a + i*aStride, aStride, rows, b + j*bStride, bStride, size, sums + i*bCount + j, bCount);
+            }
+        }
+
         template <bool align> SIMD_INLINE void AddMultiplied(const float * src, const __m256 & value, float * dst)
         {
             Avx::Store<align>(dst, _mm256_fmadd_ps(value, Load<align>(src), Load<align>(dst)));
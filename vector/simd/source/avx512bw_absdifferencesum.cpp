@@ -0,0 +1,121 @@
+/*
+* Simd Library (http://simd.sourceforge.net).
+*
+* Copyright (c) 2011-2016 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdLoad.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdExtract.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    namespace Avx512bw
+    {
+        template <bool align> void AbsDifferenceSum(
+            const uint8_t *a, size_t aStride, const uint8_t *b, size_t bStride,
+            size_t width, size_t height, uint64_t * sum)
+        {
+            assert(width >= A);
+            if(align)
+                assert(Aligned(a) && Aligned(aStride) && Aligned(b) && Aligned(bStride));
+
+            size_t bodyWidth = AlignLo(width, A);
+            __mmask64 tailMask = __mmask64(-1) >> (A + bodyWidth - width);
+            __m512i fullSum = _mm512_setzero_si512();
+            for(size_t row = 0; row < height; ++row)
+            {
+                for(size_t col = 0; col < bodyWidth; col += A)
+                {
+                    const __m512i a_ = Load<align>((__m512i*)(a + col));
+                    const __m512i b_ = Load<align>((__m512i*)(b + col));
+                    fullSum = _mm512_add_epi64(_mm512_sad_epu8(a_, b_), fullSum);
+                }
+                if(width - bodyWidth)
+                {
+                    const __m512i a_ = _mm512_maskz_loadu_epi8(tailMask, a + bodyWidth);
+                    const __m512i b_ = _mm512_maskz_loadu_epi8(tailMask, b + bodyWidth);
+                    fullSum = _mm512_add_epi64(_mm512_sad_epu8(a_, b_), fullSum);
+                }
+                a += aStride;
+                b += bStride;
+            }
+            *sum = ExtractSum<uint64_t>(fullSum);
+        }
+
+        template <bool align> void AbsDifferenceSumMasked(
+            const uint8_t *a, size_t aStride, const uint8_t *b, size_t bStride,
+            const uint8_t *mask, size_t maskStride, uint8_t index, size_t width, size_t height, uint64_t * sum)
+        {
+            assert(width >= A);
+            if(align)
+            {
+                assert(Aligned(a) && Aligned(aStride) && Aligned(b) && Aligned(bStride));
+                assert(Aligned(mask) && Aligned(maskStride));
+            }
+
+            size_t bodyWidth = AlignLo(width, A);
+            __mmask64 tailMask = __mmask64(-1) >> (A + bodyWidth - width);
+            __m512i fullSum = _mm512_setzero_si512();
+            __m512i index_ = _mm512_set1_epi8(index);
+            for(size_t row = 0; row < height; ++row)
+            {
+                for(size_t col = 0; col < bodyWidth; col += A)
+                {
+                    const __mmask64 mask_ = _mm512_cmpeq_epi8_mask(Load<align>((__m512i*)(mask + col)), index_);
+                    const __m512i a_ = _mm512_maskz_mov_epi8(mask_, Load<align>((__m512i*)(a + col)));
+                    const __m512i b_ = _mm512_maskz_mov_epi8(mask_, Load<align>((__m512i*)(b + col)));
+                    fullSum = _mm512_add_epi64(_mm512_sad_epu8(a_, b_), fullSum);
+                }
+                if(width - bodyWidth)
+                {
+                    const __mmask64 mask_ = _mm512_mask_cmpeq_epi8_mask(tailMask, _mm512_maskz_loadu_epi8(tailMask, mask + bodyWidth), index_);
+                    const __m512i a_ = _mm512_maskz_loadu_epi8(mask_, a + bodyWidth);
+                    const __m512i b_ = _mm512_maskz_loadu_epi8(mask_, b + bodyWidth);
+                    fullSum = _mm512_add_epi64(_mm512_sad_epu8(a_, b_), fullSum);
+                }
+                a += aStride;
+                b += bStride;
+                mask += maskStride;
+            }
+            *sum = ExtractSum<uint64_t>(fullSum);
+        }
+
+        void AbsDifferenceSum(const uint8_t *a, size_t aStride, const uint8_t *b, size_t bStride,
+            size_t width, size_t height, uint64_t * sum)
+        {
+            if(Aligned(a) && Aligned(aStride) && Aligned(b) && Aligned(bStride))
+                AbsDifferenceSum<true>(a, aStride, b, bStride, width, height, sum);
+            else
+                AbsDifferenceSum<false>(a, aStride, b, bStride, width, height, sum);
+        }
+
+        void AbsDifferenceSumMasked(const uint8_t *a, size_t aStride, const uint8_t *b, size_t bStride,
+            const uint8_t *mask, size_t maskStride, uint8_t index, size_t width, size_t height, uint64_t * sum)
+        {
+            if(Aligned(a) && Aligned(aStride) && Aligned(b) && Aligned(bStride) && Aligned(mask) && Aligned(maskStride))
+                AbsDifferenceSumMasked<true>(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
+            else
+                AbsDifferenceSumMasked<false>(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
+        }
+    }
+#endif// SIMD_AVX512BW_ENABLE
+}
@@ -0,0 +1,95 @@
+/*
+* Simd Library (http://simd.sourceforge.net).
+*
+* Copyright (c) 2011-2016 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdExtract.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        template <size_t M, size_t N> SIMD_INLINE void NeuralProductSums(const float * a, size_t aStride, const float * b, size_t bStride, size_t size, float * sums, size_t sumsStride)
+        {
+            size_t aligned = AlignLo(size, F);
+            __m512 _sums[M][N], _a, _b[N];
+            for (size_t m = 0; m < M; ++m)
+                for (size_t n = 0; n < N; ++n)
+                    _sums[m][n] = _mm512_setzero_ps();
+            for (size_t i = 0; i < aligned; i += F)
+            {
+                for (size_t n = 0; n < N; ++n)
+                    _b[n] = _mm512_loadu_ps(b + n*bStride + i);
+                for (size_t m = 0; m < M; ++m)
+                {
+                    _a = _mm512_loadu_ps(a + m*aStride + i);
+                    for (size_t n = 0; n < N; ++n)
+                        _sums[m][n] = _mm512_fmadd_ps(_a, _b[n], _sums[m][n]);
+                }
+            }
+            if (aligned < size)
+            {
+                __mmask16 tailMask = __mmask16(-1) >> (F + aligned - size);
+                for (size_t n = 0; n < N; ++n)
+                    _b[n] = _mm512_maskz_loadu_ps(tailMask, b + n*bStride + aligned);
+                for (size_t m = 0; m < M; ++m)
+                {
+                    _a = _mm512_maskz_loadu_ps(tailMask, a + m*aStride + aligned);
+                    for (size_t n = 0; n < N; ++n)
+                        _sums[m][n] = _mm512_fmadd_ps(_a, _b[n], _sums[m][n]);
+                }
+            }
+            for (size_t m = 0; m < M; ++m)
+                for (size_t n = 0; n < N; ++n)
+                    sums[m*sumsStride + n] = ExtractSum(_sums[m][n]);
+        }
+
+        template <size_t M, size_t N> void NeuralProductSums(const float * a, size_t aStride, size_t aCount, const float * b, size_t bStride, size_t size, float * sums, size_t sumsStride)
+        {
+            size_t i = 0;
+            for (; i + M <= aCount; i += M)
+                NeuralProductSums<M, N>(a + i*aStride, aStride, b, bStride, size, sums + i*sumsStride, sumsStride);
+            for (; i < aCount; ++i)
+                NeuralProductSums<1, N>(a + i*aStride, aStride, b, bStride, size, sums + i*sumsStride, sumsStride);
+        }
+
+        void NeuralProductSumBatch(const float * a, size_t aStride, size_t aCount, const float * b, size_t bStride, size_t bCount, size_t size, float * sums)
+        {
+            size_t rowsBlock = Simd::Max<size_t>(L2_CACHE_SIZE/2/(size*sizeof(float) + 1), 1);
+            for (size_t i = 0; i < aCount; i += rowsBlock)
+            {
+                size_t rows = Simd::Min(rowsBlock, aCount - i);
+                size_t j = 0;
+                for (; j + 4 <= bCount; j += 4)
+                    NeuralProductSums<6, 4>(a + i*aStride, aStride, rows, b + j*bStride, bStride, size, sums + i*bCount + j, bCount);
+                if (bCount - j == 3)
+                    NeuralProductSums<6, 3>(a + i*aStride, aStride, rows, b + j*bStride, bStride, size, sums + i*bCount + j, bCount);
+                if (bCount - j == 2)
+                    NeuralProductSums<8, 2>(a + i*aStride, aStride, rows, b + j*bStride, bStride, size, sums + i*bCount + j, bCount);
+                if (bCount - j == 1)
+                    NeuralProductSums<8, 1>(a + i*aStride, aStride, rows, b + j*bStride, bStride, size, sums + i*bCount + j, bCount);
+            }
+        }
+    }
+#endif// SIMD_AVX512BW_ENABLE
+}
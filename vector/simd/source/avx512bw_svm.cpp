@@ -0,0 +1,62 @@
+/*
+* Simd Library (http://simd.sourceforge.net).
+*
+* Copyright (c) 2011-2016 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdAvx512bw.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        namespace
+        {
+            struct Buffer
+            {
+                Buffer(size_t count)
+                {
+                    size_t size = sizeof(float)*count;
+                    _p = Allocate(size);
+                    sums = (float*)_p;
+                }
+
+                ~Buffer()
+                {
+                    Free(_p);
+                }
+
+                float * sums;
+            private:
+                void *_p;
+            };
+        }
+
+        void SvmSumLinearBatch(const float * x, size_t xStride, size_t xCount, const float * svs, const float * weights, size_t length, size_t count, float * sums)
+        {
+            Buffer hyperplane(length);
+            NeuralProductSumBatch(svs, count, length, weights, count, 1, count, hyperplane.sums);
+            NeuralProductSumBatch(x, xStride, xCount, hyperplane.sums, length, 1, length, sums);
+        }
+    }
+#endif// SIMD_AVX512BW_ENABLE
+}
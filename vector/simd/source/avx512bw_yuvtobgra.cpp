@@ -0,0 +1,197 @@
+/*
+* Simd Library (http://simd.sourceforge.net).
+*
+* Copyright (c) 2011-2016 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdConversion.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    namespace Avx512bw
+    {
+        template <bool align> SIMD_INLINE void AdjustedYuv16ToBgra(__m512i y16, __m512i u16, __m512i v16,
+            const __m512i & a_0, __m512i * bgra)
+        {
+            __m512i bgra0, bgra1;
+            AdjustedYuv16ToBgra(y16, u16, v16, a_0, bgra0, bgra1);
+            Store<align>(bgra + 0, bgra0);
+            Store<align>(bgra + 1, bgra1);
+        }
+
+        template <bool align> SIMD_INLINE void Yuv16ToBgra(__m512i y16, __m512i u16, __m512i v16,
+            const __m512i & a_0, __m512i * bgra)
+        {
+            AdjustedYuv16ToBgra<align>(AdjustY16(y16), AdjustUV16(u16), AdjustUV16(v16), a_0, bgra);
+        }
+
+        template <bool align> SIMD_INLINE void Yuv444pToBgra(const uint8_t * y, const uint8_t * u,
+            const uint8_t * v, const __m512i & a_0, uint8_t * bgra)
+        {
+            __m512i y8 = Load<align>((__m512i*)y);
+            __m512i u8 = Load<align>((__m512i*)u);
+            __m512i v8 = Load<align>((__m512i*)v);
+            Yuv16ToBgra<align>(ExtendU8ToU16<0>(y8), ExtendU8ToU16<0>(u8), ExtendU8ToU16<0>(v8), a_0, (__m512i*)bgra + 0);
+            Yuv16ToBgra<align>(ExtendU8ToU16<1>(y8), ExtendU8ToU16<1>(u8), ExtendU8ToU16<1>(v8), a_0, (__m512i*)bgra + 2);
+        }
+
+        template <bool align> void Yuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            assert(width >= A);
+            if(align)
+            {
+                assert(Aligned(y) && Aligned(yStride) && Aligned(u) &&  Aligned(uStride));
+                assert(Aligned(v) && Aligned(vStride) && Aligned(bgra) && Aligned(bgraStride));
+            }
+
+            __m512i a_0 = _mm512_slli_epi16(_mm512_set1_epi16(alpha), 8);
+            size_t bodyWidth = AlignLo(width, A);
+            size_t tail = width - bodyWidth;
+            for(size_t row = 0; row < height; ++row)
+            {
+                for(size_t colYuv = 0, colBgra = 0; colYuv < bodyWidth; colYuv += A, colBgra += QA)
+                {
+                    Yuv444pToBgra<align>(y + colYuv, u + colYuv, v + colYuv, a_0, bgra + colBgra);
+                }
+                if(tail)
+                {
+                    size_t col = width - A;
+                    Yuv444pToBgra<false>(y + col, u + col, v + col, a_0, bgra + 4*col);
+                }
+                y += yStride;
+                u += uStride;
+                v += vStride;
+                bgra += bgraStride;
+            }
+        }
+
+        void Yuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            if(Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
+                && Aligned(v) && Aligned(vStride) && Aligned(bgra) && Aligned(bgraStride))
+                Yuv444pToBgra<true>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+            else
+                Yuv444pToBgra<false>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+        }
+
+        template <bool align> SIMD_INLINE void Yuv422pToBgra(const uint8_t * y, const __m512i & u, const __m512i & v,
+            const __m512i & a_0, uint8_t * bgra)
+        {
+            __m512i y0 = Load<align>((__m512i*)y + 0);
+            __m512i y1 = Load<align>((__m512i*)y + 1);
+            Yuv16ToBgra<align>(ExtendU8ToU16<0>(y0), DuplicateU8ToU16<0>(u), DuplicateU8ToU16<0>(v), a_0, (__m512i*)bgra + 0);
+            Yuv16ToBgra<align>(ExtendU8ToU16<1>(y0), DuplicateU8ToU16<1>(u), DuplicateU8ToU16<1>(v), a_0, (__m512i*)bgra + 2);
+            Yuv16ToBgra<align>(ExtendU8ToU16<0>(y1), DuplicateU8ToU16<2>(u), DuplicateU8ToU16<2>(v), a_0, (__m512i*)bgra + 4);
+            Yuv16ToBgra<align>(ExtendU8ToU16<1>(y1), DuplicateU8ToU16<3>(u), DuplicateU8ToU16<3>(v), a_0, (__m512i*)bgra + 6);
+        }
+
+        template <bool align> void Yuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            assert((width%2 == 0) && (height%2 == 0) && (width >= DA) && (height >= 2));
+            if(align)
+            {
+                assert(Aligned(y) && Aligned(yStride) && Aligned(u) &&  Aligned(uStride));
+                assert(Aligned(v) && Aligned(vStride) && Aligned(bgra) && Aligned(bgraStride));
+            }
+
+            __m512i a_0 = _mm512_slli_epi16(_mm512_set1_epi16(alpha), 8);
+            size_t bodyWidth = AlignLo(width, DA);
+            size_t tail = width - bodyWidth;
+            for(size_t row = 0; row < height; row += 2)
+            {
+                for(size_t colUV = 0, colY = 0, colBgra = 0; colY < bodyWidth; colY += DA, colUV += A, colBgra += OA)
+                {
+                    __m512i u_ = Load<align>((__m512i*)(u + colUV));
+                    __m512i v_ = Load<align>((__m512i*)(v + colUV));
+                    Yuv422pToBgra<align>(y + colY, u_, v_, a_0, bgra + colBgra);
+                    Yuv422pToBgra<align>(y + colY + yStride, u_, v_, a_0, bgra + colBgra + bgraStride);
+                }
+                if(tail)
+                {
+                    size_t offset = width - DA;
+                    __m512i u_ = Load<false>((__m512i*)(u + offset/2));
+                    __m512i v_ = Load<false>((__m512i*)(v + offset/2));
+                    Yuv422pToBgra<false>(y + offset, u_, v_, a_0, bgra + 4*offset);
+                    Yuv422pToBgra<false>(y + offset + yStride, u_, v_, a_0, bgra + 4*offset + bgraStride);
+                }
+                y += 2*yStride;
+                u += uStride;
+                v += vStride;
+                bgra += 2*bgraStride;
+            }
+        }
+
+        void Yuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            if(Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
+                && Aligned(v) && Aligned(vStride) && Aligned(bgra) && Aligned(bgraStride))
+                Yuv420pToBgra<true>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+            else
+                Yuv420pToBgra<false>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+        }
+
+        template <bool align> void Yuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            assert((width%2 == 0) && (width >= DA));
+            if(align)
+            {
+                assert(Aligned(y) && Aligned(yStride) && Aligned(u) &&  Aligned(uStride));
+                assert(Aligned(v) && Aligned(vStride) && Aligned(bgra) && Aligned(bgraStride));
+            }
+
+            __m512i a_0 = _mm512_slli_epi16(_mm512_set1_epi16(alpha), 8);
+            size_t bodyWidth = AlignLo(width, DA);
+            size_t tail = width - bodyWidth;
+            for(size_t row = 0; row < height; ++row)
+            {
+                for(size_t colUV = 0, colY = 0, colBgra = 0; colY < bodyWidth; colY += DA, colUV += A, colBgra += OA)
+                    Yuv422pToBgra<align>(y + colY, Load<align>((__m512i*)(u + colUV)), Load<align>((__m512i*)(v + colUV)), a_0, bgra + colBgra);
+                if(tail)
+                {
+                    size_t offset = width - DA;
+                    Yuv422pToBgra<false>(y + offset, Load<false>((__m512i*)(u + offset/2)), Load<false>((__m512i*)(v + offset/2)), a_0, bgra + 4*offset);
+                }
+                y += yStride;
+                u += uStride;
+                v += vStride;
+                bgra += bgraStride;
+            }
+        }
+
+        void Yuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            if(Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
+                && Aligned(v) && Aligned(vStride) && Aligned(bgra) && Aligned(bgraStride))
+                Yuv422pToBgra<true>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+            else
+                Yuv422pToBgra<false>(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+        }
+    }
+#endif// SIMD_AVX512BW_ENABLE
+}
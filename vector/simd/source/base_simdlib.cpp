@@ -50,6 +50,7 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD dwReasonForCall, LPVOID lpReserved)
 #include "Simd/SimdEnable.h"
 #include "Simd/SimdVersion.h"
 #include "Simd/SimdConst.h"
+#include "Simd/SimdParallel.hpp"
 
 #include "Simd/SimdBase.h"
 // #include "Simd/SimdSse1.h"
@@ -91,6 +92,16 @@ SIMD_API size_t SimdAlignment()
     return Simd::ALIGNMENT;
 }
 
+SIMD_API void SimdSetThreadNumber(size_t threadNumber)
+{
+    ThreadNumber() = std::max<size_t>(std::min(threadNumber, ThreadPool::Global().Size()), 1);
+}
+
+SIMD_API size_t SimdGetThreadNumber()
+{
+    return ThreadNumber();
+}
+
 SIMD_API uint32_t SimdCrc32c(const void * src, size_t size)
 {
         return Base::Crc32c(src, size);
@@ -489,6 +500,10 @@ SIMD_API void SimdFillBgra(uint8_t * dst, size_t stride, size_t width, size_t he
 SIMD_API void SimdGaussianBlur3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                      size_t channelCount, uint8_t * dst, size_t dstStride)
 {
+    if(ParallelRows(src, srcStride, height, dst, dstStride, channelCount*width, 1, [=](const uint8_t * s, size_t h, uint8_t * d, size_t ds)
+        { SimdGaussianBlur3x3(s, srcStride, width, h, channelCount, d, ds); }))
+        return;
+
 		Base::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
 }
 
@@ -588,11 +603,19 @@ SIMD_API void SimdInterleaveBgra(const uint8_t * b, size_t bStride, const uint8_
 
 SIMD_API void SimdLaplace(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
+    if(ParallelRows(src, srcStride, height, dst, dstStride, 2*width, 1, [=](const uint8_t * s, size_t h, uint8_t * d, size_t ds)
+        { SimdLaplace(s, srcStride, width, h, d, ds); }))
+        return;
+
         Base::Laplace(src, srcStride, width, height, dst, dstStride);
 }
 
 SIMD_API void SimdLaplaceAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
+    if(ParallelRows(src, srcStride, height, dst, dstStride, 2*width, 1, [=](const uint8_t * s, size_t h, uint8_t * d, size_t ds)
+        { SimdLaplaceAbs(s, srcStride, width, h, d, ds); }))
+        return;
+
         Base::LaplaceAbs(src, srcStride, width, height, dst, dstStride);
 }
 
@@ -608,26 +631,46 @@ SIMD_API void SimdLbpEstimate(const uint8_t * src, size_t srcStride, size_t widt
 
 SIMD_API void SimdMeanFilter3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
+    if(ParallelRows(src, srcStride, height, dst, dstStride, channelCount*width, 1, [=](const uint8_t * s, size_t h, uint8_t * d, size_t ds)
+        { SimdMeanFilter3x3(s, srcStride, width, h, channelCount, d, ds); }))
+        return;
+
 		Base::MeanFilter3x3(src, srcStride, width, height, channelCount, dst, dstStride);
 }
 
 SIMD_API void SimdMedianFilterRhomb3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
+    if(ParallelRows(src, srcStride, height, dst, dstStride, channelCount*width, 1, [=](const uint8_t * s, size_t h, uint8_t * d, size_t ds)
+        { SimdMedianFilterRhomb3x3(s, srcStride, width, h, channelCount, d, ds); }))
+        return;
+
         Base::MedianFilterRhomb3x3(src, srcStride, width, height, channelCount, dst, dstStride);
 }
 
 SIMD_API void SimdMedianFilterRhomb5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
+    if(ParallelRows(src, srcStride, height, dst, dstStride, channelCount*width, 2, [=](const uint8_t * s, size_t h, uint8_t * d, size_t ds)
+        { SimdMedianFilterRhomb5x5(s, srcStride, width, h, channelCount, d, ds); }))
+        return;
+
         Base::MedianFilterRhomb5x5(src, srcStride, width, height, channelCount, dst, dstStride);
 }
 
 SIMD_API void SimdMedianFilterSquare3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
+    if(ParallelRows(src, srcStride, height, dst, dstStride, channelCount*width, 1, [=](const uint8_t * s, size_t h, uint8_t * d, size_t ds)
+        { SimdMedianFilterSquare3x3(s, srcStride, width, h, channelCount, d, ds); }))
+        return;
+
         Base::MedianFilterSquare3x3(src, srcStride, width, height, channelCount, dst, dstStride);
 }
 
 SIMD_API void SimdMedianFilterSquare5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
+    if(ParallelRows(src, srcStride, height, dst, dstStride, channelCount*width, 2, [=](const uint8_t * s, size_t h, uint8_t * d, size_t ds)
+        { SimdMedianFilterSquare5x5(s, srcStride, width, h, channelCount, d, ds); }))
+        return;
+
         Base::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
 }
 
@@ -644,6 +687,15 @@ SIMD_API void SimdNeuralProductSum(const float * a, const float * b, size_t size
   Base::NeuralProductSum(a, b, size, sum);
 }
 
+SIMD_API void SimdNeuralProductSumBatch(const float * a, size_t aStride, size_t aCount, const float * b, size_t bStride, size_t bCount, size_t size, float * sums)
+{
+    if(ParallelRange(aCount, std::max<size_t>(8, 0x10000/(bCount*size + 1)), [=](size_t begin, size_t end)
+        { SimdNeuralProductSumBatch(a + begin*aStride, aStride, end - begin, b, bStride, bCount, size, sums + begin*bCount); }))
+        return;
+
+        Base::NeuralProductSumBatch(a, aStride, aCount, b, bStride, bCount, size, sums);
+}
+
 //typedef void(*SimdNeuralAddVectorMultipliedByValuePtr) (const float * src, size_t size, const float * value, float * dst);
 //SimdNeuralAddVectorMultipliedByValuePtr simdNeuralAddVectorMultipliedByValue = SIMD_FUNC4(NeuralAddVectorMultipliedByValue, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
@@ -877,11 +929,19 @@ SIMD_API void SimdShiftBilinear(const uint8_t * src, size_t srcStride, size_t wi
 
 SIMD_API void SimdSobelDx(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
+    if(ParallelRows(src, srcStride, height, dst, dstStride, 2*width, 1, [=](const uint8_t * s, size_t h, uint8_t * d, size_t ds)
+        { SimdSobelDx(s, srcStride, width, h, d, ds); }))
+        return;
+
         Base::SobelDx(src, srcStride, width, height, dst, dstStride);
 }
 
 SIMD_API void SimdSobelDxAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
+    if(ParallelRows(src, srcStride, height, dst, dstStride, 2*width, 1, [=](const uint8_t * s, size_t h, uint8_t * d, size_t ds)
+        { SimdSobelDxAbs(s, srcStride, width, h, d, ds); }))
+        return;
+
         Base::SobelDxAbs(src, srcStride, width, height, dst, dstStride);
 }
 
@@ -892,11 +952,19 @@ SIMD_API void SimdSobelDxAbsSum(const uint8_t * src, size_t stride, size_t width
 
 SIMD_API void SimdSobelDy(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
+    if(ParallelRows(src, srcStride, height, dst, dstStride, 2*width, 1, [=](const uint8_t * s, size_t h, uint8_t * d, size_t ds)
+        { SimdSobelDy(s, srcStride, width, h, d, ds); }))
+        return;
+
 		Base::SobelDy(src, srcStride, width, height, dst, dstStride);
 }
 
 SIMD_API void SimdSobelDyAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
+    if(ParallelRows(src, srcStride, height, dst, dstStride, 2*width, 1, [=](const uint8_t * s, size_t h, uint8_t * d, size_t ds)
+        { SimdSobelDyAbs(s, srcStride, width, h, d, ds); }))
+        return;
+
         Base::SobelDyAbs(src, srcStride, width, height, dst, dstStride);
 }
 
@@ -1007,6 +1075,15 @@ SIMD_API void SimdSvmSumLinear(const float * x, const float * svs, const float *
         Base::SvmSumLinear(x, svs, weights, length, count, sum);
 }
 
+SIMD_API void SimdSvmSumLinearBatch(const float * x, size_t xStride, size_t xCount, const float * svs, const float * weights, size_t length, size_t count, float * sums)
+{
+    if(ParallelRange(xCount, std::max<size_t>(64, count), [=](size_t begin, size_t end)
+        { SimdSvmSumLinearBatch(x + begin*xStride, xStride, end - begin, svs, weights, length, count, sums + begin); }))
+        return;
+
+        Base::SvmSumLinearBatch(x, xStride, xCount, svs, weights, length, count, sums);
+}
+
 SIMD_API void SimdTextureBoostedSaturatedGradient(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                                      uint8_t saturation, uint8_t boost, uint8_t * dx, size_t dxStride, uint8_t * dy, size_t dyStride)
 {
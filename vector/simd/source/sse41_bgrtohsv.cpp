@@ -0,0 +1,85 @@
+/*
+* Simd Library (http://simd.sourceforge.net).
+*
+* Copyright (c) 2011-2016 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdStore.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdConversion.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        template <int iter, bool align> SIMD_INLINE void BgrToHsv(const uint8_t * bgr, uint8_t * hsv)
+        {
+            __m128i _bgr[3], _hsv[3];
+            _bgr[0] = Load<align>((__m128i*)bgr + 0);
+            _bgr[1] = Load<align>((__m128i*)bgr + 1);
+            _bgr[2] = Load<align>((__m128i*)bgr + 2);
+            BgrToHsv8<iter>(BgrToBlue(_bgr), BgrToGreen(_bgr), BgrToRed(_bgr), _hsv);
+            Store<align>((__m128i*)hsv + 0, InterleaveBgr<0>(_hsv[0], _hsv[1], _hsv[2]));
+            Store<align>((__m128i*)hsv + 1, InterleaveBgr<1>(_hsv[0], _hsv[1], _hsv[2]));
+            Store<align>((__m128i*)hsv + 2, InterleaveBgr<2>(_hsv[0], _hsv[1], _hsv[2]));
+        }
+
+        template <int iter, bool align> void BgrToHsv(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsv, size_t hsvStride)
+        {
+            assert(width >= A);
+            if (align)
+                assert(Aligned(bgr) && Aligned(bgrStride) && Aligned(hsv) && Aligned(hsvStride));
+
+            size_t alignedWidth = AlignLo(width, A);
+            const size_t A3 = A*3;
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0, offset = 0; col < alignedWidth; col += A, offset += A3)
+                    BgrToHsv<iter, align>(bgr + offset, hsv + offset);
+                if (width != alignedWidth)
+                {
+                    size_t offset = 3*(width - A);
+                    BgrToHsv<iter, false>(bgr + offset, hsv + offset);
+                }
+                bgr += bgrStride;
+                hsv += hsvStride;
+            }
+        }
+
+        template <int iter> void BgrToHsv(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsv, size_t hsvStride)
+        {
+            if (Aligned(bgr) && Aligned(bgrStride) && Aligned(hsv) && Aligned(hsvStride))
+                BgrToHsv<iter, true>(bgr, width, height, bgrStride, hsv, hsvStride);
+            else
+                BgrToHsv<iter, false>(bgr, width, height, bgrStride, hsv, hsvStride);
+        }
+
+        template void BgrToHsv<-1>(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsv, size_t hsvStride);
+        template void BgrToHsv<0>(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsv, size_t hsvStride);
+        template void BgrToHsv<1>(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsv, size_t hsvStride);
+
+        void BgrToHsv(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsv, size_t hsvStride)
+        {
+            BgrToHsv<SIMD_X86_RCP_ITER>(bgr, width, height, bgrStride, hsv, hsvStride);
+        }
+    }
+#endif// SIMD_SSE41_ENABLE
+}
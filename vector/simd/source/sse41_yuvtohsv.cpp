@@ -0,0 +1,103 @@
+/*
+* Simd Library (http://simd.sourceforge.net).
+*
+* Copyright (c) 2011-2016 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdStore.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdConversion.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        template <int iter> SIMD_INLINE void YuvToHsv16(__m128i y, __m128i u, __m128i v, __m128i * hsv)
+        {
+            y = AdjustY16(y);
+            u = AdjustUV16(u);
+            v = AdjustUV16(v);
+            BgrToHsv16<iter>(AdjustedYuvToBlue16(y, u), AdjustedYuvToGreen16(y, u, v), AdjustedYuvToRed16(y, v), hsv);
+        }
+
+        template <int iter, bool align> SIMD_INLINE void Yuv444pToHsv(const uint8_t * y, const uint8_t * u, const uint8_t * v, uint8_t * hsv)
+        {
+            __m128i _y = Load<align>((__m128i*)y);
+            __m128i _u = Load<align>((__m128i*)u);
+            __m128i _v = Load<align>((__m128i*)v);
+            __m128i lo[3], hi[3], _hsv[3];
+            YuvToHsv16<iter>(_mm_unpacklo_epi8(_y, K_ZERO), _mm_unpacklo_epi8(_u, K_ZERO), _mm_unpacklo_epi8(_v, K_ZERO), lo);
+            YuvToHsv16<iter>(_mm_unpackhi_epi8(_y, K_ZERO), _mm_unpackhi_epi8(_u, K_ZERO), _mm_unpackhi_epi8(_v, K_ZERO), hi);
+            for (size_t i = 0; i < 3; ++i)
+                _hsv[i] = _mm_packus_epi16(lo[i], hi[i]);
+            Store<align>((__m128i*)hsv + 0, InterleaveBgr<0>(_hsv[0], _hsv[1], _hsv[2]));
+            Store<align>((__m128i*)hsv + 1, InterleaveBgr<1>(_hsv[0], _hsv[1], _hsv[2]));
+            Store<align>((__m128i*)hsv + 2, InterleaveBgr<2>(_hsv[0], _hsv[1], _hsv[2]));
+        }
+
+        template <int iter, bool align> void Yuv444pToHsv(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hsv, size_t hsvStride)
+        {
+            assert(width >= A);
+            if (align)
+                assert(Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride) && Aligned(v) && Aligned(vStride) && Aligned(hsv) && Aligned(hsvStride));
+
+            size_t alignedWidth = AlignLo(width, A);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < alignedWidth; col += A)
+                    Yuv444pToHsv<iter, align>(y + col, u + col, v + col, hsv + 3*col);
+                if (width != alignedWidth)
+                {
+                    size_t col = width - A;
+                    Yuv444pToHsv<iter, false>(y + col, u + col, v + col, hsv + 3*col);
+                }
+                y += yStride;
+                u += uStride;
+                v += vStride;
+                hsv += hsvStride;
+            }
+        }
+
+        template <int iter> void Yuv444pToHsv(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hsv, size_t hsvStride)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride) && Aligned(v) && Aligned(vStride) && Aligned(hsv) && Aligned(hsvStride))
+                Yuv444pToHsv<iter, true>(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride);
+            else
+                Yuv444pToHsv<iter, false>(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride);
+        }
+
+        template void Yuv444pToHsv<-1>(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hsv, size_t hsvStride);
+        template void Yuv444pToHsv<0>(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hsv, size_t hsvStride);
+        template void Yuv444pToHsv<1>(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hsv, size_t hsvStride);
+
+        void Yuv444pToHsv(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hsv, size_t hsvStride)
+        {
+            Yuv444pToHsv<SIMD_X86_RCP_ITER>(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride);
+        }
+    }
+#endif// SIMD_SSE41_ENABLE
+}
@@ -51,6 +51,8 @@ namespace Simd
             uint8_t * nose = (uint8_t*)src;
             size_t * body = (size_t*)AlignHi(nose, sizeof(size_t));
             size_t * tail = (size_t*)AlignLo(nose + size, sizeof(size_t));
+            if(tail < body)
+                body = tail = (size_t*)(nose + size);
 
             size_t crc = 0xFFFFFFFF;
             Crc32c(crc, nose, (uint8_t*)body);
@@ -58,6 +60,110 @@ namespace Simd
             Crc32c(crc, (uint8_t*)tail, nose + size);
             return ~(uint32_t)crc;
         }
+
+#ifdef SIMD_PCLMUL_ENABLE
+        SIMD_INLINE uint32_t Crc32cU64(uint32_t crc, uint64_t value)
+        {
+#ifdef SIMD_X64_ENABLE
+            return (uint32_t)_mm_crc32_u64(crc, value);
+#else
+            return _mm_crc32_u32(_mm_crc32_u32(crc, (uint32_t)value), (uint32_t)(value >> 32));
+#endif
+        }
+
+        SIMD_INLINE uint32_t Crc32c(uint32_t crc, __m128i value)
+        {
+            SIMD_ALIGNED(16) uint64_t buffer[2];
+            _mm_store_si128((__m128i*)buffer, value);
+            return Crc32cU64(Crc32cU64(crc, buffer[0]), buffer[1]);
+        }
+
+        SIMD_INLINE uint32_t Crc32cTail(uint32_t crc, const uint8_t * p, const uint8_t * end)
+        {
+            for (; p + 8 <= end; p += 8)
+                crc = Crc32cU64(crc, *(uint64_t*)p);
+            for (; p < end; ++p)
+                crc = _mm_crc32_u8(crc, *p);
+            return crc;
+        }
+
+        // Multiplies the low (high) 64 bits of value by the low (high) 64 bits of k (carry-less).
+        SIMD_INLINE __m128i Fold(__m128i value, __m128i k)
+        {
+            return _mm_xor_si128(_mm_clmulepi64_si128(value, k, 0x00), _mm_clmulepi64_si128(value, k, 0x11));
+        }
+
+        /*
+        * The crc32 instruction has a latency of 3 cycles and a throughput of 1, so the buffer is cut into
+        * blocks of 3 equal streams which are summed at the same time. The CRC of the first stream is then
+        * shifted over the other two: crc(c, A|B) = crc32(0, clmul(crc(c, A), x^(8*|B| - 33) mod P)) ^ crc(0, B).
+        */
+        template<size_t block> SIMD_INLINE uint32_t Crc32cInterleaved(uint32_t crc, const uint8_t * & p, const uint8_t * end, __m128i k)
+        {
+            for (; p + 3 * block <= end; p += 3 * block)
+            {
+                const uint64_t * p0 = (const uint64_t*)p, * p1 = p0 + block / 8, * p2 = p1 + block / 8;
+                uint32_t crc0 = crc, crc1 = 0, crc2 = 0;
+                for (size_t i = 0; i < block / 8; ++i)
+                {
+                    crc0 = Crc32cU64(crc0, p0[i]);
+                    crc1 = Crc32cU64(crc1, p1[i]);
+                    crc2 = Crc32cU64(crc2, p2[i]);
+                }
+                uint64_t shifted;
+                _mm_storel_epi64((__m128i*)&shifted, Fold(_mm_unpacklo_epi64(_mm_cvtsi32_si128(crc0), _mm_cvtsi32_si128(crc1)), k));
+                crc = Crc32cU64(0, shifted) ^ crc2;
+            }
+            return crc;
+        }
+
+        uint32_t Crc32cInterleaved(const void * src, size_t size)
+        {
+            const uint8_t * p = (const uint8_t*)src, * end = p + size;
+            // x^(8*n - 33) mod P for n = 2*block (low half) and n = block (high half).
+            const __m128i kLong = _mm_set_epi64x(0x54a86326, 0x1dc403cc);
+            const __m128i kShort = _mm_set_epi64x(0xb9e02b86, 0xdd7e3b0c);
+            uint32_t crc = 0xFFFFFFFF;
+            crc = Crc32cInterleaved<8192>(crc, p, end, kLong);
+            crc = Crc32cInterleaved<256>(crc, p, end, kShort);
+            return ~Crc32cTail(crc, p, end);
+        }
+
+        /*
+        * Folding: a 16-byte chunk X = L*x^64 + H followed by D bytes is congruent (mod P) to the 16-byte chunk
+        * L*(x^(8*D + 64) mod P) + H*(x^(8*D) mod P) at the end of these bytes. With bit-reflected data the
+        * constants are (x^(8*D + 32) mod P)' << 1 and (x^(8*D - 32) mod P)' << 1. The CRC of the folded
+        * chunk (taken by the crc32 instruction) is the CRC of all bytes before it.
+        */
+        uint32_t Crc32cFolded(const void * src, size_t size)
+        {
+            const uint8_t * p = (const uint8_t*)src, * end = p + size;
+            uint32_t crc = 0xFFFFFFFF;
+            if (size >= 64)
+            {
+                const __m128i k64 = _mm_set_epi64x(0x09e4addf8, 0x0740eef02);
+                const __m128i k16 = _mm_set_epi64x(0x14cd00bd6, 0x0f20c0dfe);
+                __m128i x0 = _mm_xor_si128(_mm_loadu_si128((__m128i*)p + 0), _mm_cvtsi32_si128(crc));
+                __m128i x1 = _mm_loadu_si128((__m128i*)p + 1);
+                __m128i x2 = _mm_loadu_si128((__m128i*)p + 2);
+                __m128i x3 = _mm_loadu_si128((__m128i*)p + 3);
+                for (p += 64; p + 64 <= end; p += 64)
+                {
+                    x0 = _mm_xor_si128(Fold(x0, k64), _mm_loadu_si128((__m128i*)p + 0));
+                    x1 = _mm_xor_si128(Fold(x1, k64), _mm_loadu_si128((__m128i*)p + 1));
+                    x2 = _mm_xor_si128(Fold(x2, k64), _mm_loadu_si128((__m128i*)p + 2));
+                    x3 = _mm_xor_si128(Fold(x3, k64), _mm_loadu_si128((__m128i*)p + 3));
+                }
+                x1 = _mm_xor_si128(Fold(x0, k16), x1);
+                x2 = _mm_xor_si128(Fold(x1, k16), x2);
+                x3 = _mm_xor_si128(Fold(x2, k16), x3);
+                for (; p + 16 <= end; p += 16)
+                    x3 = _mm_xor_si128(Fold(x3, k16), _mm_loadu_si128((__m128i*)p));
+                crc = Crc32c(0, x3);
+            }
+            return ~Crc32cTail(crc, p, end);
+        }
+#endif//SIMD_PCLMUL_ENABLE
     }
 #endif// SIMD_SSE42_ENABLE
 }
@@ -0,0 +1,110 @@
+#!/usr/bin/env python3
+#
+# Builds the scalar-vs-vector speedup matrix of the Simd tests.
+#
+# Every test_<isa>_<name> executable times the Simd::Base (scalar, built with
+# the compiler under test) and the hand-vectorized version of each function on
+# identical inputs, and checks that their outputs agree before timing. This
+# script reads the reports they write (-pr=<file>, csv or json) and prints one
+# row per function and frame size with the Base median time and the speedup
+# Base / <isa> of every hand-vectorized version found, so the gap left by the
+# compiler's auto-vectorization is a single number per kernel and ISA.
+#
+# usage: speedup.py <results.csv|results.json> [status.csv]
+#
+# status.csv (written by run.sh, "test,status" lines) gives the outcome of the
+# correctness checks of each test executable; the check column is "ok" when all
+# tests that measured a function passed, "fail" otherwise, "-" if unknown. A
+# test that fails its checks exits before reporting and is listed by name.
+#
+# Kernels timed in several precision modes are reported as <function><<mode>>
+# (e.g. BgrToHsl<0>) and get their own rows, measured against the Base time of
+# <function>.
+
+import csv
+import json
+import sys
+
+ISAS = ["Sse", "Sse2", "Sse3", "Ssse3", "Sse41", "Sse42", "Avx", "Avx2", "Avx512f", "Avx512bw", "Vmx", "Vsx", "Neon"]
+
+
+def read_records(path):
+    with open(path) as f:
+        if path.endswith(".json"):
+            return [json.loads(line) for line in f if line.strip()]
+        return list(csv.DictReader(f))
+
+
+def read_status(path):
+    status = {}
+    with open(path) as f:
+        for row in csv.reader(f):
+            if len(row) == 2 and row[0] != "test":
+                status[row[0]] = row[1]
+    return status
+
+
+def is_aligned(record):
+    align = record["align"]
+    return align is True or align == "a"
+
+
+def base_function(function):
+    return function.split("<")[0]
+
+
+def main(argv):
+    if len(argv) < 2:
+        sys.stderr.write("usage: speedup.py <results.csv|results.json> [status.csv]\n")
+        return 2
+    records = read_records(argv[1])
+    status = read_status(argv[2]) if len(argv) > 2 else {}
+
+    # the aligned measurements, keyed by the test that produced them
+    times = {}
+    for r in records:
+        if not is_aligned(r):
+            continue
+        key = (r["test"], r["function"], int(r["width"]), int(r["height"]), int(r["threads"]))
+        times.setdefault(key, {})[r["isa"]] = float(r["median_ms"])
+
+    matrix = {}
+    for (test, function, width, height, threads), isas in times.items():
+        row = matrix.setdefault((function, width, height, threads), {"base": None, "tests": set()})
+        row["tests"].add(test)
+        base = isas.get("Base")
+        if base is None:
+            base = times.get((test, base_function(function), width, height, threads), {}).get("Base")
+        if base is None:
+            continue
+        if row["base"] is None or base < row["base"]:
+            row["base"] = base
+        for isa, t in isas.items():
+            if isa in ISAS and t > 0:
+                row[isa] = base / t
+
+    isas = [isa for isa in ISAS if any(isa in row for row in matrix.values())]
+    out = csv.writer(sys.stdout, lineterminator="\n")
+    out.writerow(["function", "width", "height", "threads", "base_ms"] + isas + ["check"])
+    for key in sorted(matrix):
+        row = matrix[key]
+        results = [status.get(test) for test in row["tests"]]
+        if not status or None in results:
+            check = "-"
+        elif all(result == "ok" for result in results):
+            check = "ok"
+        else:
+            check = "fail"
+        base = "%.6f" % row["base"] if row["base"] is not None else ""
+        speedups = ["%.2f" % row[isa] if isa in row else "" for isa in isas]
+        out.writerow(list(key) + [base] + speedups + [check])
+    # a test stops before reporting when its check fails, so list it by name
+    measured = set(test for row in matrix.values() for test in row["tests"])
+    for test in sorted(status):
+        if status[test] != "ok" and test not in measured:
+            out.writerow([test, "", "", "", ""] + [""] * len(isas) + ["fail"])
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
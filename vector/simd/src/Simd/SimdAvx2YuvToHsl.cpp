@@ -0,0 +1,103 @@
+/*
+* Simd Library (http://simd.sourceforge.net).
+*
+* Copyright (c) 2011-2016 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdStore.h"
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdConversion.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX2_ENABLE    
+    namespace Avx2
+    {
+        template <int iter> SIMD_INLINE void YuvToHsl16(__m256i y, __m256i u, __m256i v, __m256i * hsl)
+        {
+            y = AdjustY16(y);
+            u = AdjustUV16(u);
+            v = AdjustUV16(v);
+            BgrToHsl16<iter>(AdjustedYuvToBlue16(y, u), AdjustedYuvToGreen16(y, u, v), AdjustedYuvToRed16(y, v), hsl);
+        }
+
+        template <int iter, bool align> SIMD_INLINE void Yuv444pToHsl(const uint8_t * y, const uint8_t * u, const uint8_t * v, uint8_t * hsl)
+        {
+            __m256i _y = Load<align>((__m256i*)y);
+            __m256i _u = Load<align>((__m256i*)u);
+            __m256i _v = Load<align>((__m256i*)v);
+            __m256i lo[3], hi[3], _hsl[3];
+            YuvToHsl16<iter>(_mm256_unpacklo_epi8(_y, K_ZERO), _mm256_unpacklo_epi8(_u, K_ZERO), _mm256_unpacklo_epi8(_v, K_ZERO), lo);
+            YuvToHsl16<iter>(_mm256_unpackhi_epi8(_y, K_ZERO), _mm256_unpackhi_epi8(_u, K_ZERO), _mm256_unpackhi_epi8(_v, K_ZERO), hi);
+            for (size_t i = 0; i < 3; ++i)
+                _hsl[i] = _mm256_packus_epi16(lo[i], hi[i]);
+            Store<align>((__m256i*)hsl + 0, InterleaveBgr<0>(_hsl[0], _hsl[1], _hsl[2]));
+            Store<align>((__m256i*)hsl + 1, InterleaveBgr<1>(_hsl[0], _hsl[1], _hsl[2]));
+            Store<align>((__m256i*)hsl + 2, InterleaveBgr<2>(_hsl[0], _hsl[1], _hsl[2]));
+        }
+
+        template <int iter, bool align> void Yuv444pToHsl(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hsl, size_t hslStride)
+        {
+            assert(width >= A);
+            if (align)
+                assert(Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride) && Aligned(v) && Aligned(vStride) && Aligned(hsl) && Aligned(hslStride));
+
+            size_t alignedWidth = AlignLo(width, A);
+            for (size_t row = 0; row < height; ++row)
+            {
+                for (size_t col = 0; col < alignedWidth; col += A)
+                    Yuv444pToHsl<iter, align>(y + col, u + col, v + col, hsl + 3*col);
+                if (width != alignedWidth)
+                {
+                    size_t col = width - A;
+                    Yuv444pToHsl<iter, false>(y + col, u + col, v + col, hsl + 3*col);
+                }
+                y += yStride;
+                u += uStride;
+                v += vStride;
+                hsl += hslStride;
+            }
+        }
+
+        template <int iter> void Yuv444pToHsl(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hsl, size_t hslStride)
+        {
+            if (Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride) && Aligned(v) && Aligned(vStride) && Aligned(hsl) && Aligned(hslStride))
+                Yuv444pToHsl<iter, true>(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride);
+            else
+                Yuv444pToHsl<iter, false>(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride);
+        }
+
+        template void Yuv444pToHsl<-1>(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hsl, size_t hslStride);
+        template void Yuv444pToHsl<0>(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hsl, size_t hslStride);
+        template void Yuv444pToHsl<1>(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hsl, size_t hslStride);
+
+        void Yuv444pToHsl(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * hsl, size_t hslStride)
+        {
+            Yuv444pToHsl<SIMD_X86_RCP_ITER>(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride);
+        }
+    }
+#endif// SIMD_AVX2_ENABLE
+}
@@ -0,0 +1,129 @@
+/*
+* Simd Library (http://simd.sourceforge.net).
+*
+* Copyright (c) 2011-2016 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdConversion.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    namespace Avx512bw
+    {
+        template <bool align> SIMD_INLINE void BgrToBgra(const uint8_t * bgr, uint8_t * bgra, const __m512i & alpha)
+        {
+            __m512i _bgr[3], _bgra[4];
+            _bgr[0] = Load<align>((__m512i*)bgr + 0);
+            _bgr[1] = Load<align>((__m512i*)bgr + 1);
+            _bgr[2] = Load<align>((__m512i*)bgr + 2);
+            BgrToBgra(_bgr, alpha, _bgra);
+            Store<align>((__m512i*)bgra + 0, _bgra[0]);
+            Store<align>((__m512i*)bgra + 1, _bgra[1]);
+            Store<align>((__m512i*)bgra + 2, _bgra[2]);
+            Store<align>((__m512i*)bgra + 3, _bgra[3]);
+        }
+
+        template <bool align> void BgrToBgra(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            assert(width >= A);
+            if(align)
+                assert(Aligned(bgra) && Aligned(bgraStride) && Aligned(bgr) && Aligned(bgrStride));
+
+            size_t alignedWidth = AlignLo(width, A);
+
+            __m512i _alpha = _mm512_slli_epi32(_mm512_set1_epi32(alpha), 24);
+
+            for(size_t row = 0; row < height; ++row)
+            {
+                for(size_t col = 0; col < alignedWidth; col += A)
+                    BgrToBgra<align>(bgr + 3*col, bgra + 4*col, _alpha);
+                if(width != alignedWidth)
+                    BgrToBgra<false>(bgr + 3*(width - A), bgra + 4*(width - A), _alpha);
+                bgr += bgrStride;
+                bgra += bgraStride;
+            }
+        }
+
+        void BgrToBgra(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            if(Aligned(bgra) && Aligned(bgraStride) && Aligned(bgr) && Aligned(bgrStride))
+                BgrToBgra<true>(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
+            else
+                BgrToBgra<false>(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
+        }
+
+        template <bool align> SIMD_INLINE void Bgr48pToBgra32(uint8_t * bgra, 
+            const uint8_t * blue, const uint8_t * green, const uint8_t * red, size_t offset, const __m512i & alpha)
+        {
+            __m512i _blue = _mm512_and_si512(Load<align>((__m512i*)(blue + offset)), K16_00FF);
+            __m512i _green = _mm512_and_si512(Load<align>((__m512i*)(green + offset)), K16_00FF);
+            __m512i _red = _mm512_and_si512(Load<align>((__m512i*)(red + offset)), K16_00FF);
+
+            __m512i bg = _mm512_or_si512(_blue, _mm512_slli_epi16(_green, 8));
+            __m512i ra = _mm512_or_si512(_red, alpha);
+
+            __m512i bgra0 = _mm512_unpacklo_epi16(bg, ra);
+            __m512i bgra1 = _mm512_unpackhi_epi16(bg, ra);
+            Permute4x128(bgra0, bgra1);
+            Store<align>((__m512i*)bgra + 0, bgra0);
+            Store<align>((__m512i*)bgra + 1, bgra1);
+        }
+
+        template <bool align> void Bgr48pToBgra32(const uint8_t * blue, size_t blueStride, size_t width, size_t height,
+            const uint8_t * green, size_t greenStride, const uint8_t * red, size_t redStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            assert(width >= HA);
+            if(align)
+            {
+                assert(Aligned(blue) && Aligned(blueStride));
+                assert(Aligned(green) && Aligned(greenStride));
+                assert(Aligned(red) && Aligned(redStride));
+                assert(Aligned(bgra) && Aligned(bgraStride));
+            }
+
+            __m512i _alpha = _mm512_slli_epi16(_mm512_set1_epi16(alpha), 8);
+            size_t alignedWidth = AlignLo(width, HA);
+            for(size_t row = 0; row < height; ++row)
+            {
+                for(size_t col = 0, srcOffset = 0, dstOffset = 0; col < alignedWidth; col += HA, srcOffset += A, dstOffset += DA)
+                    Bgr48pToBgra32<align>(bgra + dstOffset, blue, green, red, srcOffset, _alpha);
+                if(width != alignedWidth)
+                    Bgr48pToBgra32<false>(bgra + (width - HA)*4, blue, green, red, (width - HA)*2, _alpha);
+                blue += blueStride;
+                green += greenStride;
+                red += redStride;
+                bgra += bgraStride;
+            }
+        }
+
+        void Bgr48pToBgra32(const uint8_t * blue, size_t blueStride, size_t width, size_t height,
+            const uint8_t * green, size_t greenStride, const uint8_t * red, size_t redStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
+        {
+            if(Aligned(blue) && Aligned(blueStride) && Aligned(green) && Aligned(greenStride) && 
+                Aligned(red) && Aligned(redStride) && Aligned(bgra) && Aligned(bgraStride))
+                Bgr48pToBgra32<true>(blue, blueStride, width, height, green, greenStride, red, redStride, bgra, bgraStride, alpha);
+            else
+                Bgr48pToBgra32<false>(blue, blueStride, width, height, green, greenStride, red, redStride, bgra, bgraStride, alpha);
+        }
+    }
+#endif//SIMD_AVX512BW_ENABLE
+}
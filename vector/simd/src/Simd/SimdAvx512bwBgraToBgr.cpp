@@ -0,0 +1,73 @@
+/*
+* Simd Library (http://simd.sourceforge.net).
+*
+* Copyright (c) 2011-2016 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdConversion.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    namespace Avx512bw
+    {
+        template <bool align> SIMD_INLINE void BgraToBgr(const uint8_t * bgra, uint8_t * bgr)
+        {
+            __m512i _bgra[4], _bgr[3];
+            _bgra[0] = Load<align>((__m512i*)bgra + 0);
+            _bgra[1] = Load<align>((__m512i*)bgra + 1);
+            _bgra[2] = Load<align>((__m512i*)bgra + 2);
+            _bgra[3] = Load<align>((__m512i*)bgra + 3);
+            BgraToBgr(_bgra, _bgr);
+            Store<align>((__m512i*)bgr + 0, _bgr[0]);
+            Store<align>((__m512i*)bgr + 1, _bgr[1]);
+            Store<align>((__m512i*)bgr + 2, _bgr[2]);
+        }
+
+        template <bool align> void BgraToBgr(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bgr, size_t bgrStride)
+        {
+            assert(width >= A);
+            if(align)
+                assert(Aligned(bgra) && Aligned(bgraStride) && Aligned(bgr) && Aligned(bgrStride));
+
+            size_t alignedWidth = AlignLo(width, A);
+
+            for(size_t row = 0; row < height; ++row)
+            {
+                for(size_t col = 0; col < alignedWidth; col += A)
+                    BgraToBgr<align>(bgra + 4*col, bgr + 3*col);
+                if(width != alignedWidth)
+                    BgraToBgr<false>(bgra + 4*(width - A), bgr + 3*(width - A));
+                bgra += bgraStride;
+                bgr += bgrStride;
+            }
+        }
+
+        void BgraToBgr(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bgr, size_t bgrStride)
+        {
+            if(Aligned(bgra) && Aligned(bgraStride) && Aligned(bgr) && Aligned(bgrStride))
+                BgraToBgr<true>(bgra, width, height, bgraStride, bgr, bgrStride);
+            else
+                BgraToBgr<false>(bgra, width, height, bgraStride, bgr, bgrStride);
+        }
+    }
+#endif//SIMD_AVX512BW_ENABLE
+}
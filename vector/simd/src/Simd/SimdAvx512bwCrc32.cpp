@@ -0,0 +1,101 @@
+/*
+* Simd Library (http://simd.sourceforge.net).
+*
+* Copyright (c) 2011-2016 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdConst.h"
+
+namespace Simd
+{
+#if defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_VPCLMULQDQ_ENABLE)
+    namespace Avx512bw
+    {
+        SIMD_INLINE uint32_t Crc32cU64(uint32_t crc, uint64_t value)
+        {
+#ifdef SIMD_X64_ENABLE
+            return (uint32_t)_mm_crc32_u64(crc, value);
+#else
+            return _mm_crc32_u32(_mm_crc32_u32(crc, (uint32_t)value), (uint32_t)(value >> 32));
+#endif
+        }
+
+        SIMD_INLINE __m128i Fold(__m128i value, __m128i k)
+        {
+            return _mm_xor_si128(_mm_clmulepi64_si128(value, k, 0x00), _mm_clmulepi64_si128(value, k, 0x11));
+        }
+
+        SIMD_INLINE __m512i Fold(__m512i value, __m512i k)
+        {
+            return _mm512_xor_si512(_mm512_clmulepi64_epi128(value, k, 0x00), _mm512_clmulepi64_epi128(value, k, 0x11));
+        }
+
+        /*
+        * The same folding as Sse42::Crc32cFolded (see there for the constants) on four 64-byte
+        * accumulators, so 256 bytes are folded per iteration.
+        */
+        uint32_t Crc32c(const void * src, size_t size)
+        {
+            const uint8_t * p = (const uint8_t*)src, * end = p + size;
+            uint32_t crc = 0xFFFFFFFF;
+            if (size >= 256)
+            {
+                const __m512i k256 = _mm512_broadcast_i32x4(_mm_set_epi64x(0x0b9e02b86, 0x0dcb17aa4));
+                const __m512i k64 = _mm512_broadcast_i32x4(_mm_set_epi64x(0x09e4addf8, 0x0740eef02));
+                __m512i z0 = _mm512_xor_si512(_mm512_loadu_si512(p + 0 * A), _mm512_zextsi128_si512(_mm_cvtsi32_si128(crc)));
+                __m512i z1 = _mm512_loadu_si512(p + 1 * A);
+                __m512i z2 = _mm512_loadu_si512(p + 2 * A);
+                __m512i z3 = _mm512_loadu_si512(p + 3 * A);
+                for (p += QA; p + QA <= end; p += QA)
+                {
+                    z0 = _mm512_xor_si512(Fold(z0, k256), _mm512_loadu_si512(p + 0 * A));
+                    z1 = _mm512_xor_si512(Fold(z1, k256), _mm512_loadu_si512(p + 1 * A));
+                    z2 = _mm512_xor_si512(Fold(z2, k256), _mm512_loadu_si512(p + 2 * A));
+                    z3 = _mm512_xor_si512(Fold(z3, k256), _mm512_loadu_si512(p + 3 * A));
+                }
+                z1 = _mm512_xor_si512(Fold(z0, k64), z1);
+                z2 = _mm512_xor_si512(Fold(z1, k64), z2);
+                z3 = _mm512_xor_si512(Fold(z2, k64), z3);
+                for (; p + A <= end; p += A)
+                    z3 = _mm512_xor_si512(Fold(z3, k64), _mm512_loadu_si512(p));
+
+                // folds the lanes 0, 1 and 2 over 48, 32 and 16 bytes onto the lane 3:
+                const __m512i k = _mm512_setr_epi64(0x1c291d04, 0x1d82c63da, 0x1384aa63a, 0x0ba4fc28e, 0x0f20c0dfe, 0x14cd00bd6, 0, 0);
+                __m512i f = Fold(z3, k);
+                __m128i x = _mm_xor_si128(_mm512_extracti32x4_epi32(z3, 3), _mm512_castsi512_si128(f));
+                x = _mm_xor_si128(x, _mm_xor_si128(_mm512_extracti32x4_epi32(f, 1), _mm512_extracti32x4_epi32(f, 2)));
+
+                const __m128i k16 = _mm_set_epi64x(0x14cd00bd6, 0x0f20c0dfe);
+                for (; p + 16 <= end; p += 16)
+                    x = _mm_xor_si128(Fold(x, k16), _mm_loadu_si128((__m128i*)p));
+                SIMD_ALIGNED(16) uint64_t buffer[2];
+                _mm_store_si128((__m128i*)buffer, x);
+                crc = Crc32cU64(Crc32cU64(0, buffer[0]), buffer[1]);
+            }
+            for (; p + 8 <= end; p += 8)
+                crc = Crc32cU64(crc, *(uint64_t*)p);
+            for (; p < end; ++p)
+                crc = _mm_crc32_u8(crc, *p);
+            return ~crc;
+        }
+    }
+#endif// defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_VPCLMULQDQ_ENABLE)
+}
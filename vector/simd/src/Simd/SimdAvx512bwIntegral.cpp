@@ -0,0 +1,220 @@
+/*
+* Simd Library (http://simd.sourceforge.net).
+*
+* Copyright (c) 2011-2016 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdConst.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE    
+    namespace Avx512bw
+    {
+        namespace
+        {
+            template <class T> struct Carry;
+            template <> struct Carry<uint32_t> { typedef __m512i Type; static Type Zero() { return _mm512_setzero_si512(); } };
+            template <> struct Carry<double> { typedef __m512d Type; static Type Zero() { return _mm512_setzero_pd(); } };
+        }
+
+        const size_t STEP = A/sizeof(uint32_t);
+
+        SIMD_INLINE __m512i Last32(__m512i a)
+        {
+            return _mm512_permutexvar_epi32(_mm512_set1_epi32(15), a);
+        }
+
+        // Prefix sums of 16 int32: within the 128-bit lanes, then across them in two steps
+        SIMD_INLINE __m512i PrefixSum32(__m512i a)
+        {
+            a = _mm512_add_epi32(a, _mm512_bslli_epi128(a, 4));
+            a = _mm512_add_epi32(a, _mm512_bslli_epi128(a, 8));
+            a = _mm512_add_epi32(a, _mm512_maskz_permutexvar_epi32(0xFFF0,
+                _mm512_setr_epi32(0, 0, 0, 0, 3, 3, 3, 3, 7, 7, 7, 7, 11, 11, 11, 11), a));
+            return _mm512_add_epi32(a, _mm512_maskz_permutexvar_epi32(0xFF00,
+                _mm512_setr_epi32(0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 7, 7, 7, 7), a));
+        }
+
+        SIMD_INLINE __m128i LoadSrc(const uint8_t * src, __mmask16 mask)
+        {
+            return _mm512_castsi512_si128(_mm512_maskz_loadu_epi8(__mmask64(mask), src));
+        }
+
+        SIMD_INLINE void StoreSum(uint32_t * dst, const uint32_t * above, __m512i local, __m512i carry, __mmask16 mask)
+        {
+            __m512i value = _mm512_add_epi32(_mm512_add_epi32(local, carry), _mm512_maskz_loadu_epi32(mask, above));
+            _mm512_mask_storeu_epi32(dst, mask, value);
+        }
+
+        SIMD_INLINE void StoreSum(double * dst, const double * above, __m512i local, __m512d carry, __mmask16 mask)
+        {
+            __mmask8 lo = __mmask8(mask), hi = __mmask8(mask >> 8);
+            __m512d value0 = _mm512_add_pd(_mm512_cvtepi32_pd(_mm512_castsi512_si256(local)), carry);
+            __m512d value1 = _mm512_add_pd(_mm512_cvtepi32_pd(_mm512_extracti64x4_epi64(local, 1)), carry);
+            _mm512_mask_storeu_pd(dst + 0, lo, _mm512_add_pd(value0, _mm512_maskz_loadu_pd(lo, above + 0)));
+            _mm512_mask_storeu_pd(dst + 8, hi, _mm512_add_pd(value1, _mm512_maskz_loadu_pd(hi, above + 8)));
+        }
+
+        SIMD_INLINE void UpdateCarry(__m512i & carry, __m512i local)
+        {
+            carry = _mm512_add_epi32(carry, Last32(local));
+        }
+
+        SIMD_INLINE void UpdateCarry(__m512d & carry, __m512i local)
+        {
+            carry = _mm512_add_pd(carry, _mm512_cvtepi32_pd(_mm512_castsi512_si256(Last32(local))));
+        }
+
+        template <bool sqsumEnable, class TSqsum> SIMD_INLINE void IntegralBlock(const uint8_t * src, 
+            uint32_t * sum, const uint32_t * sumAbove, __m512i & sumCarry, 
+            TSqsum * sqsum, const TSqsum * sqsumAbove, typename Carry<TSqsum>::Type & sqsumCarry, __mmask16 mask = -1)
+        {
+            __m512i _src = _mm512_cvtepu8_epi32(LoadSrc(src, mask));
+            __m512i local = PrefixSum32(_src);
+            StoreSum(sum, sumAbove, local, sumCarry, mask);
+            UpdateCarry(sumCarry, local);
+            if (sqsumEnable)
+            {
+                local = PrefixSum32(_mm512_mullo_epi32(_src, _src));
+                StoreSum(sqsum, sqsumAbove, local, sqsumCarry, mask);
+                UpdateCarry(sqsumCarry, local);
+            }
+        }
+
+        template <bool sqsumEnable, class TSqsum> void IntegralRow(const uint8_t * src, size_t width,
+            uint32_t * sum, const uint32_t * sumAbove, TSqsum * sqsum, const TSqsum * sqsumAbove)
+        {
+            size_t alignedWidth = AlignLo(width, STEP);
+            __mmask16 tailMask = __mmask16(-1) >> (STEP + alignedWidth - width);
+            __m512i sumCarry = _mm512_setzero_si512();
+            typename Carry<TSqsum>::Type sqsumCarry = Carry<TSqsum>::Zero();
+            size_t col = 0;
+            for (; col < alignedWidth; col += STEP)
+                IntegralBlock<sqsumEnable>(src + col, sum + col, sumAbove + col, sumCarry, 
+                    sqsum + col, sqsumAbove + col, sqsumCarry);
+            if (col < width)
+                IntegralBlock<sqsumEnable>(src + col, sum + col, sumAbove + col, sumCarry, 
+                    sqsum + col, sqsumAbove + col, sqsumCarry, tailMask);
+        }
+
+        // See Sse2::IntegralTiltedRow for the recurrence
+        SIMD_INLINE void TiltedBlock(const uint8_t * src, uint32_t * buffer, uint32_t * tilted, const uint32_t * tiltedAbove, __mmask16 mask = -1)
+        {
+            __m512i _src = _mm512_cvtepu8_epi32(LoadSrc(src, mask));
+            __m512i b0 = _mm512_maskz_loadu_epi32(mask, buffer);
+            __m512i b1 = _mm512_maskz_loadu_epi32(mask, buffer + 1);
+            __m512i t = _mm512_add_epi32(_mm512_add_epi32(b0, b1), _mm512_add_epi32(_src, _mm512_maskz_loadu_epi32(mask, tiltedAbove - 1)));
+            _mm512_mask_storeu_epi32(buffer, mask, _mm512_add_epi32(b1, _src));
+            _mm512_mask_storeu_epi32(tilted, mask, t);
+        }
+
+        void IntegralTiltedRow(const uint8_t * src, size_t width, uint32_t * buffer, uint32_t * tilted, const uint32_t * tiltedAbove)
+        {
+            size_t alignedWidth = AlignLo(width, STEP);
+            __mmask16 tailMask = __mmask16(-1) >> (STEP + alignedWidth - width);
+            uint32_t first = tiltedAbove[0] + src[0] + buffer[1];
+            size_t col = 0;
+            for (; col < alignedWidth; col += STEP)
+                TiltedBlock(src + col, buffer + col, tilted + col, tiltedAbove + col);
+            if (col < width)
+                TiltedBlock(src + col, buffer + col, tilted + col, tiltedAbove + col, tailMask);
+            tilted[0] = first;
+        }
+
+        template <bool sqsumEnable, class TSqsum> void Integral(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+            uint32_t * sum, size_t sumStride, TSqsum * sqsum, size_t sqsumStride, uint32_t * tilted, size_t tiltedStride)
+        {
+            memset(sum, 0, (width + 1)*sizeof(uint32_t));
+            sum += sumStride + 1;
+            if (sqsumEnable)
+            {
+                memset(sqsum, 0, (width + 1)*sizeof(TSqsum));
+                sqsum += sqsumStride + 1;
+            }
+            uint32_t * buffer = NULL;
+            if (tilted)
+            {
+                memset(tilted, 0, (width + 1)*sizeof(uint32_t));
+                tilted += tiltedStride + 1;
+                buffer = (uint32_t*)Allocate((width + 1)*sizeof(uint32_t));
+                buffer[width] = 0;
+            }
+
+            for (size_t row = 0; row < height; ++row)
+            {
+                sum[-1] = 0;
+                if (sqsumEnable)
+                    sqsum[-1] = 0;
+                IntegralRow<sqsumEnable>(src, width, sum, sum - sumStride, sqsum, sqsumEnable ? sqsum - sqsumStride : NULL);
+                if (tilted)
+                {
+                    tilted[-1] = row ? tilted[-tiltedStride] : 0;
+                    if (row)
+                        IntegralTiltedRow(src, width, buffer, tilted, tilted - tiltedStride);
+                    else
+                    {
+                        for (size_t col = 0; col < width; ++col)
+                            tilted[col] = buffer[col] = src[col];
+                    }
+                    tilted += tiltedStride;
+                }
+                src += srcStride;
+                sum += sumStride;
+                if (sqsumEnable)
+                    sqsum += sqsumStride;
+            }
+
+            if (buffer)
+                Free(buffer);
+        }
+
+        void Integral(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+            uint8_t * sum, size_t sumStride, uint8_t * sqsum, size_t sqsumStride, uint8_t * tilted, size_t tiltedStride,
+            SimdPixelFormatType sumFormat, SimdPixelFormatType sqsumFormat)
+        {
+            assert(sumFormat == SimdPixelFormatInt32 && sumStride%sizeof(uint32_t) == 0);
+            if (tilted)
+                assert(tiltedStride%sizeof(uint32_t) == 0);
+
+            if (sqsum)
+            {
+                switch (sqsumFormat)
+                {
+                case SimdPixelFormatInt32:
+                    Integral<true, uint32_t>(src, srcStride, width, height, (uint32_t*)sum, sumStride/sizeof(uint32_t),
+                        (uint32_t*)sqsum, sqsumStride/sizeof(uint32_t), (uint32_t*)tilted, tiltedStride/sizeof(uint32_t));
+                    break;
+                case SimdPixelFormatDouble:
+                    Integral<true, double>(src, srcStride, width, height, (uint32_t*)sum, sumStride/sizeof(uint32_t),
+                        (double*)sqsum, sqsumStride/sizeof(double), (uint32_t*)tilted, tiltedStride/sizeof(uint32_t));
+                    break;
+                default:
+                    assert(0);
+                }
+            }
+            else
+                Integral<false, uint32_t>(src, srcStride, width, height, (uint32_t*)sum, sumStride/sizeof(uint32_t),
+                    NULL, 0, (uint32_t*)tilted, tiltedStride/sizeof(uint32_t));
+        }
+    }
+#endif// SIMD_AVX512BW_ENABLE
+}
@@ -0,0 +1,251 @@
+/*
+* Simd Library (http://simd.sourceforge.net).
+*
+* Copyright (c) 2011-2016 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdBase.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    namespace Avx512bw
+    {
+        namespace
+        {
+            struct Buffer
+            {
+                Buffer(size_t size, size_t width, size_t height)
+                {
+                    _p = Allocate(3*size + sizeof(int)*(2*height + width), A);
+                    bx[0] = (uint8_t*)_p;
+                    bx[1] = bx[0] + size;
+                    ax = bx[1] + size;
+                    ix = (int*)(ax + size);
+                    iy = ix + width;
+                    ay = iy + height;
+                }
+
+                ~Buffer()
+                {
+                    Free(_p);
+                }
+
+                uint8_t * bx[2];
+                uint8_t * ax;
+                int * ix;
+                int * ay;
+                int * iy;
+            private:
+                void *_p;
+            };
+        }
+
+        template <size_t channelCount> void EstimateAlphaIndexX(size_t srcSize, size_t dstSize, int * indexes, uint8_t * alphas)
+        {
+            float scale = (float)srcSize/dstSize;
+
+            for(size_t i = 0; i < dstSize; ++i)
+            {
+                float alpha = (float)((i + 0.5)*scale - 0.5);
+                ptrdiff_t index = (ptrdiff_t)::floor(alpha);
+                alpha -= index;
+
+                if(index < 0)
+                {
+                    index = 0;
+                    alpha = 0;
+                }
+
+                if(index > (ptrdiff_t)srcSize - 2)
+                {
+                    index = srcSize - 2;
+                    alpha = 1;
+                }
+
+                indexes[i] = (int)index;
+                alphas[1] = (uint8_t)(alpha * Base::FRACTION_RANGE + 0.5);
+                alphas[0] = (uint8_t)(Base::FRACTION_RANGE - alphas[1]);
+                for(size_t channel = 1; channel < channelCount; channel++)
+                    ((uint16_t*)alphas)[channel] = *(uint16_t*)alphas;
+                alphas += 2*channelCount;
+            }
+        }
+
+        template <size_t channelCount> SIMD_INLINE void GatherX(const uint8_t * src, const int * ix, size_t width, uint8_t * dst)
+        {
+            struct One { uint8_t channels[channelCount]; };
+            struct Two { uint8_t channels[channelCount*2]; };
+
+            Two * pb = (Two *)dst;
+            const One * psrc = (const One *)src;
+            for(size_t x = 0; x < width; x++)
+                pb[x] = *(Two *)(psrc + ix[x]);
+        }
+
+        template <> SIMD_INLINE void GatherX<3>(const uint8_t * src, const int * ix, size_t width, uint8_t * dst)
+        {
+            for(size_t x = 0; x < width; x++, dst += 6)
+            {
+                const uint8_t * ps = src + 3*ix[x];
+                dst[0] = ps[0]; dst[1] = ps[3];
+                dst[2] = ps[1]; dst[3] = ps[4];
+                dst[4] = ps[2]; dst[5] = ps[5];
+            }
+        }
+
+        SIMD_INLINE void InterpolateX1(const __m512i * alpha, __m512i * buffer)
+        {
+            _mm512_store_si512(buffer, _mm512_maddubs_epi16(_mm512_load_si512(buffer), _mm512_load_si512(alpha)));
+        }
+
+        SIMD_INLINE void InterpolateX(const __m512i * alpha, __m512i * buffer, const __m512i & shuffle)
+        {
+            __m512i src = _mm512_shuffle_epi8(_mm512_load_si512(buffer), shuffle);
+            _mm512_store_si512(buffer, _mm512_maddubs_epi16(src, _mm512_load_si512(alpha)));
+        }
+
+        template <size_t channelCount> void InterpolateX(const __m512i * alpha, __m512i * buffer);
+
+        template <> SIMD_INLINE void InterpolateX<1>(const __m512i * alpha, __m512i * buffer)
+        {
+            InterpolateX1(alpha, buffer);
+        }
+
+        template <> SIMD_INLINE void InterpolateX<2>(const __m512i * alpha, __m512i * buffer)
+        {
+            const __m512i shuffle = _mm512_broadcast_i32x4(_mm_setr_epi8(0x0, 0x2, 0x1, 0x3, 0x4, 0x6, 0x5, 0x7, 0x8, 0xA, 0x9, 0xB, 0xC, 0xE, 0xD, 0xF));
+            InterpolateX(alpha + 0, buffer + 0, shuffle);
+            InterpolateX(alpha + 1, buffer + 1, shuffle);
+        }
+
+        template <> SIMD_INLINE void InterpolateX<3>(const __m512i * alpha, __m512i * buffer)
+        {
+            InterpolateX1(alpha + 0, buffer + 0);
+            InterpolateX1(alpha + 1, buffer + 1);
+            InterpolateX1(alpha + 2, buffer + 2);
+        }
+
+        template <> SIMD_INLINE void InterpolateX<4>(const __m512i * alpha, __m512i * buffer)
+        {
+            const __m512i shuffle = _mm512_broadcast_i32x4(_mm_setr_epi8(0x0, 0x4, 0x1, 0x5, 0x2, 0x6, 0x3, 0x7, 0x8, 0xC, 0x9, 0xD, 0xA, 0xE, 0xB, 0xF));
+            InterpolateX(alpha + 0, buffer + 0, shuffle);
+            InterpolateX(alpha + 1, buffer + 1, shuffle);
+            InterpolateX(alpha + 2, buffer + 2, shuffle);
+            InterpolateX(alpha + 3, buffer + 3, shuffle);
+        }
+
+        const __m512i K16_FRACTION_ROUND_TERM = SIMD_MM512_SET1_EPI16(Base::BILINEAR_ROUND_TERM);
+
+        template<bool align> SIMD_INLINE __m512i InterpolateY(const __m512i * pbx0, const __m512i * pbx1, __m512i alpha[2])
+        {
+            __m512i sum = _mm512_add_epi16(_mm512_mullo_epi16(Load<align>(pbx0), alpha[0]), _mm512_mullo_epi16(Load<align>(pbx1), alpha[1]));
+            return _mm512_srli_epi16(_mm512_add_epi16(sum, K16_FRACTION_ROUND_TERM), Base::BILINEAR_SHIFT);
+        }
+
+        template<bool align> SIMD_INLINE void InterpolateY(const uint8_t * bx0, const uint8_t * bx1, __m512i alpha[2], uint8_t * dst)
+        {
+            __m512i lo = InterpolateY<align>((__m512i*)bx0 + 0, (__m512i*)bx1 + 0, alpha);
+            __m512i hi = InterpolateY<align>((__m512i*)bx0 + 1, (__m512i*)bx1 + 1, alpha);
+            Store<false>((__m512i*)dst, PackU16ToU8(lo, hi));
+        }
+
+        template <size_t channelCount> void ResizeBilinear(
+            const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride)
+        {
+            assert(dstWidth >= A);
+
+            size_t size = 2*dstWidth*channelCount;
+            size_t bufferSize = AlignHi(dstWidth, A)*channelCount*2;
+            size_t alignedSize = AlignHi(size, DA) - DA;
+            const size_t step = A*channelCount;
+
+            Buffer buffer(bufferSize, dstWidth, dstHeight);
+
+            Base::EstimateAlphaIndex(srcHeight, dstHeight, buffer.iy, buffer.ay, 1);
+
+            EstimateAlphaIndexX<channelCount>(srcWidth, dstWidth, buffer.ix, buffer.ax);
+
+            ptrdiff_t previous = -2;
+
+            __m512i a[2];
+
+            for(size_t yDst = 0; yDst < dstHeight; yDst++, dst += dstStride)
+            {
+                a[0] = _mm512_set1_epi16(int16_t(Base::FRACTION_RANGE - buffer.ay[yDst]));
+                a[1] = _mm512_set1_epi16(int16_t(buffer.ay[yDst]));
+
+                ptrdiff_t sy = buffer.iy[yDst];
+                int k = 0;
+
+                if(sy == previous)
+                    k = 2;
+                else if(sy == previous + 1)
+                {
+                    Swap(buffer.bx[0], buffer.bx[1]);
+                    k = 1;
+                }
+
+                previous = sy;
+
+                for(; k < 2; k++)
+                {
+                    GatherX<channelCount>(src + (sy + k)*srcStride, buffer.ix, dstWidth, buffer.bx[k]);
+
+                    uint8_t * pbx = buffer.bx[k];
+                    for(size_t i = 0; i < bufferSize; i += step)
+                        InterpolateX<channelCount>((__m512i*)(buffer.ax + i), (__m512i*)(pbx + i));
+                }
+
+                for(size_t ib = 0, id = 0; ib < alignedSize; ib += DA, id += A)
+                    InterpolateY<true>(buffer.bx[0] + ib, buffer.bx[1] + ib, a, dst + id);
+                size_t i = size - DA;
+                InterpolateY<false>(buffer.bx[0] + i, buffer.bx[1] + i, a, dst + i/2);
+            }
+        }
+
+        void ResizeBilinear(
+            const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
+            uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount)
+        {
+            switch(channelCount)
+            {
+            case 1:
+                ResizeBilinear<1>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+                break;
+            case 2:
+                ResizeBilinear<2>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+                break;
+            case 3:
+                ResizeBilinear<3>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+                break;
+            case 4:
+                ResizeBilinear<4>(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride);
+                break;
+            default:
+                Base::ResizeBilinear(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
+            }
+        }
+    }
+#endif//SIMD_AVX512BW_ENABLE
+}
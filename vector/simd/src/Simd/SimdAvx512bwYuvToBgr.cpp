@@ -0,0 +1,199 @@
+/*
+* Simd Library (http://simd.sourceforge.net).
+*
+* Copyright (c) 2011-2016 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdStore.h"
+#include "Simd/SimdConversion.h"
+
+namespace Simd
+{
+#ifdef SIMD_AVX512BW_ENABLE
+    namespace Avx512bw
+    {
+        SIMD_INLINE void Yuv16ToBgra(__m512i y16, __m512i u16, __m512i v16, __m512i & bgra0, __m512i & bgra1)
+        {
+            AdjustedYuv16ToBgra(AdjustY16(y16), AdjustUV16(u16), AdjustUV16(v16), K_ZERO, bgra0, bgra1);
+        }
+
+        template <bool align> SIMD_INLINE void StoreBgr(const __m512i bgra[4], uint8_t * bgr)
+        {
+            __m512i _bgr[3];
+            BgraToBgr(bgra, _bgr);
+            Store<align>((__m512i*)bgr + 0, _bgr[0]);
+            Store<align>((__m512i*)bgr + 1, _bgr[1]);
+            Store<align>((__m512i*)bgr + 2, _bgr[2]);
+        }
+
+        template <bool align> SIMD_INLINE void Yuv444pToBgr(const uint8_t * y, const uint8_t * u, const uint8_t * v, uint8_t * bgr)
+        {
+            __m512i y8 = Load<align>((__m512i*)y);
+            __m512i u8 = Load<align>((__m512i*)u);
+            __m512i v8 = Load<align>((__m512i*)v);
+            __m512i bgra[4];
+            Yuv16ToBgra(ExtendU8ToU16<0>(y8), ExtendU8ToU16<0>(u8), ExtendU8ToU16<0>(v8), bgra[0], bgra[1]);
+            Yuv16ToBgra(ExtendU8ToU16<1>(y8), ExtendU8ToU16<1>(u8), ExtendU8ToU16<1>(v8), bgra[2], bgra[3]);
+            StoreBgr<align>(bgra, bgr);
+        }
+
+        template <bool align> void Yuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            assert(width >= A);
+            if(align)
+            {
+                assert(Aligned(y) && Aligned(yStride) && Aligned(u) &&  Aligned(uStride));
+                assert(Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride));
+            }
+
+            size_t bodyWidth = AlignLo(width, A);
+            size_t tail = width - bodyWidth;
+            size_t A3 = A*3;
+            for(size_t row = 0; row < height; ++row)
+            {
+                for(size_t colYuv = 0, colBgr = 0; colYuv < bodyWidth; colYuv += A, colBgr += A3)
+                {
+                    Yuv444pToBgr<align>(y + colYuv, u + colYuv, v + colYuv, bgr + colBgr);
+                }
+                if(tail)
+                {
+                    size_t col = width - A;
+                    Yuv444pToBgr<false>(y + col, u + col, v + col, bgr + 3*col);
+                }
+                y += yStride;
+                u += uStride;
+                v += vStride;
+                bgr += bgrStride;
+            }
+        }
+
+        void Yuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            if(Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
+                && Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride))
+                Yuv444pToBgr<true>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+            else
+                Yuv444pToBgr<false>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        }
+
+        template <bool align> SIMD_INLINE void Yuv422pToBgr(const uint8_t * y, const __m512i & u, const __m512i & v, uint8_t * bgr)
+        {
+            __m512i y0 = Load<align>((__m512i*)y + 0);
+            __m512i y1 = Load<align>((__m512i*)y + 1);
+            __m512i bgra[4];
+            Yuv16ToBgra(ExtendU8ToU16<0>(y0), DuplicateU8ToU16<0>(u), DuplicateU8ToU16<0>(v), bgra[0], bgra[1]);
+            Yuv16ToBgra(ExtendU8ToU16<1>(y0), DuplicateU8ToU16<1>(u), DuplicateU8ToU16<1>(v), bgra[2], bgra[3]);
+            StoreBgr<align>(bgra, bgr + 0*A);
+            Yuv16ToBgra(ExtendU8ToU16<0>(y1), DuplicateU8ToU16<2>(u), DuplicateU8ToU16<2>(v), bgra[0], bgra[1]);
+            Yuv16ToBgra(ExtendU8ToU16<1>(y1), DuplicateU8ToU16<3>(u), DuplicateU8ToU16<3>(v), bgra[2], bgra[3]);
+            StoreBgr<align>(bgra, bgr + 3*A);
+        }
+
+        template <bool align> void Yuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            assert((width%2 == 0) && (height%2 == 0) && (width >= DA) && (height >= 2));
+            if(align)
+            {
+                assert(Aligned(y) && Aligned(yStride) && Aligned(u) &&  Aligned(uStride));
+                assert(Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride));
+            }
+
+            size_t bodyWidth = AlignLo(width, DA);
+            size_t tail = width - bodyWidth;
+            size_t A6 = A*6;
+            for(size_t row = 0; row < height; row += 2)
+            {
+                for(size_t colUV = 0, colY = 0, colBgr = 0; colY < bodyWidth; colY += DA, colUV += A, colBgr += A6)
+                {
+                    __m512i u_ = Load<align>((__m512i*)(u + colUV));
+                    __m512i v_ = Load<align>((__m512i*)(v + colUV));
+                    Yuv422pToBgr<align>(y + colY, u_, v_, bgr + colBgr);
+                    Yuv422pToBgr<align>(y + colY + yStride, u_, v_, bgr + colBgr + bgrStride);
+                }
+                if(tail)
+                {
+                    size_t offset = width - DA;
+                    __m512i u_ = Load<false>((__m512i*)(u + offset/2));
+                    __m512i v_ = Load<false>((__m512i*)(v + offset/2));
+                    Yuv422pToBgr<false>(y + offset, u_, v_, bgr + 3*offset);
+                    Yuv422pToBgr<false>(y + offset + yStride, u_, v_, bgr + 3*offset + bgrStride);
+                }
+                y += 2*yStride;
+                u += uStride;
+                v += vStride;
+                bgr += 2*bgrStride;
+            }
+        }
+
+        void Yuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            if(Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
+                && Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride))
+                Yuv420pToBgr<true>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+            else
+                Yuv420pToBgr<false>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        }
+
+        template <bool align> void Yuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            assert((width%2 == 0) && (width >= DA));
+            if(align)
+            {
+                assert(Aligned(y) && Aligned(yStride) && Aligned(u) &&  Aligned(uStride));
+                assert(Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride));
+            }
+
+            size_t bodyWidth = AlignLo(width, DA);
+            size_t tail = width - bodyWidth;
+            size_t A6 = A*6;
+            for(size_t row = 0; row < height; ++row)
+            {
+                for(size_t colUV = 0, colY = 0, colBgr = 0; colY < bodyWidth; colY += DA, colUV += A, colBgr += A6)
+                    Yuv422pToBgr<align>(y + colY, Load<align>((__m512i*)(u + colUV)), Load<align>((__m512i*)(v + colUV)), bgr + colBgr);
+                if(tail)
+                {
+                    size_t offset = width - DA;
+                    Yuv422pToBgr<false>(y + offset, Load<false>((__m512i*)(u + offset/2)), Load<false>((__m512i*)(v + offset/2)), bgr + 3*offset);
+                }
+                y += yStride;
+                u += uStride;
+                v += vStride;
+                bgr += bgrStride;
+            }
+        }
+
+        void Yuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+            size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
+        {
+            if(Aligned(y) && Aligned(yStride) && Aligned(u) && Aligned(uStride)
+                && Aligned(v) && Aligned(vStride) && Aligned(bgr) && Aligned(bgrStride))
+                Yuv422pToBgr<true>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+            else
+                Yuv422pToBgr<false>(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+        }
+    }
+#endif// SIMD_AVX512BW_ENABLE
+}
@@ -69,6 +69,18 @@ namespace Simd
             *sum = ProductSum(a, b, Simd::AlignLo(size, 4), size);
         }
 
+        void NeuralProductSumBatch(const float * a, size_t aStride, size_t aCount, const float * b, size_t bStride, size_t bCount, size_t size, float * sums)
+        {
+            size_t aligned = Simd::AlignLo(size, 4);
+            for (size_t i = 0; i < aCount; ++i)
+            {
+                for (size_t j = 0; j < bCount; ++j)
+                    sums[j] = ProductSum(a, b + j*bStride, aligned, size);
+                a += aStride;
+                sums += bCount;
+            }
+        }
+
         SIMD_INLINE void AddMultiplied(const float * src, size_t aligned, size_t full, float value, float * dst)
         {
             size_t i = 0;
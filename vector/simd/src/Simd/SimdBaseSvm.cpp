@@ -22,6 +22,7 @@
 * SOFTWARE.
 */
 #include "Simd/SimdMemory.h"
+#include "Simd/SimdBase.h"
 
 namespace Simd
 {
@@ -64,5 +65,12 @@ namespace Simd
             for(size_t i = 0; i < count; ++i)
                 *sum += buffer.sums[i]*weights[i];
         }
+
+        void SvmSumLinearBatch(const float * x, size_t xStride, size_t xCount, const float * svs, const float * weights, size_t length, size_t count, float * sums)
+        {
+            Buffer hyperplane(length);
+            NeuralProductSumBatch(svs, count, length, weights, count, 1, count, hyperplane.sums);
+            NeuralProductSumBatch(x, xStride, xCount, hyperplane.sums, length, 1, length, sums);
+        }
     }
 }
@@ -40,6 +40,14 @@
 
 //#define SIMD_AVX2_DISABLE
 
+//#define SIMD_AVX512F_DISABLE
+
+//#define SIMD_AVX512BW_DISABLE
+
+//#define SIMD_PCLMUL_DISABLE
+
+//#define SIMD_VPCLMULQDQ_DISABLE
+
 //#define SIMD_VMX_DISABLE
 
 //#define SIMD_VSX_DISABLE
@@ -52,6 +60,8 @@
 
 #define SIMD_ALLOCATE_ASSERT
 
+#define SIMD_X86_RCP_ITER 1
+
 #define SIMD_NEON_RCP_ITER -1
 
 #define SIMD_NEON_ASM_DISABLE
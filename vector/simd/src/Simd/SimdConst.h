@@ -31,6 +31,8 @@ namespace Simd
 {
 	const size_t HISTOGRAM_SIZE = UCHAR_MAX + 1;
 
+    const size_t L2_CACHE_SIZE = 256*1024;
+
     namespace Base
     {
         const int LINEAR_SHIFT = 4;
@@ -359,9 +361,65 @@ namespace Simd
         const __m256i K8_BGRA_TO_BGR_SHUFFLE = SIMD_MM256_SETR_EPI8(
             0x0, 0x1, 0x2, -1, 0x3, 0x4, 0x5, -1, 0x6, 0x7, 0x8, -1, 0x9, 0xA, 0xB, -1,
             0x4, 0x5, 0x6, -1, 0x7, 0x8, 0x9, -1, 0xA, 0xB, 0xC, -1, 0xD, 0xE, 0xF, -1);
+
+        const __m256i K8_SHUFFLE_BGRA_TO_BGR = SIMD_MM256_SETR_EPI8(
+            0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1,
+            0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1);
+
+        const __m256i K32_PERMUTE_BGRA_TO_BGR_0 = SIMD_MM256_SETR_EPI32(0, 1, 2, 4, 5, 6, 0, 1);
+        const __m256i K32_PERMUTE_BGRA_TO_BGR_1 = SIMD_MM256_SETR_EPI32(2, 4, 5, 6, 0, 1, 2, 4);
+        const __m256i K32_PERMUTE_BGRA_TO_BGR_2 = SIMD_MM256_SETR_EPI32(5, 6, 0, 1, 2, 4, 5, 6);
 	}
 #endif// SIMD_AVX2_ENABLE
 
+#ifdef SIMD_AVX512BW_ENABLE
+    namespace Avx512bw
+    {
+        const size_t A = sizeof(__m512i);
+        const size_t DA = 2*A;
+        const size_t QA = 4*A;
+        const size_t OA = 8*A;
+        const size_t HA = A/2;
+
+        const size_t F = sizeof(__m512)/sizeof(float);
+        const size_t DF = 2*F;
+        const size_t QF = 4*F;
+    }
+#endif// SIMD_AVX512BW_ENABLE
+
+#ifdef SIMD_AVX512BW_INLINE_ENABLE
+    namespace Avx512bw
+    {
+        const __m512i K_ZERO = SIMD_MM512_SET1_EPI8(0);
+        const __m512i K_INV_ZERO = SIMD_MM512_SET1_EPI8(0xFF);
+
+        const __m512i K8_01 = SIMD_MM512_SET1_EPI8(0x01);
+        const __m512i K8_02 = SIMD_MM512_SET1_EPI8(0x02);
+
+        const __m512i K8_01_FF = SIMD_MM512_SET2_EPI8(0x01, 0xFF);
+        const __m512i K8_01_02 = SIMD_MM512_SET2_EPI8(0x01, 0x02);
+
+        const __m512i K16_0001 = SIMD_MM512_SET1_EPI16(0x0001);
+        const __m512i K16_0002 = SIMD_MM512_SET1_EPI16(0x0002);
+        const __m512i K16_0008 = SIMD_MM512_SET1_EPI16(0x0008);
+        const __m512i K16_00FF = SIMD_MM512_SET1_EPI16(0x00FF);
+        const __m512i K16_FF00 = SIMD_MM512_SET1_EPI16(0xFF00);
+
+        const __m512i K32_00000001 = SIMD_MM512_SET1_EPI32(0x00000001);
+        const __m512i K32_000000FF = SIMD_MM512_SET1_EPI32(0x000000FF);
+        const __m512i K32_0000FFFF = SIMD_MM512_SET1_EPI32(0x0000FFFF);
+        const __m512i K32_FFFFFF00 = SIMD_MM512_SET1_EPI32(0xFFFFFF00);
+
+        const __m512i K16_Y_ADJUST = SIMD_MM512_SET1_EPI16(Base::Y_ADJUST);
+        const __m512i K16_UV_ADJUST = SIMD_MM512_SET1_EPI16(Base::UV_ADJUST);
+
+        const __m512i K16_YRGB_RT = SIMD_MM512_SET2_EPI16(Base::Y_TO_RGB_WEIGHT, Base::YUV_TO_BGR_ROUND_TERM);
+        const __m512i K16_VR_0 = SIMD_MM512_SET2_EPI16(Base::V_TO_RED_WEIGHT, 0);
+        const __m512i K16_UG_VG = SIMD_MM512_SET2_EPI16(Base::U_TO_GREEN_WEIGHT, Base::V_TO_GREEN_WEIGHT);
+        const __m512i K16_UB_0 = SIMD_MM512_SET2_EPI16(Base::U_TO_BLUE_WEIGHT, 0);
+    }
+#endif// SIMD_AVX512BW_INLINE_ENABLE
+
 #ifdef SIMD_VMX_ENABLE    
     namespace Vmx
     {
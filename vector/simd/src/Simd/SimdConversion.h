@@ -28,6 +28,7 @@
 #include "Simd/SimdConst.h"
 #include "Simd/SimdMath.h"
 #include "Simd/SimdLoad.h"
+#include "Simd/SimdStore.h"
 
 namespace Simd
 {
@@ -581,6 +582,87 @@ namespace Simd
 	}
 #endif//SIMD_SSSE3_ENABLE
 
+#ifdef SIMD_SSE41_ENABLE    
+    namespace Sse41
+    {
+        /*
+        * Truncated scale*dividend/divisor of 16-bit lanes (dividend >= 0, divisor > 0), as int(scale*dividend/divisor) of Base.
+        * The quotients of the HSL/HSV conversions are 0 or at least 1/510 away from the next integer. With the 0.001 bias 
+        * Div<1> (reciprocal estimate and a Newton-Raphson step, relative error < 1e-6) therefore truncates exactly as the 
+        * division does, while Div<0> (the estimate alone, relative error < 4e-4) is at most 1 off.
+        */
+        template <int iter> SIMD_INLINE __m128i ScaledQuotient32(__m128i dividend, __m128i divisor, const __m128 & scale)
+        {
+            __m128 quotient = Div<iter>(_mm_mul_ps(scale, _mm_cvtepi32_ps(dividend)), _mm_cvtepi32_ps(divisor));
+            return _mm_cvttps_epi32(_mm_add_ps(quotient, _mm_set1_ps(0.001f)));
+        }
+
+        template <int iter> SIMD_INLINE __m128i ScaledQuotient16(__m128i dividend, __m128i divisor, const __m128 & scale)
+        {
+            __m128i lo = ScaledQuotient32<iter>(_mm_unpacklo_epi16(dividend, K_ZERO), _mm_unpacklo_epi16(divisor, K_ZERO), scale);
+            __m128i hi = ScaledQuotient32<iter>(_mm_unpackhi_epi16(dividend, K_ZERO), _mm_unpackhi_epi16(divisor, K_ZERO), scale);
+            return _mm_packs_epi32(lo, hi);
+        }
+
+        template <int iter> SIMD_INLINE __m128i BgrToHue16(__m128i blue, __m128i green, __m128i red, __m128i max, __m128i range)
+        {
+            const __m128i redMaxMask = _mm_cmpeq_epi16(red, max);
+            const __m128i greenMaxMask = _mm_andnot_si128(redMaxMask, _mm_cmpeq_epi16(green, max));
+            const __m128i blueMaxMask = _mm_andnot_si128(redMaxMask, _mm_andnot_si128(greenMaxMask, K_INV_ZERO));
+
+            const __m128i redMaxCase = _mm_and_si128(redMaxMask,
+                _mm_add_epi16(_mm_sub_epi16(green, blue), _mm_mullo_epi16(range, K16_0006)));
+            const __m128i greenMaxCase = _mm_and_si128(greenMaxMask,
+                _mm_add_epi16(_mm_sub_epi16(blue, red), _mm_mullo_epi16(range, K16_0002)));
+            const __m128i blueMaxCase = _mm_and_si128(blueMaxMask,
+                _mm_add_epi16(_mm_sub_epi16(red, green), _mm_mullo_epi16(range, K16_0004)));
+
+            const __m128i dividend = _mm_or_si128(_mm_or_si128(redMaxCase, greenMaxCase), blueMaxCase);
+
+            return _mm_and_si128(ScaledQuotient16<iter>(dividend, _mm_max_epi16(range, K16_0001), _mm_set1_ps(Base::KF_255_DIV_6)), K16_00FF);
+        }
+
+        template <int iter> SIMD_INLINE void BgrToHsv16(__m128i blue, __m128i green, __m128i red, __m128i * hsv)
+        {
+            const __m128i max = MaxI16(red, green, blue);
+            const __m128i range = _mm_sub_epi16(max, MinI16(red, green, blue));
+            hsv[0] = BgrToHue16<iter>(blue, green, red, max, range);
+            hsv[1] = ScaledQuotient16<iter>(range, _mm_max_epi16(max, K16_0001), _mm_set1_ps(255.0f));
+            hsv[2] = max;
+        }
+
+        template <int iter> SIMD_INLINE void BgrToHsl16(__m128i blue, __m128i green, __m128i red, __m128i * hsl)
+        {
+            const __m128i max = MaxI16(red, green, blue);
+            const __m128i min = MinI16(red, green, blue);
+            const __m128i range = _mm_sub_epi16(max, min);
+            const __m128i sum = _mm_add_epi16(max, min);
+            const __m128i divisor = _mm_min_epi16(sum, _mm_sub_epi16(_mm_set1_epi16(510), sum));
+            hsl[0] = BgrToHue16<iter>(blue, green, red, max, range);
+            hsl[1] = ScaledQuotient16<iter>(range, _mm_max_epi16(divisor, K16_0001), _mm_set1_ps(255.0f));
+            hsl[2] = _mm_srli_epi16(sum, 1);
+        }
+
+        template <int iter> SIMD_INLINE void BgrToHsv8(__m128i blue, __m128i green, __m128i red, __m128i * hsv)
+        {
+            __m128i lo[3], hi[3];
+            BgrToHsv16<iter>(_mm_unpacklo_epi8(blue, K_ZERO), _mm_unpacklo_epi8(green, K_ZERO), _mm_unpacklo_epi8(red, K_ZERO), lo);
+            BgrToHsv16<iter>(_mm_unpackhi_epi8(blue, K_ZERO), _mm_unpackhi_epi8(green, K_ZERO), _mm_unpackhi_epi8(red, K_ZERO), hi);
+            for (size_t i = 0; i < 3; ++i)
+                hsv[i] = _mm_packus_epi16(lo[i], hi[i]);
+        }
+
+        template <int iter> SIMD_INLINE void BgrToHsl8(__m128i blue, __m128i green, __m128i red, __m128i * hsl)
+        {
+            __m128i lo[3], hi[3];
+            BgrToHsl16<iter>(_mm_unpacklo_epi8(blue, K_ZERO), _mm_unpacklo_epi8(green, K_ZERO), _mm_unpacklo_epi8(red, K_ZERO), lo);
+            BgrToHsl16<iter>(_mm_unpackhi_epi8(blue, K_ZERO), _mm_unpackhi_epi8(green, K_ZERO), _mm_unpackhi_epi8(red, K_ZERO), hi);
+            for (size_t i = 0; i < 3; ++i)
+                hsl[i] = _mm_packus_epi16(lo[i], hi[i]);
+        }
+    }
+#endif// SIMD_SSE41_ENABLE
+
 #ifdef SIMD_AVX2_ENABLE    
     namespace Avx2
     {
@@ -812,9 +894,332 @@ namespace Simd
         {
             return _mm256_or_si256(_mm256_shuffle_epi8(_mm256_permute4x64_epi64(bgr, 0xE9), K8_BGRA_TO_BGR_SHUFFLE), alpha);
         }
+
+        SIMD_INLINE void BgraToBgr(const __m256i bgra[4], __m256i bgr[3])
+        {
+            __m256i bgr0 = _mm256_shuffle_epi8(bgra[0], K8_SHUFFLE_BGRA_TO_BGR);
+            __m256i bgr1 = _mm256_shuffle_epi8(bgra[1], K8_SHUFFLE_BGRA_TO_BGR);
+            __m256i bgr2 = _mm256_shuffle_epi8(bgra[2], K8_SHUFFLE_BGRA_TO_BGR);
+            __m256i bgr3 = _mm256_shuffle_epi8(bgra[3], K8_SHUFFLE_BGRA_TO_BGR);
+            bgr[0] = _mm256_blend_epi32(_mm256_permutevar8x32_epi32(bgr0, K32_PERMUTE_BGRA_TO_BGR_0), 
+                _mm256_permutevar8x32_epi32(bgr1, K32_PERMUTE_BGRA_TO_BGR_0), 0xC0);
+            bgr[1] = _mm256_blend_epi32(_mm256_permutevar8x32_epi32(bgr1, K32_PERMUTE_BGRA_TO_BGR_1), 
+                _mm256_permutevar8x32_epi32(bgr2, K32_PERMUTE_BGRA_TO_BGR_1), 0xF0);
+            bgr[2] = _mm256_blend_epi32(_mm256_permutevar8x32_epi32(bgr2, K32_PERMUTE_BGRA_TO_BGR_2), 
+                _mm256_permutevar8x32_epi32(bgr3, K32_PERMUTE_BGRA_TO_BGR_2), 0xFC);
+        }
+
+        SIMD_INLINE __m256i Average(const __m256i & a, const __m256i & b)
+        {
+            return _mm256_avg_epu16(a, b);
+        }
+
+        SIMD_INLINE __m256i Average(const __m256i & a, const __m256i & b, const __m256i & c, const __m256i & d)
+        {
+            return _mm256_srli_epi16(_mm256_add_epi16(_mm256_add_epi16(_mm256_add_epi16(a, b), _mm256_add_epi16(c, d)), K16_0002), 2);
+        }
+
+        SIMD_INLINE __m256i BayerToGreen(const __m256i & greenLeft, const __m256i & greenTop, const __m256i & greenRight, const __m256i & greenBottom, 
+            const __m256i & blueOrRedLeft, const __m256i & blueOrRedTop, const __m256i & blueOrRedRight, const __m256i & blueOrRedBottom)
+        {
+            __m256i verticalAbsDifference = _mm256_abs_epi16(_mm256_sub_epi16(blueOrRedTop, blueOrRedBottom));
+            __m256i horizontalAbsDifference = _mm256_abs_epi16(_mm256_sub_epi16(blueOrRedLeft, blueOrRedRight));
+            __m256i green = Average(greenLeft, greenTop, greenRight, greenBottom);
+            green = _mm256_blendv_epi8(green, Average(greenTop, greenBottom), _mm256_cmpgt_epi16(horizontalAbsDifference, verticalAbsDifference));
+            return _mm256_blendv_epi8(green, Average(greenRight, greenLeft), _mm256_cmpgt_epi16(verticalAbsDifference, horizontalAbsDifference));
+        }
+
+        /*
+        * s[row][i] holds the pixels of src[row] at columns col - 2 + i + 2*k (k = 0..15) as 16-bit values,
+        * so s[row][0..5] play the role of col0..col5 of Base::BayerToBgr for 16 quads at once.
+        */
+        SIMD_INLINE void LoadBayer(const uint8_t * src, __m256i s[6])
+        {
+            __m256i left = _mm256_loadu_si256((__m256i*)(src - 2));
+            __m256i center = _mm256_loadu_si256((__m256i*)src);
+            __m256i right = _mm256_loadu_si256((__m256i*)(src + 2));
+            s[0] = _mm256_and_si256(left, K16_00FF);
+            s[1] = _mm256_srli_epi16(left, 8);
+            s[2] = _mm256_and_si256(center, K16_00FF);
+            s[3] = _mm256_srli_epi16(center, 8);
+            s[4] = _mm256_and_si256(right, K16_00FF);
+            s[5] = _mm256_srli_epi16(right, 8);
+        }
+
+        template <SimdPixelFormatType bayerFormat> void BayerToBgr(const __m256i s[6][6], 
+            __m256i * dst00, __m256i * dst01, __m256i * dst10, __m256i * dst11);
+
+        template <> SIMD_INLINE void BayerToBgr<SimdPixelFormatBayerGrbg>(const __m256i s[6][6], 
+            __m256i * dst00, __m256i * dst01, __m256i * dst10, __m256i * dst11)
+        {
+            dst00[0] = Average(s[1][2], s[3][2]);
+            dst00[1] = s[2][2];
+            dst00[2] = Average(s[2][1], s[2][3]);
+
+            dst01[0] = Average(s[1][2], s[1][4], s[3][2], s[3][4]);
+            dst01[1] = BayerToGreen(s[2][2], s[1][3], s[2][4], s[3][3], s[2][1], s[0][3], s[2][5], s[4][3]);
+            dst01[2] = s[2][3];
+
+            dst10[0] = s[3][2];
+            dst10[1] = BayerToGreen(s[3][1], s[2][2], s[3][3], s[4][2], s[3][0], s[1][2], s[3][4], s[5][2]);
+            dst10[2] = Average(s[2][1], s[2][3], s[4][1], s[4][3]);
+
+            dst11[0] = Average(s[3][2], s[3][4]);
+            dst11[1] = s[3][3];
+            dst11[2] = Average(s[2][3], s[4][3]);
+        }
+
+        template <> SIMD_INLINE void BayerToBgr<SimdPixelFormatBayerGbrg>(const __m256i s[6][6], 
+            __m256i * dst00, __m256i * dst01, __m256i * dst10, __m256i * dst11)
+        {
+            dst00[0] = Average(s[2][1], s[2][3]);
+            dst00[1] = s[2][2];
+            dst00[2] = Average(s[1][2], s[3][2]);
+
+            dst01[0] = s[2][3];
+            dst01[1] = BayerToGreen(s[2][2], s[1][3], s[2][4], s[3][3], s[2][1], s[0][3], s[2][5], s[4][3]);
+            dst01[2] = Average(s[1][2], s[1][4], s[3][2], s[3][4]);
+
+            dst10[0] = Average(s[2][1], s[2][3], s[4][1], s[4][3]);
+            dst10[1] = BayerToGreen(s[3][1], s[2][2], s[3][3], s[4][2], s[3][0], s[1][2], s[3][4], s[5][2]);
+            dst10[2] = s[3][2];
+
+            dst11[0] = Average(s[2][3], s[4][3]);
+            dst11[1] = s[3][3];
+            dst11[2] = Average(s[3][2], s[3][4]);
+        }
+
+        template <> SIMD_INLINE void BayerToBgr<SimdPixelFormatBayerRggb>(const __m256i s[6][6], 
+            __m256i * dst00, __m256i * dst01, __m256i * dst10, __m256i * dst11)
+        {
+            dst00[0] = Average(s[1][1], s[1][3], s[3][1], s[3][3]);
+            dst00[1] = BayerToGreen(s[2][1], s[1][2], s[2][3], s[3][2], s[2][0], s[0][2], s[2][4], s[4][2]);
+            dst00[2] = s[2][2];
+
+            dst01[0] = Average(s[1][3], s[3][3]);
+            dst01[1] = s[2][3];
+            dst01[2] = Average(s[2][2], s[2][4]);
+
+            dst10[0] = Average(s[3][1], s[3][3]);
+            dst10[1] = s[3][2];
+            dst10[2] = Average(s[2][2], s[4][2]);
+
+            dst11[0] = s[3][3];
+            dst11[1] = BayerToGreen(s[3][2], s[2][3], s[3][4], s[4][3], s[3][1], s[1][3], s[3][5], s[5][3]);
+            dst11[2] = Average(s[2][2], s[2][4], s[4][2], s[4][4]);
+        }
+
+        template <> SIMD_INLINE void BayerToBgr<SimdPixelFormatBayerBggr>(const __m256i s[6][6], 
+            __m256i * dst00, __m256i * dst01, __m256i * dst10, __m256i * dst11)
+        {
+            dst00[0] = s[2][2];
+            dst00[1] = BayerToGreen(s[2][1], s[1][2], s[2][3], s[3][2], s[2][0], s[0][2], s[2][4], s[4][2]);
+            dst00[2] = Average(s[1][1], s[1][3], s[3][1], s[3][3]);
+
+            dst01[0] = Average(s[2][2], s[2][4]);
+            dst01[1] = s[2][3];
+            dst01[2] = Average(s[1][3], s[3][3]);
+
+            dst10[0] = Average(s[2][2], s[4][2]);
+            dst10[1] = s[3][2];
+            dst10[2] = Average(s[3][1], s[3][3]);
+
+            dst11[0] = Average(s[2][2], s[2][4], s[4][2], s[4][4]);
+            dst11[1] = BayerToGreen(s[3][2], s[2][3], s[3][4], s[4][3], s[3][1], s[1][3], s[3][5], s[5][3]);
+            dst11[2] = s[3][3];
+        }
+
+        /*
+        * Demosaics the A columns starting at col (even) of the two rows src[2] and src[3]. 
+        * dst[0..2] and dst[3..5] get the blue, green and red planes of the upper and the lower row.
+        */
+        template <SimdPixelFormatType bayerFormat> SIMD_INLINE void BayerToBgr(const uint8_t * src[6], size_t col, __m256i dst[6])
+        {
+            __m256i s[6][6], d00[3], d01[3], d10[3], d11[3];
+            for (size_t row = 0; row < 6; ++row)
+                LoadBayer(src[row] + col, s[row]);
+            BayerToBgr<bayerFormat>(s, d00, d01, d10, d11);
+            for (size_t i = 0; i < 3; ++i)
+            {
+                dst[i] = _mm256_or_si256(d00[i], _mm256_slli_epi16(d01[i], 8));
+                dst[i + 3] = _mm256_or_si256(d10[i], _mm256_slli_epi16(d11[i], 8));
+            }
+        }
+
+        template <int iter> SIMD_INLINE __m256i ScaledQuotient32(__m256i dividend, __m256i divisor, const __m256 & scale)
+        {
+            __m256 quotient = Div<iter>(_mm256_mul_ps(scale, _mm256_cvtepi32_ps(dividend)), _mm256_cvtepi32_ps(divisor));
+            return _mm256_cvttps_epi32(_mm256_add_ps(quotient, _mm256_set1_ps(0.001f)));
+        }
+
+        template <int iter> SIMD_INLINE __m256i ScaledQuotient16(__m256i dividend, __m256i divisor, const __m256 & scale)
+        {
+            __m256i lo = ScaledQuotient32<iter>(_mm256_unpacklo_epi16(dividend, K_ZERO), _mm256_unpacklo_epi16(divisor, K_ZERO), scale);
+            __m256i hi = ScaledQuotient32<iter>(_mm256_unpackhi_epi16(dividend, K_ZERO), _mm256_unpackhi_epi16(divisor, K_ZERO), scale);
+            return _mm256_packs_epi32(lo, hi);
+        }
+
+        template <int iter> SIMD_INLINE __m256i BgrToHue16(__m256i blue, __m256i green, __m256i red, __m256i max, __m256i range)
+        {
+            const __m256i redMaxMask = _mm256_cmpeq_epi16(red, max);
+            const __m256i greenMaxMask = _mm256_andnot_si256(redMaxMask, _mm256_cmpeq_epi16(green, max));
+            const __m256i blueMaxMask = _mm256_andnot_si256(redMaxMask, _mm256_andnot_si256(greenMaxMask, K_INV_ZERO));
+
+            const __m256i redMaxCase = _mm256_and_si256(redMaxMask,
+                _mm256_add_epi16(_mm256_sub_epi16(green, blue), _mm256_mullo_epi16(range, K16_0006)));
+            const __m256i greenMaxCase = _mm256_and_si256(greenMaxMask,
+                _mm256_add_epi16(_mm256_sub_epi16(blue, red), _mm256_mullo_epi16(range, K16_0002)));
+            const __m256i blueMaxCase = _mm256_and_si256(blueMaxMask,
+                _mm256_add_epi16(_mm256_sub_epi16(red, green), _mm256_mullo_epi16(range, K16_0004)));
+
+            const __m256i dividend = _mm256_or_si256(_mm256_or_si256(redMaxCase, greenMaxCase), blueMaxCase);
+
+            return _mm256_and_si256(ScaledQuotient16<iter>(dividend, _mm256_max_epi16(range, K16_0001), _mm256_set1_ps(Base::KF_255_DIV_6)), K16_00FF);
+        }
+
+        template <int iter> SIMD_INLINE void BgrToHsv16(__m256i blue, __m256i green, __m256i red, __m256i * hsv)
+        {
+            const __m256i max = MaxI16(red, green, blue);
+            const __m256i range = _mm256_sub_epi16(max, MinI16(red, green, blue));
+            hsv[0] = BgrToHue16<iter>(blue, green, red, max, range);
+            hsv[1] = ScaledQuotient16<iter>(range, _mm256_max_epi16(max, K16_0001), _mm256_set1_ps(255.0f));
+            hsv[2] = max;
+        }
+
+        template <int iter> SIMD_INLINE void BgrToHsl16(__m256i blue, __m256i green, __m256i red, __m256i * hsl)
+        {
+            const __m256i max = MaxI16(red, green, blue);
+            const __m256i min = MinI16(red, green, blue);
+            const __m256i range = _mm256_sub_epi16(max, min);
+            const __m256i sum = _mm256_add_epi16(max, min);
+            const __m256i divisor = _mm256_min_epi16(sum, _mm256_sub_epi16(_mm256_set1_epi16(510), sum));
+            hsl[0] = BgrToHue16<iter>(blue, green, red, max, range);
+            hsl[1] = ScaledQuotient16<iter>(range, _mm256_max_epi16(divisor, K16_0001), _mm256_set1_ps(255.0f));
+            hsl[2] = _mm256_srli_epi16(sum, 1);
+        }
+
+        template <int iter> SIMD_INLINE void BgrToHsv8(__m256i blue, __m256i green, __m256i red, __m256i * hsv)
+        {
+            __m256i lo[3], hi[3];
+            BgrToHsv16<iter>(_mm256_unpacklo_epi8(blue, K_ZERO), _mm256_unpacklo_epi8(green, K_ZERO), _mm256_unpacklo_epi8(red, K_ZERO), lo);
+            BgrToHsv16<iter>(_mm256_unpackhi_epi8(blue, K_ZERO), _mm256_unpackhi_epi8(green, K_ZERO), _mm256_unpackhi_epi8(red, K_ZERO), hi);
+            for (size_t i = 0; i < 3; ++i)
+                hsv[i] = _mm256_packus_epi16(lo[i], hi[i]);
+        }
+
+        template <int iter> SIMD_INLINE void BgrToHsl8(__m256i blue, __m256i green, __m256i red, __m256i * hsl)
+        {
+            __m256i lo[3], hi[3];
+            BgrToHsl16<iter>(_mm256_unpacklo_epi8(blue, K_ZERO), _mm256_unpacklo_epi8(green, K_ZERO), _mm256_unpacklo_epi8(red, K_ZERO), lo);
+            BgrToHsl16<iter>(_mm256_unpackhi_epi8(blue, K_ZERO), _mm256_unpackhi_epi8(green, K_ZERO), _mm256_unpackhi_epi8(red, K_ZERO), hi);
+            for (size_t i = 0; i < 3; ++i)
+                hsl[i] = _mm256_packus_epi16(lo[i], hi[i]);
+        }
     }
 #endif// SIMD_AVX2_ENABLE
 
+#ifdef SIMD_AVX512BW_INLINE_ENABLE
+    namespace Avx512bw
+    {
+        SIMD_INLINE __m512i AdjustY16(__m512i y16)
+        {
+            return _mm512_subs_epi16(y16, K16_Y_ADJUST);
+        }
+
+        SIMD_INLINE __m512i AdjustUV16(__m512i uv16)
+        {
+            return _mm512_subs_epi16(uv16, K16_UV_ADJUST);
+        }
+
+        SIMD_INLINE __m512i AdjustedYuvToRed32(__m512i y16_1, __m512i v16_0)
+        {
+            return _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(y16_1, K16_YRGB_RT),
+                _mm512_madd_epi16(v16_0, K16_VR_0)), Base::YUV_TO_BGR_AVERAGING_SHIFT);
+        }
+
+        SIMD_INLINE __m512i AdjustedYuvToRed16(__m512i y16, __m512i v16)
+        {
+            return SaturateI16ToU8(_mm512_packs_epi32(
+                AdjustedYuvToRed32(_mm512_unpacklo_epi16(y16, K16_0001), _mm512_unpacklo_epi16(v16, K_ZERO)),
+                AdjustedYuvToRed32(_mm512_unpackhi_epi16(y16, K16_0001), _mm512_unpackhi_epi16(v16, K_ZERO))));
+        }
+
+        SIMD_INLINE __m512i AdjustedYuvToGreen32(__m512i y16_1, __m512i u16_v16)
+        {
+            return _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(y16_1, K16_YRGB_RT),
+                _mm512_madd_epi16(u16_v16, K16_UG_VG)), Base::YUV_TO_BGR_AVERAGING_SHIFT);
+        }
+
+        SIMD_INLINE __m512i AdjustedYuvToGreen16(__m512i y16, __m512i u16, __m512i v16)
+        {
+            return SaturateI16ToU8(_mm512_packs_epi32(
+                AdjustedYuvToGreen32(_mm512_unpacklo_epi16(y16, K16_0001), _mm512_unpacklo_epi16(u16, v16)),
+                AdjustedYuvToGreen32(_mm512_unpackhi_epi16(y16, K16_0001), _mm512_unpackhi_epi16(u16, v16))));
+        }
+
+        SIMD_INLINE __m512i AdjustedYuvToBlue32(__m512i y16_1, __m512i u16_0)
+        {
+            return _mm512_srai_epi32(_mm512_add_epi32(_mm512_madd_epi16(y16_1, K16_YRGB_RT),
+                _mm512_madd_epi16(u16_0, K16_UB_0)), Base::YUV_TO_BGR_AVERAGING_SHIFT);
+        }
+
+        SIMD_INLINE __m512i AdjustedYuvToBlue16(__m512i y16, __m512i u16)
+        {
+            return SaturateI16ToU8(_mm512_packs_epi32(
+                AdjustedYuvToBlue32(_mm512_unpacklo_epi16(y16, K16_0001), _mm512_unpacklo_epi16(u16, K_ZERO)),
+                AdjustedYuvToBlue32(_mm512_unpackhi_epi16(y16, K16_0001), _mm512_unpackhi_epi16(u16, K_ZERO))));
+        }
+
+        template <int part> SIMD_INLINE __m512i ExtendU8ToU16(__m512i a)
+        {
+            return _mm512_cvtepu8_epi16(_mm512_extracti64x4_epi64(a, part));
+        }
+
+        template <int part> SIMD_INLINE __m512i DuplicateU8ToU16(__m512i a)
+        {
+            __m512i a32 = _mm512_cvtepu8_epi32(_mm512_extracti32x4_epi32(a, part));
+            return _mm512_or_si512(a32, _mm512_slli_epi32(a32, 16));
+        }
+
+        SIMD_INLINE void AdjustedYuv16ToBgra(__m512i y16, __m512i u16, __m512i v16, const __m512i & a_0, __m512i & bgra0, __m512i & bgra1)
+        {
+            const __m512i b16 = AdjustedYuvToBlue16(y16, u16);
+            const __m512i g16 = AdjustedYuvToGreen16(y16, u16, v16);
+            const __m512i r16 = AdjustedYuvToRed16(y16, v16);
+            const __m512i bg8 = _mm512_or_si512(b16, _mm512_slli_epi16(g16, 8));
+            const __m512i ra8 = _mm512_or_si512(r16, a_0);
+            bgra0 = _mm512_unpacklo_epi16(bg8, ra8);
+            bgra1 = _mm512_unpackhi_epi16(bg8, ra8);
+            Permute4x128(bgra0, bgra1);
+        }
+
+        SIMD_INLINE void BgraToBgr(const __m512i bgra[4], __m512i bgr[3])
+        {
+            const __m512i k = _mm512_broadcast_i32x4(_mm_setr_epi8(0x0, 0x1, 0x2, 0x4, 0x5, 0x6, 0x8, 0x9, 0xA, 0xC, 0xD, 0xE, -1, -1, -1, -1));
+            __m512i bgr0 = _mm512_shuffle_epi8(bgra[0], k);
+            __m512i bgr1 = _mm512_shuffle_epi8(bgra[1], k);
+            __m512i bgr2 = _mm512_shuffle_epi8(bgra[2], k);
+            __m512i bgr3 = _mm512_shuffle_epi8(bgra[3], k);
+            bgr[0] = _mm512_permutex2var_epi32(bgr0, _mm512_setr_epi32(0x00, 0x01, 0x02, 0x04, 0x05, 0x06, 0x08, 0x09, 0x0A, 0x0C, 0x0D, 0x0E, 0x10, 0x11, 0x12, 0x14), bgr1);
+            bgr[1] = _mm512_permutex2var_epi32(bgr1, _mm512_setr_epi32(0x05, 0x06, 0x08, 0x09, 0x0A, 0x0C, 0x0D, 0x0E, 0x10, 0x11, 0x12, 0x14, 0x15, 0x16, 0x18, 0x19), bgr2);
+            bgr[2] = _mm512_permutex2var_epi32(bgr2, _mm512_setr_epi32(0x0A, 0x0C, 0x0D, 0x0E, 0x10, 0x11, 0x12, 0x14, 0x15, 0x16, 0x18, 0x19, 0x1A, 0x1C, 0x1D, 0x1E), bgr3);
+        }
+
+        SIMD_INLINE void BgrToBgra(const __m512i bgr[3], const __m512i & alpha, __m512i bgra[4])
+        {
+            const __m512i k = _mm512_broadcast_i32x4(_mm_setr_epi8(0x0, 0x1, 0x2, -1, 0x3, 0x4, 0x5, -1, 0x6, 0x7, 0x8, -1, 0x9, 0xA, 0xB, -1));
+            bgra[0] = _mm512_or_si512(_mm512_shuffle_epi8(_mm512_permutexvar_epi32(
+                _mm512_setr_epi32(0x00, 0x01, 0x02, 0x00, 0x03, 0x04, 0x05, 0x00, 0x06, 0x07, 0x08, 0x00, 0x09, 0x0A, 0x0B, 0x00), bgr[0]), k), alpha);
+            bgra[1] = _mm512_or_si512(_mm512_shuffle_epi8(_mm512_permutex2var_epi32(bgr[0], 
+                _mm512_setr_epi32(0x0C, 0x0D, 0x0E, 0x00, 0x0F, 0x10, 0x11, 0x00, 0x12, 0x13, 0x14, 0x00, 0x15, 0x16, 0x17, 0x00), bgr[1]), k), alpha);
+            bgra[2] = _mm512_or_si512(_mm512_shuffle_epi8(_mm512_permutex2var_epi32(bgr[1], 
+                _mm512_setr_epi32(0x08, 0x09, 0x0A, 0x00, 0x0B, 0x0C, 0x0D, 0x00, 0x0E, 0x0F, 0x10, 0x00, 0x11, 0x12, 0x13, 0x00), bgr[2]), k), alpha);
+            bgra[3] = _mm512_or_si512(_mm512_shuffle_epi8(_mm512_permutexvar_epi32(
+                _mm512_setr_epi32(0x04, 0x05, 0x06, 0x00, 0x07, 0x08, 0x09, 0x00, 0x0A, 0x0B, 0x0C, 0x00, 0x0D, 0x0E, 0x0F, 0x00), bgr[2]), k), alpha);
+        }
+    }
+#endif// SIMD_AVX512BW_INLINE_ENABLE
+
 #ifdef SIMD_VMX_ENABLE    
     namespace Vmx
     {
@@ -86,6 +86,23 @@
 #define SIMD_AVX2_ENABLE
 #endif
 
+#if defined(NDEBUG) && !defined(SIMD_AVX512F_DISABLE) && _MSC_VER >= 1900
+#define SIMD_AVX512F_ENABLE
+#endif
+
+#if defined(NDEBUG) && !defined(SIMD_AVX512BW_DISABLE) && _MSC_VER >= 1900
+#define SIMD_AVX512BW_ENABLE
+#define SIMD_AVX512BW_INLINE_ENABLE
+#endif
+
+#if !defined(SIMD_PCLMUL_DISABLE) && _MSC_VER >= 1500
+#define SIMD_PCLMUL_ENABLE
+#endif
+
+#if defined(NDEBUG) && !defined(SIMD_VPCLMULQDQ_DISABLE) && _MSC_VER >= 1920
+#define SIMD_VPCLMULQDQ_ENABLE
+#endif
+
 #if defined(NDEBUG) && _MSC_VER >= 1700 && _MSC_VER < 1900
 #define SIMD_MADDUBS_ERROR // Visual Studio 2012/2013 release mode compiler bug in function _mm256_maddubs_epi16:
 #endif
@@ -170,6 +187,28 @@
 #define SIMD_AVX2_ENABLE
 #endif
 
+#if !defined(SIMD_AVX512F_DISABLE) && defined(__AVX512F__)
+#define SIMD_AVX512F_ENABLE
+#endif
+
+#if !defined(SIMD_AVX512BW_DISABLE) && defined(__AVX512BW__)
+#define SIMD_AVX512BW_ENABLE
+#endif
+
+#if !defined(SIMD_PCLMUL_DISABLE) && defined(__PCLMUL__)
+#define SIMD_PCLMUL_ENABLE
+#endif
+
+#if !defined(SIMD_VPCLMULQDQ_DISABLE) && defined(__VPCLMULQDQ__)
+#define SIMD_VPCLMULQDQ_ENABLE
+#endif
+
+// The dispatcher may be built with -DSIMD_AVX512BW_ENABLE only, to call the Avx512bw functions without
+// targeting AVX-512 itself. The inline helpers taking or returning 512-bit vectors need the target.
+#if defined(SIMD_AVX512BW_ENABLE) && defined(__AVX512BW__)
+#define SIMD_AVX512BW_INLINE_ENABLE
+#endif
+
 #endif//defined(SIMD_X86_ENABLE) || defined(SIMD_X64_ENABLE)
 
 #if defined(SIMD_PPC_ENABLE) || defined(SIMD_PPC64_ENABLE)
@@ -234,7 +273,11 @@
 #include <nmmintrin.h>
 #endif
 
-#if defined(SIMD_AVX_ENABLE) || defined(SIMD_AVX2_ENABLE)
+#ifdef SIMD_PCLMUL_ENABLE
+#include <wmmintrin.h>
+#endif
+
+#if defined(SIMD_AVX_ENABLE) || defined(SIMD_AVX2_ENABLE) || defined(SIMD_AVX512F_ENABLE) || defined(SIMD_AVX512BW_ENABLE)
 #include <immintrin.h>
 #endif
 
@@ -252,7 +295,9 @@
 #include <arm_neon.h>
 #endif
 
-#if defined(SIMD_AVX_ENABLE) || defined(SIMD_AVX2_ENABLE)
+#if defined(SIMD_AVX512F_ENABLE) || defined(SIMD_AVX512BW_ENABLE)
+#define SIMD_ALIGN 64
+#elif defined(SIMD_AVX_ENABLE) || defined(SIMD_AVX2_ENABLE)
 #define SIMD_ALIGN 32
 #elif defined(SIMD_SSE_ENABLE) || defined(SIMD_SSE2_ENABLE) || defined(SIMD_SSE3_ENABLE)  || defined(SIMD_SSSE3_ENABLE) || defined(SIMD_SSE41_ENABLE) || defined(SIMD_SSE42_ENABLE) \
     || defined(SIMD_VMX_ENABLE) || defined(SIMD_VSX_ENABLE) \
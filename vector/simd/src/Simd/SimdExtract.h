@@ -158,6 +158,37 @@ namespace Simd
     }
 #endif// SIMD_AVX2_ENABLE
 
+#ifdef SIMD_AVX512BW_INLINE_ENABLE
+    namespace Avx512bw
+    {
+        SIMD_INLINE float ExtractSum(__m512 a)
+        {
+            return _mm512_reduce_add_ps(a);
+        }
+
+        template <class T> SIMD_INLINE T ExtractSum(__m512i a)
+        {
+            const size_t size = A/sizeof(T);
+            T buffer[size];
+            _mm512_storeu_si512((__m512i*)buffer, a);
+            T sum = 0;
+            for(size_t i = 0; i < size; ++i)
+                sum += buffer[i];
+            return sum;
+        }
+
+        template <> SIMD_INLINE uint32_t ExtractSum<uint32_t>(__m512i a)
+        {
+            return (uint32_t)_mm512_reduce_add_epi32(a);
+        }
+
+        template <> SIMD_INLINE uint64_t ExtractSum<uint64_t>(__m512i a)
+        {
+            return (uint64_t)_mm512_reduce_add_epi64(a);
+        }
+    }
+#endif// SIMD_AVX512BW_INLINE_ENABLE
+
 #ifdef SIMD_VMX_ENABLE
     namespace Vmx
     {
@@ -50,6 +50,7 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD dwReasonForCall, LPVOID lpReserved)
 #include "Simd/SimdEnable.h"
 #include "Simd/SimdVersion.h"
 #include "Simd/SimdConst.h"
+#include "Simd/SimdParallel.hpp"
 
 #include "Simd/SimdBase.h"
 #include "Simd/SimdSse1.h"
@@ -60,6 +61,7 @@ BOOL APIENTRY DllMain(HMODULE hModule, DWORD dwReasonForCall, LPVOID lpReserved)
 #include "Simd/SimdSse42.h"
 #include "Simd/SimdAvx1.h"
 #include "Simd/SimdAvx2.h"
+#include "Simd/SimdAvx512bw.h"
 #include "Simd/SimdVmx.h"
 #include "Simd/SimdVsx.h"
 #include "Simd/SimdNeon.h"
@@ -91,8 +93,28 @@ SIMD_API size_t SimdAlignment()
     return Simd::ALIGNMENT;
 }
 
+SIMD_API void SimdSetThreadNumber(size_t threadNumber)
+{
+    ThreadNumber() = std::max<size_t>(std::min(threadNumber, ThreadPool::Global().Size()), 1);
+}
+
+SIMD_API size_t SimdGetThreadNumber()
+{
+    return ThreadNumber();
+}
+
 SIMD_API uint32_t SimdCrc32c(const void * src, size_t size)
 {
+#if defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_VPCLMULQDQ_ENABLE)
+    if(Avx512bw::VpclmulqdqEnable && size >= Avx512bw::QA)
+        return Avx512bw::Crc32c(src, size);
+    else
+#endif
+#if defined(SIMD_SSE42_ENABLE) && defined(SIMD_PCLMUL_ENABLE)
+    if(Sse42::PclmulEnable && size >= Sse42::QA)
+        return Sse42::Crc32cFolded(src, size);
+    else
+#endif
 #ifdef SIMD_SSE42_ENABLE
     if(Sse42::Enable)
         return Sse42::Crc32c(src, size);
@@ -104,6 +126,11 @@ SIMD_API uint32_t SimdCrc32c(const void * src, size_t size)
 SIMD_API void SimdAbsDifferenceSum(const uint8_t *a, size_t aStride, const uint8_t * b, size_t bStride,
                                    size_t width, size_t height, uint64_t * sum)
 {
+#ifdef SIMD_AVX512BW_ENABLE
+    if(Avx512bw::Enable && width >= Avx512bw::A)
+        Avx512bw::AbsDifferenceSum(a, aStride, b, bStride, width, height, sum);
+    else
+#endif
 #ifdef SIMD_AVX2_ENABLE
     if(Avx2::Enable && width >= Avx2::A)
         Avx2::AbsDifferenceSum(a, aStride, b, bStride, width, height, sum);
@@ -130,6 +157,11 @@ SIMD_API void SimdAbsDifferenceSum(const uint8_t *a, size_t aStride, const uint8
 SIMD_API void SimdAbsDifferenceSumMasked(const uint8_t *a, size_t aStride, const uint8_t *b, size_t bStride,
                                          const uint8_t *mask, size_t maskStride, uint8_t index, size_t width, size_t height, uint64_t * sum)
 {
+#ifdef SIMD_AVX512BW_ENABLE
+    if(Avx512bw::Enable && width >= Avx512bw::A)
+        Avx512bw::AbsDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
+    else
+#endif
 #ifdef SIMD_AVX2_ENABLE
     if(Avx2::Enable && width >= Avx2::A)
         Avx2::AbsDifferenceSumMasked(a, aStride, b, bStride, mask, maskStride, index, width, height, sum);
@@ -512,12 +544,22 @@ SIMD_API void SimdBackgroundInitMask(const uint8_t * src, size_t srcStride, size
 
 SIMD_API void SimdBayerToBgr(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgr, size_t bgrStride)
 {
-    Base::BayerToBgr(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::A + 4)
+        Avx2::BayerToBgr(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
+    else
+#endif
+        Base::BayerToBgr(bayer, width, height, bayerStride, bayerFormat, bgr, bgrStride);
 }
 
 SIMD_API void SimdBayerToBgra(const uint8_t * bayer, size_t width, size_t height, size_t bayerStride, SimdPixelFormatType bayerFormat, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
-    Base::BayerToBgra(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::A + 4)
+        Avx2::BayerToBgra(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
+    else
+#endif
+        Base::BayerToBgra(bayer, width, height, bayerStride, bayerFormat, bgra, bgraStride, alpha);
 }
 
 SIMD_API void SimdBgraToBayer(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bayer, size_t bayerStride, SimdPixelFormatType bayerFormat)
@@ -542,6 +584,16 @@ SIMD_API void SimdBgraToBayer(const uint8_t * bgra, size_t width, size_t height,
 
 SIMD_API void SimdBgraToBgr(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bgr, size_t bgrStride)
 {
+#ifdef SIMD_AVX512BW_ENABLE
+    if(Avx512bw::Enable && width >= Avx512bw::A)
+        Avx512bw::BgraToBgr(bgra, width, height, bgraStride, bgr, bgrStride);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::BgraToBgr(bgra, width, height, bgraStride, bgr, bgrStride);
+    else
+#endif
 #ifdef SIMD_SSSE3_ENABLE
     if(Ssse3::Enable && width >= Ssse3::A)
         Ssse3::BgraToBgr(bgra, width, height, bgraStride, bgr, bgrStride);
@@ -562,6 +614,11 @@ SIMD_API void SimdBgraToBgr(const uint8_t * bgra, size_t width, size_t height, s
 
 SIMD_API void SimdBgraToGray(const uint8_t *bgra, size_t width, size_t height, size_t bgraStride, uint8_t *gray, size_t grayStride)
 {
+#ifdef SIMD_AVX512BW_ENABLE
+    if(Avx512bw::Enable && width >= Avx512bw::A)
+        Avx512bw::BgraToGray(bgra, width, height, bgraStride, gray, grayStride);
+    else
+#endif
 #ifdef SIMD_AVX2_ENABLE
     if(Avx2::Enable && width >= Avx2::A)
         Avx2::BgraToGray(bgra, width, height, bgraStride, gray, grayStride);
@@ -692,6 +749,11 @@ SIMD_API void SimdBgrToBayer(const uint8_t * bgr, size_t width, size_t height, s
 
 SIMD_API void SimdBgrToBgra(const uint8_t *bgr, size_t width, size_t height, size_t bgrStride, uint8_t *bgra, size_t bgraStride, uint8_t alpha)
 {
+#ifdef SIMD_AVX512BW_ENABLE
+    if(Avx512bw::Enable && width >= Avx512bw::A)
+        Avx512bw::BgrToBgra(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
+    else
+#endif
 #if defined(SIMD_AVX2_ENABLE) && !defined(SIMD_CLANG_AVX2_BGR_TO_BGRA_ERROR)
     if(Avx2::Enable && width >= Avx2::A)
         Avx2::BgrToBgra(bgr, width, height, bgrStride, bgra, bgraStride, alpha);
@@ -718,6 +780,11 @@ SIMD_API void SimdBgrToBgra(const uint8_t *bgr, size_t width, size_t height, siz
 SIMD_API void SimdBgr48pToBgra32(const uint8_t * blue, size_t blueStride, size_t width, size_t height,
     const uint8_t * green, size_t greenStride, const uint8_t * red, size_t redStride, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
+#ifdef SIMD_AVX512BW_ENABLE
+    if(Avx512bw::Enable && width >= Avx512bw::HA)
+        Avx512bw::Bgr48pToBgra32(blue, blueStride, width, height, green, greenStride, red, redStride, bgra, bgraStride, alpha);
+    else
+#endif
 #ifdef SIMD_AVX2_ENABLE
     if(Avx2::Enable && width >= Avx2::HA)
         Avx2::Bgr48pToBgra32(blue, blueStride, width, height, green, greenStride, red, redStride, bgra, bgraStride, alpha);
@@ -773,12 +840,32 @@ SIMD_API void SimdBgrToGray(const uint8_t *bgr, size_t width, size_t height, siz
 
 SIMD_API void SimdBgrToHsl(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsl, size_t hslStride)
 {
-    Base::BgrToHsl(bgr, width, height, bgrStride, hsl, hslStride);
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::BgrToHsl(bgr, width, height, bgrStride, hsl, hslStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if(Sse41::Enable && width >= Sse41::A)
+        Sse41::BgrToHsl(bgr, width, height, bgrStride, hsl, hslStride);
+    else
+#endif
+        Base::BgrToHsl(bgr, width, height, bgrStride, hsl, hslStride);
 }
 
 SIMD_API void SimdBgrToHsv(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * hsv, size_t hsvStride)
 {
-    Base::BgrToHsv(bgr, width, height, bgrStride, hsv, hsvStride);
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::BgrToHsv(bgr, width, height, bgrStride, hsv, hsvStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if(Sse41::Enable && width >= Sse41::A)
+        Sse41::BgrToHsv(bgr, width, height, bgrStride, hsv, hsvStride);
+    else
+#endif
+        Base::BgrToHsv(bgr, width, height, bgrStride, hsv, hsvStride);
 }
 
 SIMD_API void SimdBgrToYuv420p(const uint8_t * bgr, size_t width, size_t height, size_t bgrStride, uint8_t * y, size_t yStride, uint8_t * u, size_t uStride, uint8_t * v, size_t vStride)
@@ -1547,6 +1634,15 @@ SIMD_API void SimdFillBgra(uint8_t * dst, size_t stride, size_t width, size_t he
 SIMD_API void SimdGaussianBlur3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                      size_t channelCount, uint8_t * dst, size_t dstStride)
 {
+    if(ParallelRows(src, srcStride, height, dst, dstStride, channelCount*width, 1, [=](const uint8_t * s, size_t h, uint8_t * d, size_t ds)
+        { SimdGaussianBlur3x3(s, srcStride, width, h, channelCount, d, ds); }))
+        return;
+
+#ifdef SIMD_AVX512BW_ENABLE
+    if(Avx512bw::Enable && (width - 1)*channelCount >= Avx512bw::A)
+        Avx512bw::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
+    else
+#endif
 #ifdef SIMD_AVX2_ENABLE
     if(Avx2::Enable && (width - 1)*channelCount >= Avx2::A)
         Avx2::GaussianBlur3x3(src, srcStride, width, height, channelCount, dst, dstStride);
@@ -1757,7 +1853,22 @@ SIMD_API void SimdIntegral(const uint8_t * src, size_t srcStride, size_t width,
                       uint8_t * sum, size_t sumStride, uint8_t * sqsum, size_t sqsumStride, uint8_t * tilted, size_t tiltedStride,
                       SimdPixelFormatType sumFormat, SimdPixelFormatType sqsumFormat)
 {
-    Base::Integral(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, tilted, tiltedStride, sumFormat, sqsumFormat);
+#ifdef SIMD_AVX512BW_ENABLE
+    if(Avx512bw::Enable)
+        Avx512bw::Integral(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, tilted, tiltedStride, sumFormat, sqsumFormat);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::HA)
+        Avx2::Integral(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, tilted, tiltedStride, sumFormat, sqsumFormat);
+    else
+#endif
+#ifdef SIMD_SSE2_ENABLE
+    if(Sse2::Enable && width >= Sse2::A)
+        Sse2::Integral(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, tilted, tiltedStride, sumFormat, sqsumFormat);
+    else
+#endif
+        Base::Integral(src, srcStride, width, height, sum, sumStride, sqsum, sqsumStride, tilted, tiltedStride, sumFormat, sqsumFormat);
 }
 
 SIMD_API void SimdInterferenceIncrement(uint8_t * statistic, size_t stride, size_t width, size_t height, uint8_t increment, int16_t saturation)
@@ -1931,6 +2042,10 @@ SIMD_API void SimdInterleaveBgra(const uint8_t * b, size_t bStride, const uint8_
 
 SIMD_API void SimdLaplace(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
+    if(ParallelRows(src, srcStride, height, dst, dstStride, 2*width, 1, [=](const uint8_t * s, size_t h, uint8_t * d, size_t ds)
+        { SimdLaplace(s, srcStride, width, h, d, ds); }))
+        return;
+
 #ifdef SIMD_AVX2_ENABLE
     if(Avx2::Enable && width > Avx2::A)
         Avx2::Laplace(src, srcStride, width, height, dst, dstStride);
@@ -1961,6 +2076,10 @@ SIMD_API void SimdLaplace(const uint8_t * src, size_t srcStride, size_t width, s
 
 SIMD_API void SimdLaplaceAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
+    if(ParallelRows(src, srcStride, height, dst, dstStride, 2*width, 1, [=](const uint8_t * s, size_t h, uint8_t * d, size_t ds)
+        { SimdLaplaceAbs(s, srcStride, width, h, d, ds); }))
+        return;
+
 #ifdef SIMD_AVX2_ENABLE
     if(Avx2::Enable && width > Avx2::A)
         Avx2::LaplaceAbs(src, srcStride, width, height, dst, dstStride);
@@ -2036,6 +2155,10 @@ SIMD_API void SimdLbpEstimate(const uint8_t * src, size_t srcStride, size_t widt
 
 SIMD_API void SimdMeanFilter3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
+    if(ParallelRows(src, srcStride, height, dst, dstStride, channelCount*width, 1, [=](const uint8_t * s, size_t h, uint8_t * d, size_t ds)
+        { SimdMeanFilter3x3(s, srcStride, width, h, channelCount, d, ds); }))
+        return;
+
 #ifdef SIMD_AVX2_ENABLE
 	if (Avx2::Enable && (width - 1)*channelCount >= Avx2::A)
 		Avx2::MeanFilter3x3(src, srcStride, width, height, channelCount, dst, dstStride);
@@ -2066,6 +2189,10 @@ SIMD_API void SimdMeanFilter3x3(const uint8_t * src, size_t srcStride, size_t wi
 
 SIMD_API void SimdMedianFilterRhomb3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
+    if(ParallelRows(src, srcStride, height, dst, dstStride, channelCount*width, 1, [=](const uint8_t * s, size_t h, uint8_t * d, size_t ds)
+        { SimdMedianFilterRhomb3x3(s, srcStride, width, h, channelCount, d, ds); }))
+        return;
+
 #ifdef SIMD_AVX2_ENABLE
     if(Avx2::Enable && (width - 1)*channelCount >= Avx2::A)
         Avx2::MedianFilterRhomb3x3(src, srcStride, width, height, channelCount, dst, dstStride);
@@ -2091,6 +2218,10 @@ SIMD_API void SimdMedianFilterRhomb3x3(const uint8_t * src, size_t srcStride, si
 
 SIMD_API void SimdMedianFilterRhomb5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
+    if(ParallelRows(src, srcStride, height, dst, dstStride, channelCount*width, 2, [=](const uint8_t * s, size_t h, uint8_t * d, size_t ds)
+        { SimdMedianFilterRhomb5x5(s, srcStride, width, h, channelCount, d, ds); }))
+        return;
+
 #ifdef SIMD_AVX2_ENABLE
     if(Avx2::Enable && (width - 2)*channelCount >= Avx2::A)
         Avx2::MedianFilterRhomb5x5(src, srcStride, width, height, channelCount, dst, dstStride);
@@ -2116,6 +2247,10 @@ SIMD_API void SimdMedianFilterRhomb5x5(const uint8_t * src, size_t srcStride, si
 
 SIMD_API void SimdMedianFilterSquare3x3(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
+    if(ParallelRows(src, srcStride, height, dst, dstStride, channelCount*width, 1, [=](const uint8_t * s, size_t h, uint8_t * d, size_t ds)
+        { SimdMedianFilterSquare3x3(s, srcStride, width, h, channelCount, d, ds); }))
+        return;
+
 #ifdef SIMD_AVX2_ENABLE
     if(Avx2::Enable && (width - 1)*channelCount >= Avx2::A)
         Avx2::MedianFilterSquare3x3(src, srcStride, width, height, channelCount, dst, dstStride);
@@ -2141,6 +2276,10 @@ SIMD_API void SimdMedianFilterSquare3x3(const uint8_t * src, size_t srcStride, s
 
 SIMD_API void SimdMedianFilterSquare5x5(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride)
 {
+    if(ParallelRows(src, srcStride, height, dst, dstStride, channelCount*width, 2, [=](const uint8_t * s, size_t h, uint8_t * d, size_t ds)
+        { SimdMedianFilterSquare5x5(s, srcStride, width, h, channelCount, d, ds); }))
+        return;
+
 #ifdef SIMD_AVX2_ENABLE
     if(Avx2::Enable && (width - 2)*channelCount >= Avx2::A)
         Avx2::MedianFilterSquare5x5(src, srcStride, width, height, channelCount, dst, dstStride);
@@ -2197,6 +2336,25 @@ SIMD_API void SimdNeuralProductSum(const float * a, const float * b, size_t size
     simdNeuralProductSum(a, b, size, sum);
 }
 
+SIMD_API void SimdNeuralProductSumBatch(const float * a, size_t aStride, size_t aCount, const float * b, size_t bStride, size_t bCount, size_t size, float * sums)
+{
+    if(ParallelRange(aCount, std::max<size_t>(8, 0x10000/(bCount*size + 1)), [=](size_t begin, size_t end)
+        { SimdNeuralProductSumBatch(a + begin*aStride, aStride, end - begin, b, bStride, bCount, size, sums + begin*bCount); }))
+        return;
+
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::NeuralProductSumBatch(a, aStride, aCount, b, bStride, bCount, size, sums);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && size >= Avx2::F)
+        Avx2::NeuralProductSumBatch(a, aStride, aCount, b, bStride, bCount, size, sums);
+    else
+#endif
+        Base::NeuralProductSumBatch(a, aStride, aCount, b, bStride, bCount, size, sums);
+}
+
 typedef void(*SimdNeuralAddVectorMultipliedByValuePtr) (const float * src, size_t size, const float * value, float * dst);
 SimdNeuralAddVectorMultipliedByValuePtr simdNeuralAddVectorMultipliedByValue = SIMD_FUNC4(NeuralAddVectorMultipliedByValue, SIMD_AVX2_FUNC, SIMD_AVX_FUNC, SIMD_SSE_FUNC, SIMD_NEON_FUNC);
 
@@ -2718,6 +2876,11 @@ SIMD_API void SimdReorder64bit(const uint8_t * src, size_t size, uint8_t * dst)
 SIMD_API void SimdResizeBilinear(const uint8_t *src, size_t srcWidth, size_t srcHeight, size_t srcStride,
     uint8_t *dst, size_t dstWidth, size_t dstHeight, size_t dstStride, size_t channelCount)
 {
+#ifdef SIMD_AVX512BW_ENABLE
+    if(Avx512bw::Enable && dstWidth >= Avx512bw::A)
+        Avx512bw::ResizeBilinear(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
+    else
+#endif
 #ifdef SIMD_AVX2_ENABLE
     if(Avx2::Enable && dstWidth >= Avx2::A)
         Avx2::ResizeBilinear(src, srcWidth, srcHeight, srcStride, dst, dstWidth, dstHeight, dstStride, channelCount);
@@ -2888,6 +3051,15 @@ SIMD_API void SimdShiftBilinear(const uint8_t * src, size_t srcStride, size_t wi
 
 SIMD_API void SimdSobelDx(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
+    if(ParallelRows(src, srcStride, height, dst, dstStride, 2*width, 1, [=](const uint8_t * s, size_t h, uint8_t * d, size_t ds)
+        { SimdSobelDx(s, srcStride, width, h, d, ds); }))
+        return;
+
+#ifdef SIMD_AVX512BW_ENABLE
+    if(Avx512bw::Enable && width > Avx512bw::A)
+        Avx512bw::SobelDx(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
 #ifdef SIMD_AVX2_ENABLE
     if(Avx2::Enable && width > Avx2::A)
         Avx2::SobelDx(src, srcStride, width, height, dst, dstStride);
@@ -2918,6 +3090,15 @@ SIMD_API void SimdSobelDx(const uint8_t * src, size_t srcStride, size_t width, s
 
 SIMD_API void SimdSobelDxAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
+    if(ParallelRows(src, srcStride, height, dst, dstStride, 2*width, 1, [=](const uint8_t * s, size_t h, uint8_t * d, size_t ds)
+        { SimdSobelDxAbs(s, srcStride, width, h, d, ds); }))
+        return;
+
+#ifdef SIMD_AVX512BW_ENABLE
+    if(Avx512bw::Enable && width > Avx512bw::A)
+        Avx512bw::SobelDxAbs(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
 #ifdef SIMD_AVX2_ENABLE
     if(Avx2::Enable && width > Avx2::A)
         Avx2::SobelDxAbs(src, srcStride, width, height, dst, dstStride);
@@ -2943,6 +3124,11 @@ SIMD_API void SimdSobelDxAbs(const uint8_t * src, size_t srcStride, size_t width
 
 SIMD_API void SimdSobelDxAbsSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum)
 {
+#ifdef SIMD_AVX512BW_ENABLE
+    if(Avx512bw::Enable && width > Avx512bw::A)
+        Avx512bw::SobelDxAbsSum(src, stride, width, height, sum);
+    else
+#endif
 #ifdef SIMD_AVX2_ENABLE
     if(Avx2::Enable && width > Avx2::A)
         Avx2::SobelDxAbsSum(src, stride, width, height, sum);
@@ -2968,6 +3154,15 @@ SIMD_API void SimdSobelDxAbsSum(const uint8_t * src, size_t stride, size_t width
 
 SIMD_API void SimdSobelDy(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
+    if(ParallelRows(src, srcStride, height, dst, dstStride, 2*width, 1, [=](const uint8_t * s, size_t h, uint8_t * d, size_t ds)
+        { SimdSobelDy(s, srcStride, width, h, d, ds); }))
+        return;
+
+#ifdef SIMD_AVX512BW_ENABLE
+    if(Avx512bw::Enable && width > Avx512bw::A)
+        Avx512bw::SobelDy(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
 #ifdef SIMD_AVX2_ENABLE
     if(Avx2::Enable && width > Avx2::A)
         Avx2::SobelDy(src, srcStride, width, height, dst, dstStride);
@@ -2998,6 +3193,15 @@ SIMD_API void SimdSobelDy(const uint8_t * src, size_t srcStride, size_t width, s
 
 SIMD_API void SimdSobelDyAbs(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride)
 {
+    if(ParallelRows(src, srcStride, height, dst, dstStride, 2*width, 1, [=](const uint8_t * s, size_t h, uint8_t * d, size_t ds)
+        { SimdSobelDyAbs(s, srcStride, width, h, d, ds); }))
+        return;
+
+#ifdef SIMD_AVX512BW_ENABLE
+    if(Avx512bw::Enable && width > Avx512bw::A)
+        Avx512bw::SobelDyAbs(src, srcStride, width, height, dst, dstStride);
+    else
+#endif
 #ifdef SIMD_AVX2_ENABLE
     if(Avx2::Enable && width > Avx2::A)
         Avx2::SobelDyAbs(src, srcStride, width, height, dst, dstStride);
@@ -3023,6 +3227,11 @@ SIMD_API void SimdSobelDyAbs(const uint8_t * src, size_t srcStride, size_t width
 
 SIMD_API void SimdSobelDyAbsSum(const uint8_t * src, size_t stride, size_t width, size_t height, uint64_t * sum)
 {
+#ifdef SIMD_AVX512BW_ENABLE
+    if(Avx512bw::Enable && width > Avx512bw::A)
+        Avx512bw::SobelDyAbsSum(src, stride, width, height, sum);
+    else
+#endif
 #ifdef SIMD_AVX2_ENABLE
     if(Avx2::Enable && width > Avx2::A)
         Avx2::SobelDyAbsSum(src, stride, width, height, sum);
@@ -3478,6 +3687,25 @@ SIMD_API void SimdSvmSumLinear(const float * x, const float * svs, const float *
         Base::SvmSumLinear(x, svs, weights, length, count, sum);
 }
 
+SIMD_API void SimdSvmSumLinearBatch(const float * x, size_t xStride, size_t xCount, const float * svs, const float * weights, size_t length, size_t count, float * sums)
+{
+    if(ParallelRange(xCount, std::max<size_t>(64, count), [=](size_t begin, size_t end)
+        { SimdSvmSumLinearBatch(x + begin*xStride, xStride, end - begin, svs, weights, length, count, sums + begin); }))
+        return;
+
+#ifdef SIMD_AVX512BW_ENABLE
+    if (Avx512bw::Enable)
+        Avx512bw::SvmSumLinearBatch(x, xStride, xCount, svs, weights, length, count, sums);
+    else
+#endif
+#ifdef SIMD_AVX2_ENABLE
+    if (Avx2::Enable && length >= Avx2::F && count >= Avx2::F)
+        Avx2::SvmSumLinearBatch(x, xStride, xCount, svs, weights, length, count, sums);
+    else
+#endif
+        Base::SvmSumLinearBatch(x, xStride, xCount, svs, weights, length, count, sums);
+}
+
 SIMD_API void SimdTextureBoostedSaturatedGradient(const uint8_t * src, size_t srcStride, size_t width, size_t height,
                                      uint8_t saturation, uint8_t boost, uint8_t * dx, size_t dxStride, uint8_t * dy, size_t dyStride)
 {
@@ -3590,6 +3818,11 @@ SIMD_API void SimdTexturePerformCompensation(const uint8_t * src, size_t srcStri
 SIMD_API void SimdYuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                  size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
 {
+#ifdef SIMD_AVX512BW_ENABLE
+    if(Avx512bw::Enable && width >= Avx512bw::DA)
+        Avx512bw::Yuv420pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+    else
+#endif
 #ifdef SIMD_AVX2_ENABLE
     if(Avx2::Enable && width >= Avx2::DA)
         Avx2::Yuv420pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
@@ -3616,6 +3849,11 @@ SIMD_API void SimdYuv420pToBgr(const uint8_t * y, size_t yStride, const uint8_t
 SIMD_API void SimdYuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                  size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
 {
+#ifdef SIMD_AVX512BW_ENABLE
+    if(Avx512bw::Enable && width >= Avx512bw::DA)
+        Avx512bw::Yuv422pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+    else
+#endif
 #ifdef SIMD_AVX2_ENABLE
     if(Avx2::Enable && width >= Avx2::DA)
         Avx2::Yuv422pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
@@ -3642,6 +3880,11 @@ SIMD_API void SimdYuv422pToBgr(const uint8_t * y, size_t yStride, const uint8_t
 SIMD_API void SimdYuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                                size_t width, size_t height, uint8_t * bgr, size_t bgrStride)
 {
+#ifdef SIMD_AVX512BW_ENABLE
+    if(Avx512bw::Enable && width >= Avx512bw::A)
+        Avx512bw::Yuv444pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
+    else
+#endif
 #ifdef SIMD_AVX2_ENABLE
     if(Avx2::Enable && width >= Avx2::A)
         Avx2::Yuv444pToBgr(y, yStride, u, uStride, v, vStride, width, height, bgr, bgrStride);
@@ -3668,6 +3911,11 @@ SIMD_API void SimdYuv444pToBgr(const uint8_t * y, size_t yStride, const uint8_t
 SIMD_API void SimdYuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                   size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
+#ifdef SIMD_AVX512BW_ENABLE
+    if(Avx512bw::Enable && width >= Avx512bw::DA)
+        Avx512bw::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+    else
+#endif
 #ifdef SIMD_AVX2_ENABLE
     if(Avx2::Enable && width >= Avx2::DA)
         Avx2::Yuv420pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
@@ -3694,6 +3942,11 @@ SIMD_API void SimdYuv420pToBgra(const uint8_t * y, size_t yStride, const uint8_t
 SIMD_API void SimdYuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                                 size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
+#ifdef SIMD_AVX512BW_ENABLE
+    if(Avx512bw::Enable && width >= Avx512bw::DA)
+        Avx512bw::Yuv422pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+    else
+#endif
 #ifdef SIMD_AVX2_ENABLE
     if(Avx2::Enable && width >= Avx2::DA)
         Avx2::Yuv422pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
@@ -3720,6 +3973,11 @@ SIMD_API void SimdYuv422pToBgra(const uint8_t * y, size_t yStride, const uint8_t
 SIMD_API void SimdYuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                   size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha)
 {
+#ifdef SIMD_AVX512BW_ENABLE
+    if(Avx512bw::Enable && width >= Avx512bw::A)
+        Avx512bw::Yuv444pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
+    else
+#endif
 #ifdef SIMD_AVX2_ENABLE
     if(Avx2::Enable && width >= Avx2::A)
         Avx2::Yuv444pToBgra(y, yStride, u, uStride, v, vStride, width, height, bgra, bgraStride, alpha);
@@ -3746,13 +4004,33 @@ SIMD_API void SimdYuv444pToBgra(const uint8_t * y, size_t yStride, const uint8_t
 SIMD_API void SimdYuv444pToHsl(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                                size_t width, size_t height, uint8_t * hsl, size_t hslStride)
 {
-    Base::Yuv444pToHsl(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride);
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::Yuv444pToHsl(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if(Sse41::Enable && width >= Sse41::A)
+        Sse41::Yuv444pToHsl(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride);
+    else
+#endif
+        Base::Yuv444pToHsl(y, yStride, u, uStride, v, vStride, width, height, hsl, hslStride);
 }
 
 SIMD_API void SimdYuv444pToHsv(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
                                size_t width, size_t height, uint8_t * hsv, size_t hsvStride)
 {
-    Base::Yuv444pToHsv(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride);
+#ifdef SIMD_AVX2_ENABLE
+    if(Avx2::Enable && width >= Avx2::A)
+        Avx2::Yuv444pToHsv(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride);
+    else
+#endif
+#ifdef SIMD_SSE41_ENABLE
+    if(Sse41::Enable && width >= Sse41::A)
+        Sse41::Yuv444pToHsv(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride);
+    else
+#endif
+        Base::Yuv444pToHsv(y, yStride, u, uStride, v, vStride, width, height, hsv, hsvStride);
 }
 
 SIMD_API void SimdYuv420pToHue(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
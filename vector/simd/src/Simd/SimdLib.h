@@ -265,6 +265,31 @@ extern "C"
     */
     SIMD_API size_t SimdAlignment();
 
+    /*! @ingroup thread
+
+        \fn void SimdSetThreadNumber(size_t threadNumber);
+
+        \short Sets number of threads used by the row-tiled image filters.
+
+        With more than one thread ::SimdSobelDx, ::SimdSobelDxAbs, ::SimdSobelDy, ::SimdSobelDyAbs, ::SimdLaplace, ::SimdLaplaceAbs,
+        ::SimdMeanFilter3x3, ::SimdMedianFilterRhomb3x3, ::SimdMedianFilterRhomb5x5, ::SimdMedianFilterSquare3x3, ::SimdMedianFilterSquare5x5
+        and ::SimdGaussianBlur3x3 split the image into horizontal bands which are processed by a persistent thread pool.
+        The result does not depend on the number of threads.
+
+        \param [in] threadNumber - a number of threads (1 by default). It is limited by the size of the thread pool (the number of hardware threads).
+    */
+    SIMD_API void SimdSetThreadNumber(size_t threadNumber);
+
+    /*! @ingroup thread
+
+        \fn size_t SimdGetThreadNumber();
+
+        \short Gets number of threads used by the row-tiled image filters (see ::SimdSetThreadNumber).
+
+        \return a number of threads, after the limit by the size of the thread pool.
+    */
+    SIMD_API size_t SimdGetThreadNumber();
+
     /*! @ingroup hash
 
         \fn uint32_t SimdCrc32c(const void * src, size_t size);
@@ -2920,6 +2945,35 @@ extern "C"
     */
     SIMD_API void SimdNeuralProductSum(const float * a, const float * b, size_t size, float * sum);
 
+    /*! @ingroup neural
+
+        \fn void SimdNeuralProductSumBatch(const float * a, size_t aStride, size_t aCount, const float * b, size_t bStride, size_t bCount, size_t size, float * sums);
+
+        \short Calculates sums of products for every pair of rows of two 32-bit float matrices.
+
+        It is equal to ::SimdNeuralProductSum called for every pair of rows, but computes several pairs at once
+        in registers and splits the rows of the first matrix between threads (see ::SimdSetThreadNumber).
+
+        For every row pair:
+        \verbatim
+        sums[i][j] = 0;
+        for(k = 0; k < size; ++k)
+            sums[i][j] += a[i][k]*b[j][k];
+        \endverbatim
+
+        \note The results can differ from ::SimdNeuralProductSum within float rounding because of another order of summation.
+
+        \param [in] a - a pointer to the first 32-bit float matrix a[aCount][size].
+        \param [in] aStride - a row size of the first matrix (in 32-float values).
+        \param [in] aCount - a number of rows of the first matrix.
+        \param [in] b - a pointer to the second 32-bit float matrix b[bCount][size].
+        \param [in] bStride - a row size of the second matrix (in 32-float values).
+        \param [in] bCount - a number of rows of the second matrix.
+        \param [in] size - a size of rows.
+        \param [out] sums - a pointer to 32-bit float array sums[aCount][bCount] of sums of products.
+    */
+    SIMD_API void SimdNeuralProductSumBatch(const float * a, size_t aStride, size_t aCount, const float * b, size_t bStride, size_t bCount, size_t size, float * sums);
+
     /*! @ingroup neural
 
         \fn void SimdNeuralAddVectorMultipliedByValue(const float * src, size_t size, const float * value, float * dst);
@@ -4122,6 +4176,38 @@ extern "C"
     */
     SIMD_API void SimdSvmSumLinear(const float * x, const float * svs, const float * weights, size_t length, size_t count, float * sum);
 
+    /*! @ingroup svm
+
+        \fn void SimdSvmSumLinearBatch(const float * x, size_t xStride, size_t xCount, const float * svs, const float * weights, size_t length, size_t count, float * sums);
+
+        \short Calculates ::SimdSvmSumLinear for a batch of feature vectors.
+
+        The support vectors are folded once into the hyperplane h[j] = sum(svs[j][i]*weights[i]), 
+        so the batch costs length*(count + xCount) multiplications instead of length*count*xCount:
+        \verbatim
+        for(j = 0; j < length; ++j)
+            for(i = 0; i < count; ++i)
+                h[j] += svs[j][i]*weights[i];
+        for(n = 0; n < xCount; ++n)
+            for(j = 0; j < length; ++j)
+                sums[n] += x[n][j]*h[j];
+        \endverbatim
+        The feature vectors are split between threads (see ::SimdSetThreadNumber) in blocks of at least count vectors, 
+        each of them folds its own copy of the hyperplane.
+
+        \note The results can differ from ::SimdSvmSumLinear within float rounding because of another order of summation.
+
+        \param [in] x - a matrix x[xCount][length] of features which need to predict with using SVM.
+        \param [in] xStride - a row size of the feature matrix (in 32-float values).
+        \param [in] xCount - a number of feature vectors.
+        \param [in] svs - an array with support vectors svs[length][count]. 
+        \param [in] weights - a weight coefficient of each support vector.
+        \param [in] length - a length of these current and support vectors.
+        \param [in] count - a count of support vectors.
+        \param [out] sums - a pointer to the array of xCount result sums.
+    */
+    SIMD_API void SimdSvmSumLinearBatch(const float * x, size_t xStride, size_t xCount, const float * svs, const float * weights, size_t length, size_t count, float * sums);
+
     /*! @ingroup texture_estimation
 
         \fn void SimdTextureBoostedSaturatedGradient(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t saturation, uint8_t boost, uint8_t * dx, size_t dxStride, uint8_t * dy, size_t dyStride);
@@ -349,6 +349,72 @@ namespace Simd
     }
 #endif//SIMD_AVX2_ENABLE
 
+#ifdef SIMD_AVX512BW_INLINE_ENABLE
+    namespace Avx512bw
+    {
+        template <bool align> SIMD_INLINE __m512i Load(const __m512i * p);
+
+        template <> SIMD_INLINE __m512i Load<false>(const __m512i * p)
+        {
+            return _mm512_loadu_si512(p);
+        }
+
+        template <> SIMD_INLINE __m512i Load<true>(const __m512i * p)
+        {
+            return _mm512_load_si512(p);
+        }
+
+        template <bool align, size_t step> SIMD_INLINE __m512i LoadBeforeFirst(const uint8_t * p)
+        {
+            return _mm512_mask_loadu_epi8(Load<align>((__m512i*)p), __mmask64(-1) << step, p - step);
+        }
+
+        template <bool align, size_t step> SIMD_INLINE __m512i LoadAfterLast(const uint8_t * p)
+        {
+            return _mm512_mask_loadu_epi8(Load<align>((__m512i*)p), __mmask64(-1) >> step, p + step);
+        }
+
+        template <bool align, size_t step> SIMD_INLINE void LoadNose3(const uint8_t * p, __m512i a[3])
+        {
+            a[0] = LoadBeforeFirst<align, step>(p);
+            a[1] = Load<align>((__m512i*)p);
+            a[2] = _mm512_loadu_si512((__m512i*)(p + step));
+        }
+
+        template <bool align, size_t step> SIMD_INLINE void LoadBody3(const uint8_t * p, __m512i a[3])
+        {
+            a[0] = _mm512_loadu_si512((__m512i*)(p - step));
+            a[1] = Load<align>((__m512i*)p);
+            a[2] = _mm512_loadu_si512((__m512i*)(p + step));
+        }
+
+        template <bool align, size_t step> SIMD_INLINE void LoadTail3(const uint8_t * p, __m512i a[3])
+        {
+            a[0] = _mm512_loadu_si512((__m512i*)(p - step));
+            a[1] = Load<align>((__m512i*)p);
+            a[2] = LoadAfterLast<align, step>(p);
+        }
+
+        SIMD_INLINE void LoadNoseDx(const uint8_t * p, __m512i a[3])
+        {
+            a[0] = LoadBeforeFirst<false, 1>(p);
+            a[2] = _mm512_loadu_si512((__m512i*)(p + 1));
+        }
+
+        SIMD_INLINE void LoadBodyDx(const uint8_t * p, __m512i a[3])
+        {
+            a[0] = _mm512_loadu_si512((__m512i*)(p - 1));
+            a[2] = _mm512_loadu_si512((__m512i*)(p + 1));
+        }
+
+        SIMD_INLINE void LoadTailDx(const uint8_t * p, __m512i a[3])
+        {
+            a[0] = _mm512_loadu_si512((__m512i*)(p - 1));
+            a[2] = LoadAfterLast<false, 1>(p);
+        }
+    }
+#endif//SIMD_AVX512BW_INLINE_ENABLE
+
 #ifdef SIMD_VMX_ENABLE
     namespace Vmx
     {
@@ -280,6 +280,34 @@ namespace Simd
             const int32_t mask[DF] = { 0, 0, 0, 0, -1, -1, -1, -1 };
             return _mm_loadu_ps((float*)(mask + count));
         }
+
+        template <int iter> SIMD_INLINE __m128 Reciprocal(__m128 a);
+
+        template <> SIMD_INLINE __m128 Reciprocal<-1>(__m128 a)
+        {
+            return _mm_div_ps(_mm_set1_ps(1.0f), a);
+        }
+
+        template <> SIMD_INLINE __m128 Reciprocal<0>(__m128 a)
+        {
+            return _mm_rcp_ps(a);
+        }
+
+        template <> SIMD_INLINE __m128 Reciprocal<1>(__m128 a)
+        {
+            __m128 r = _mm_rcp_ps(a);
+            return _mm_mul_ps(r, _mm_sub_ps(_mm_set1_ps(2.0f), _mm_mul_ps(a, r)));
+        }
+
+        template <int iter> SIMD_INLINE __m128 Div(__m128 a, __m128 b)
+        {
+            return _mm_mul_ps(a, Reciprocal<iter>(b));
+        }
+
+        template <> SIMD_INLINE __m128 Div<-1>(__m128 a, __m128 b)
+        {
+            return _mm_div_ps(a, b);
+        }
     }
 #endif//SIMD_SSE_ENABLE
 
@@ -458,6 +486,34 @@ namespace Simd
             __m256 hi = PermutedHorizontalAdd(PermutedHorizontalAdd(src[4], src[5]), PermutedHorizontalAdd(src[6], src[7]));
             _mm256_storeu_ps(dst, _mm256_add_ps(_mm256_loadu_ps(dst), PermutedHorizontalAdd(lo, hi)));
         }
+
+        template <int iter> SIMD_INLINE __m256 Reciprocal(__m256 a);
+
+        template <> SIMD_INLINE __m256 Reciprocal<-1>(__m256 a)
+        {
+            return _mm256_div_ps(_mm256_set1_ps(1.0f), a);
+        }
+
+        template <> SIMD_INLINE __m256 Reciprocal<0>(__m256 a)
+        {
+            return _mm256_rcp_ps(a);
+        }
+
+        template <> SIMD_INLINE __m256 Reciprocal<1>(__m256 a)
+        {
+            __m256 r = _mm256_rcp_ps(a);
+            return _mm256_mul_ps(r, _mm256_sub_ps(_mm256_set1_ps(2.0f), _mm256_mul_ps(a, r)));
+        }
+
+        template <int iter> SIMD_INLINE __m256 Div(__m256 a, __m256 b)
+        {
+            return _mm256_mul_ps(a, Reciprocal<iter>(b));
+        }
+
+        template <> SIMD_INLINE __m256 Div<-1>(__m256 a, __m256 b)
+        {
+            return _mm256_div_ps(a, b);
+        }
     }
 #endif//SIMD_AVX_ENABLE
 
@@ -556,6 +612,72 @@ namespace Simd
     }
 #endif// SIMD_AVX2_ENABLE
 
+#ifdef SIMD_AVX512BW_INLINE_ENABLE
+    namespace Avx512bw
+    {
+        SIMD_INLINE __m512i SaturateI16ToU8(__m512i value)
+        {
+            return _mm512_min_epi16(K16_00FF, _mm512_max_epi16(value, K_ZERO));
+        }
+
+        SIMD_INLINE __m512i HorizontalSum32(__m512i a)
+        {
+            return _mm512_add_epi64(_mm512_unpacklo_epi32(a, K_ZERO), _mm512_unpackhi_epi32(a, K_ZERO));
+        }
+
+        SIMD_INLINE __m512i AbsDifferenceU8(__m512i a, __m512i b)
+        {
+            return _mm512_sub_epi8(_mm512_max_epu8(a, b), _mm512_min_epu8(a, b));
+        }
+
+        SIMD_INLINE __m512i BinomialSum16(const __m512i & a, const __m512i & b, const __m512i & c)
+        {
+            return _mm512_add_epi16(_mm512_add_epi16(a, c), _mm512_add_epi16(b, b));
+        }
+
+        template <bool abs> __m512i ConditionalAbs(__m512i a);
+
+        template <> SIMD_INLINE __m512i ConditionalAbs<true>(__m512i a)
+        {
+            return _mm512_abs_epi16(a);
+        }
+
+        template <> SIMD_INLINE __m512i ConditionalAbs<false>(__m512i a)
+        {
+            return a;
+        }
+
+        template <int part> SIMD_INLINE __m512i UnpackU8(__m512i a, __m512i b = K_ZERO);
+
+        template <> SIMD_INLINE __m512i UnpackU8<0>(__m512i a, __m512i b)
+        {
+            return _mm512_unpacklo_epi8(a, b);
+        }
+
+        template <> SIMD_INLINE __m512i UnpackU8<1>(__m512i a, __m512i b)
+        {
+            return _mm512_unpackhi_epi8(a, b);
+        }
+
+        template<int part> SIMD_INLINE __m512i SubUnpackedU8(__m512i a, __m512i b)
+        {
+            return _mm512_maddubs_epi16(UnpackU8<part>(a, b), K8_01_FF);
+        }
+
+        template <int part> SIMD_INLINE __m512i UnpackU16(__m512i a, __m512i b = K_ZERO);
+
+        template <> SIMD_INLINE __m512i UnpackU16<0>(__m512i a, __m512i b)
+        {
+            return _mm512_unpacklo_epi16(a, b);
+        }
+
+        template <> SIMD_INLINE __m512i UnpackU16<1>(__m512i a, __m512i b)
+        {
+            return _mm512_unpackhi_epi16(a, b);
+        }
+    }
+#endif// SIMD_AVX512BW_INLINE_ENABLE
+
 #ifdef SIMD_VMX_ENABLE
     namespace Vmx
     {
@@ -617,6 +617,26 @@ namespace Simd
                     Simd::Copy(connection, _connection);
                 else
                     Simd::Fill(_connection, 1);
+                SetGemm(srcDepth*dstDepth >= 64);
+            }
+
+            /*!
+                \short Enables or disables the im2col/GEMM path of the layer.
+
+                The GEMM path gathers the input patches of all output points into a matrix and gets the convolution as products of its rows 
+                with the rows of the weights (see ::SimdNeuralProductSumBatch) instead of one ::SimdNeuralAddConvolution3x3 (5x5) call per pair 
+                of channels. It is enabled by default for layers with at least 64 pairs of channels. It needs all channels to be connected.
+
+                \note The results can differ within float rounding because of another order of summation.
+
+                \param [in] gemm - a flag to use the im2col/GEMM path.
+            */
+            void SetGemm(bool gemm)
+            {
+                _gemm = gemm;
+                for (ptrdiff_t sc = 0; sc < _src.depth; ++sc)
+                    for (ptrdiff_t dc = 0; dc < _dst.depth; ++dc)
+                        _gemm = _gemm && _connection.At<bool>(dc, sc);
             }
 
             void Forward(const Vector & src, size_t thread, Method method) override
@@ -624,6 +644,12 @@ namespace Simd
                 const Vector & padded = PaddedSrc(src, thread);
                 Vector & sum = _common[thread].sum;
                 Vector & dst = _common[thread].dst;
+                if (_gemm)
+                {
+                    ForwardGemm(padded, sum, thread);
+                    _function.function(sum.data(), sum.size(), dst.data());
+                    return;
+                }
                 Detail::SetZero(sum);
                 for (ptrdiff_t dc = 0; dc < _dst.depth; ++dc)
                 {
@@ -682,7 +708,10 @@ namespace Simd
 
                 Detail::SetZero(prevDelta);
 
-                for (ptrdiff_t sc = 0; sc < _src.depth; ++sc)
+                if (_gemm)
+                    BackwardGemm(currDelta, prevDelta, dWeight, thread);
+
+                for (ptrdiff_t sc = 0; sc < _src.depth && !_gemm; ++sc)
                 {
                     for (ptrdiff_t dc = 0; dc < _dst.depth; ++dc)
                     {
@@ -721,7 +750,7 @@ namespace Simd
 
                 _prev->_function.derivative(&prevDst[0], prevDst.size(), &prevDelta[0]);
 
-                for (ptrdiff_t sc = 0; sc < _src.depth; ++sc)
+                for (ptrdiff_t sc = 0; sc < _src.depth && !_gemm; ++sc)
                 {
                     for (ptrdiff_t dc = 0; dc < _dst.depth; ++dc)
                     {
@@ -828,9 +857,84 @@ namespace Simd
                 }
             }
 
+            // Gathers the input patches into patches[dst point][src channel, core row, core col]: sum = weight * patches^T.
+            void ForwardGemm(const Vector & padded, Vector & sum, size_t thread)
+            {
+                const size_t K = _core.Area()*_src.depth, N = _dst.Area();
+                Vector & patches = _specific[thread].patches;
+                patches.resize(N*K);
+                float * patch = patches.data();
+                for (ptrdiff_t y = 0; y < _dst.height; ++y)
+                {
+                    for (ptrdiff_t x = 0; x < _dst.width; ++x)
+                    {
+                        for (ptrdiff_t c = 0; c < _src.depth; ++c)
+                        {
+                            for (ptrdiff_t wy = 0; wy < _core.height; ++wy, patch += _core.width)
+                                memcpy(patch, _padded.Get(padded, x, y + wy, c), _core.width*sizeof(float));
+                        }
+                    }
+                }
+                ::SimdNeuralProductSumBatch(_weight.data(), K, _dst.depth, patches.data(), K, N, K, sum.data());
+                if (_bias.size())
+                {
+                    for (ptrdiff_t dc = 0; dc < _dst.depth; ++dc)
+                    {
+                        float bias = _bias[dc];
+                        float * psum = _dst.Get(sum, 0, 0, dc);
+                        for (size_t i = 0; i < N; ++i)
+                            psum[i] += bias;
+                    }
+                }
+            }
+
+            // Uses the patches of ForwardGemm: dPatches = delta^T * weight is scattered back to prevDelta, dWeight += delta * patches.
+            void BackwardGemm(const Vector & currDelta, Vector & prevDelta, Vector & dWeight, size_t thread)
+            {
+                const size_t K = _core.Area()*_src.depth, N = _dst.Area(), D = _dst.depth;
+                Specific & s = _specific[thread];
+                s.deltaT.resize(N*D);
+                s.weightT.resize(K*D);
+                s.patchesT.resize(K*N);
+                s.dPatches.resize(N*K);
+                s.dWeight.resize(D*K);
+                Transpose(currDelta.data(), D, N, s.deltaT.data());
+                Transpose(_weight.data(), D, K, s.weightT.data());
+                Transpose(s.patches.data(), N, K, s.patchesT.data());
+
+                ::SimdNeuralProductSumBatch(s.deltaT.data(), D, N, s.weightT.data(), D, K, D, s.dPatches.data());
+                const float * patch = s.dPatches.data();
+                for (ptrdiff_t y = 0; y < _dst.height; ++y)
+                {
+                    for (ptrdiff_t x = 0; x < _dst.width; ++x)
+                    {
+                        for (ptrdiff_t c = 0; c < _src.depth; ++c)
+                        {
+                            for (ptrdiff_t wy = 0; wy < _core.height; ++wy, patch += _core.width)
+                            {
+                                float * pdst = _padded.Get(prevDelta, x, y + wy, c);
+                                for (ptrdiff_t wx = 0; wx < _core.width; ++wx)
+                                    pdst[wx] += patch[wx];
+                            }
+                        }
+                    }
+                }
+
+                ::SimdNeuralProductSumBatch(currDelta.data(), N, D, s.patchesT.data(), N, K, N, s.dWeight.data());
+                Detail::AddTo(s.dWeight, dWeight);
+            }
+
+            static void Transpose(const float * src, size_t rows, size_t cols, float * dst)
+            {
+                for (size_t i = 0; i < rows; ++i)
+                    for (size_t j = 0; j < cols; ++j)
+                        dst[j*rows + i] = src[i*cols + j];
+            }
+
             struct Specific
             {
                 Vector paddedSrc, paddedDelta;
+                Vector patches, patchesT, deltaT, weightT, dPatches, dWeight;
             };
             std::vector<Specific> _specific;
 
@@ -838,6 +942,7 @@ namespace Simd
             Index _padded;
             size_t _indent;
             bool _valid;
+            bool _gemm;
             View _connection;
         };
 
@@ -1251,11 +1356,11 @@ namespace Simd
                     delta[i] = current[i] - control[i];
             }
 
-            template<TrainOptions::UpdateType type> void UpdateWeight(const TrainOptions & o, const Vector & d, Vector & g, Vector & v);
+            template<TrainOptions::UpdateType type> void UpdateWeight(const TrainOptions & o, const float * d, size_t size, float * g, float * v);
 
-            template<> SIMD_INLINE void UpdateWeight<TrainOptions::AdaptiveGradient>(const TrainOptions & o, const Vector & d, Vector & g, Vector & v)
+            template<> SIMD_INLINE void UpdateWeight<TrainOptions::AdaptiveGradient>(const TrainOptions & o, const float * d, size_t size, float * g, float * v)
             {
-                ::SimdNeuralAdaptiveGradientUpdate(d.data(), d.size(), o.batchSize, &o.alpha, &o.epsilon, g.data(), v.data());
+                ::SimdNeuralAdaptiveGradientUpdate(d, size, o.batchSize, &o.alpha, &o.epsilon, g, v);
             }
         }
 
@@ -1526,6 +1631,14 @@ namespace Simd
  private:
             LayerPtrs _layers;
 
+            struct Slice
+            {
+                Layer * layer;
+                bool bias;
+                size_t offset, size;
+            };
+            std::vector<Slice> _slices;
+
             const Vector & Forward(const Vector & src, size_t thread, Layer::Method method)
             {
                 SIMD_CHECK_PERFORMANCE();
@@ -1591,24 +1704,55 @@ namespace Simd
                 }
             }
 
+            // Every slice of weights is reduced over the per-thread gradients and updated by one task, so the tasks need no locks.
+            template<TrainOptions::UpdateType type> void UpdateWeight(const Slice & slice, const TrainOptions & options)
+            {
+                Layer & layer = *slice.layer;
+                const float one = 1;
+                float * sum = (slice.bias ? layer._common[0].dBias : layer._common[0].dWeight).data() + slice.offset;
+                for (size_t t = 1; t < layer._common.size(); ++t)
+                {
+                    float * delta = (slice.bias ? layer._common[t].dBias : layer._common[t].dWeight).data() + slice.offset;
+                    ::SimdNeuralAddVectorMultipliedByValue(delta, slice.size, &one, sum);
+                    memset(delta, 0, slice.size*sizeof(float));
+                }
+                if (slice.bias)
+                    Detail::UpdateWeight<type>(options, sum, slice.size, layer._gBias.data() + slice.offset, layer._bias.data() + slice.offset);
+                else
+                    Detail::UpdateWeight<type>(options, sum, slice.size, layer._gWeight.data() + slice.offset, layer._weight.data() + slice.offset);
+                memset(sum, 0, slice.size*sizeof(float));
+            }
+
             template<TrainOptions::UpdateType type> void UpdateWeight(const TrainOptions & options)
             {
+                const size_t SLICE_SIZE = 4096;
+                _slices.clear();
                 for (size_t l = 0; l < _layers.size(); ++l)
                 {
                     Layer & layer = *_layers[l];
-                    for (size_t t = 1; t < layer._common.size(); ++t)
+                    for (size_t offset = 0; offset < layer._weight.size(); offset += SLICE_SIZE)
                     {
-                        Detail::AddTo(layer._common[t].dWeight, layer._common[0].dWeight);
-                        Detail::AddTo(layer._common[t].dBias, layer._common[0].dBias);
+                        Slice slice = { &layer, false, offset, std::min(SLICE_SIZE, layer._weight.size() - offset) };
+                        _slices.push_back(slice);
                     }
-                    Detail::UpdateWeight<type>(options, layer._common[0].dWeight, layer._gWeight, layer._weight);
-                    Detail::UpdateWeight<type>(options, layer._common[0].dBias, layer._gBias, layer._bias);
-                    for (size_t t = 0; t < layer._common.size(); ++t)
+                    if (layer._bias.size())
                     {
-                        Detail::SetZero(layer._common[t].dWeight);
-                        Detail::SetZero(layer._common[t].dBias);
+                        Slice slice = { &layer, true, 0, layer._bias.size() };
+                        _slices.push_back(slice);
                     }
                 }
+                if (options.threadNumber > 1)
+                {
+                    ThreadPool::Global().Run(_slices.size(), [this, &options](size_t i)
+                    {
+                        UpdateWeight<type>(_slices[i], options);
+                    });
+                }
+                else
+                {
+                    for (size_t i = 0; i < _slices.size(); ++i)
+                        UpdateWeight<type>(_slices[i], options);
+                }
             }
 
             void UpdateWeight(const TrainOptions & options)
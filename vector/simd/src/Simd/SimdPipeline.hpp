@@ -0,0 +1,478 @@
+/*
+* Simd Library (http://simd.sourceforge.net).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#ifndef __SimdPipeline_hpp__
+#define __SimdPipeline_hpp__
+
+#include "SimdLib.hpp"
+#include "SimdParallel.hpp"
+
+#include <vector>
+#include <memory>
+
+namespace Simd
+{
+    /*! @ingroup cpp_pipeline
+
+        \short GradientPipeline structure runs the chain BgraToGray -> GaussianBlur3x3 -> SobelDxAbs, SobelDyAbs, Histogram strip by strip.
+
+        The image is processed in horizontal strips. The gray and blurred rows of a strip (with 2 and 1 extra rows
+        at the strip borders) and the gradients of the strip are kept in scratch buffers small enough to stay in L2 cache,
+        so only the input BGRA image and the output gradients go through the memory.
+        The result is identical to the sequential calls of the kernels for the whole image.
+        When ::SimdSetThreadNumber sets more than one thread, bands of strips are processed on the global thread pool.
+
+        Using example:
+        \verbatim
+        #include "SimdPipeline.hpp"
+
+        int main()
+        {
+            typedef Simd::GradientPipeline<Simd::Allocator> Pipeline;
+
+            Pipeline::View bgra(1920, 1080, Pipeline::View::Bgra32), dx(1920, 1080, Pipeline::View::Int16), dy(1920, 1080, Pipeline::View::Int16);
+            uint32_t histogram[Simd::HISTOGRAM_SIZE];
+
+            Pipeline pipeline;
+            pipeline.Run(bgra, dx, dy, histogram);
+
+            return 0;
+        }
+        \endverbatim
+    */
+    template <template<class> class A>
+    struct GradientPipeline
+    {
+        typedef Simd::View<A> View; /*!< An image type definition. */
+
+        /*!
+            \short Kernels of the pipeline. They have the signatures of the corresponding functions of %Simd Library API.
+        */
+        struct Kernels
+        {
+            void (*bgraToGray)(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * gray, size_t grayStride); /*!< See ::SimdBgraToGray. */
+            void (*gaussianBlur3x3)(const uint8_t * src, size_t srcStride, size_t width, size_t height, size_t channelCount, uint8_t * dst, size_t dstStride); /*!< See ::SimdGaussianBlur3x3. */
+            void (*sobelDxAbs)(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride); /*!< See ::SimdSobelDxAbs. */
+            void (*sobelDyAbs)(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t * dst, size_t dstStride); /*!< See ::SimdSobelDyAbs. */
+            void (*histogram)(const uint8_t * src, size_t width, size_t height, size_t stride, uint32_t * histogram); /*!< See ::SimdHistogram. */
+
+            /*!
+                Creates kernels which call the functions of %Simd Library API.
+            */
+            Kernels()
+                : bgraToGray(SimdBgraToGray)
+                , gaussianBlur3x3(SimdGaussianBlur3x3)
+                , sobelDxAbs(SimdSobelDxAbs)
+                , sobelDyAbs(SimdSobelDyAbs)
+                , histogram(SimdHistogram)
+            {
+            }
+
+            /*!
+                Creates kernels from given functions.
+            */
+            Kernels(void (*bgraToGray_)(const uint8_t *, size_t, size_t, size_t, uint8_t *, size_t),
+                void (*gaussianBlur3x3_)(const uint8_t *, size_t, size_t, size_t, size_t, uint8_t *, size_t),
+                void (*sobelDxAbs_)(const uint8_t *, size_t, size_t, size_t, uint8_t *, size_t),
+                void (*sobelDyAbs_)(const uint8_t *, size_t, size_t, size_t, uint8_t *, size_t),
+                void (*histogram_)(const uint8_t *, size_t, size_t, size_t, uint32_t *))
+                : bgraToGray(bgraToGray_)
+                , gaussianBlur3x3(gaussianBlur3x3_)
+                , sobelDxAbs(sobelDxAbs_)
+                , sobelDyAbs(sobelDyAbs_)
+                , histogram(histogram_)
+            {
+            }
+        };
+
+        /*!
+            Creates a new GradientPipeline structure.
+
+            \param [in] stripHeight - a height of the strip. If it is equal to 0 it is estimated from the image width. By default it is equal to 0.
+            \param [in] kernels - kernels of the pipeline. By default the functions of %Simd Library API are used.
+        */
+        GradientPipeline(size_t stripHeight = 0, const Kernels & kernels = Kernels())
+            : _stripHeight(stripHeight)
+            , _kernels(kernels)
+        {
+        }
+
+        /*!
+            Gets a height of the strip used for the image of given width.
+
+            \param [in] width - a width of the image.
+            \return - a height of the strip.
+        */
+        size_t StripHeight(size_t width) const
+        {
+            if (_stripHeight)
+                return _stripHeight;
+            const size_t rowSize = width*(4 + 1 + 1 + 2 + 2);
+            return std::max<size_t>(16, L2_BUDGET/rowSize);
+        }
+
+        /*!
+            Calculates absolute gradients and a histogram of the blurred gray image for 32-bit BGRA image.
+
+            \param [in] bgra - an input 32-bit BGRA image.
+            \param [out] dx - an output 16-bit image with absolute value of Sobel's filter along x axis.
+            \param [out] dy - an output 16-bit image with absolute value of Sobel's filter along y axis.
+            \param [out] histogram - a histogram of the blurred 8-bit gray image (array of 256 unsigned 32-bit values).
+        */
+        void Run(const View & bgra, View & dx, View & dy, uint32_t * histogram)
+        {
+            assert(bgra.format == View::Bgra32 && EqualSize(bgra, dx) && EqualSize(bgra, dy));
+            assert(dx.format == View::Int16 && dy.format == View::Int16);
+
+            const size_t width = bgra.width, height = bgra.height, stripHeight = StripHeight(width);
+            const size_t stripCount = (height + stripHeight - 1)/stripHeight;
+            const size_t threadNumber = ThreadPool::InTask() ? 1 : std::min(ThreadNumber(), ThreadPool::Global().Size());
+            const size_t bandCount = std::max<size_t>(1, std::min(threadNumber, stripCount));
+
+            while (_buffers.size() < bandCount)
+                _buffers.push_back(BufferPtr(new Buffer()));
+            for (size_t band = 0; band < bandCount; ++band)
+                _buffers[band]->Init(width, stripHeight);
+
+            ThreadPool::Global().Run(bandCount, [&](size_t band)
+            {
+                const size_t begin = stripCount*band/bandCount*stripHeight;
+                const size_t end = std::min(stripCount*(band + 1)/bandCount*stripHeight, height);
+                Buffer & buffer = *_buffers[band];
+                memset(buffer.histogram, 0, sizeof(buffer.histogram));
+                for (size_t top = begin; top < end; top += stripHeight)
+                    RunStrip(bgra, top, std::min(top + stripHeight, end), dx, dy, buffer);
+            });
+
+            memset(histogram, 0, sizeof(uint32_t)*HISTOGRAM_SIZE);
+            for (size_t band = 0; band < bandCount; ++band)
+                for (size_t i = 0; i < HISTOGRAM_SIZE; ++i)
+                    histogram[i] += _buffers[band]->histogram[i];
+        }
+
+    private:
+        static const size_t L2_BUDGET = 256*1024;
+
+        struct Buffer
+        {
+            View gray, blur, dx, dy;
+            uint32_t histogram[HISTOGRAM_SIZE];
+            uint32_t part[HISTOGRAM_SIZE];
+
+            void Init(size_t width, size_t stripHeight)
+            {
+                if (gray.width != width || gray.height != stripHeight + 4)
+                {
+                    gray.Recreate(width, stripHeight + 4, View::Gray8);
+                    blur.Recreate(width, stripHeight + 4, View::Gray8);
+                    dx.Recreate(width, stripHeight + 2, View::Int16);
+                    dy.Recreate(width, stripHeight + 2, View::Int16);
+                }
+            }
+        };
+        typedef std::unique_ptr<Buffer> BufferPtr;
+
+        size_t _stripHeight;
+        Kernels _kernels;
+        std::vector<BufferPtr> _buffers; // The buffers are held by pointers: a View can not be moved when the vector grows.
+
+        void RunStrip(const View & bgra, size_t top, size_t bottom, View & dx, View & dy, Buffer & buffer) const
+        {
+            const size_t width = bgra.width, height = bgra.height;
+            const size_t grayTop = top < 2 ? 0 : top - 2, grayBottom = std::min(bottom + 2, height);
+            const size_t blurTop = top < 1 ? 0 : top - 1, blurBottom = std::min(bottom + 1, height);
+
+            _kernels.bgraToGray(bgra.data + grayTop*bgra.stride, width, grayBottom - grayTop, bgra.stride, buffer.gray.data, buffer.gray.stride);
+            _kernels.gaussianBlur3x3(buffer.gray.data, buffer.gray.stride, width, grayBottom - grayTop, 1, buffer.blur.data, buffer.blur.stride);
+
+            const uint8_t * blur = buffer.blur.data + (blurTop - grayTop)*buffer.blur.stride;
+            _kernels.sobelDxAbs(blur, buffer.blur.stride, width, blurBottom - blurTop, buffer.dx.data, buffer.dx.stride);
+            _kernels.sobelDyAbs(blur, buffer.blur.stride, width, blurBottom - blurTop, buffer.dy.data, buffer.dy.stride);
+            for (size_t row = top; row < bottom; ++row)
+            {
+                memcpy(dx.data + row*dx.stride, buffer.dx.data + (row - blurTop)*buffer.dx.stride, width*2);
+                memcpy(dy.data + row*dy.stride, buffer.dy.data + (row - blurTop)*buffer.dy.stride, width*2);
+            }
+
+            _kernels.histogram(buffer.blur.data + (top - grayTop)*buffer.blur.stride, width, bottom - top, buffer.blur.stride, buffer.part);
+            for (size_t i = 0; i < HISTOGRAM_SIZE; ++i)
+                buffer.histogram[i] += buffer.part[i];
+        }
+    };
+
+    /*! @ingroup cpp_pipeline
+
+        \short BackgroundPipeline structure keeps a dynamic background model and updates it frame by frame in a single pass over its planes.
+
+        The model consists of feature lower and upper bounds (lo, hi) and of their statistic counters (loCount, hiCount).
+        For every frame the structure performs the chain of background functions:
+        \verbatim
+        if (frame < growFrames)
+            BackgroundGrowRangeFast(value, lo, hi);
+        else
+        {
+            if (shift || adjust)
+            {
+                Fill(mask, 0);
+                BackgroundInitMask(zones, index, 0xFF, mask);
+            }
+            if (shift)
+                BackgroundShiftRangeMasked(value, lo, hi, mask);
+            BackgroundIncrementCount(value, lo, hi, loCount, hiCount);
+            if (adjust) // every adjustPeriod-th frame after the growing
+                BackgroundAdjustRangeMasked(loCount, lo, hiCount, hi, threshold, mask);
+        }
+        \endverbatim
+        The chain is run on horizontal strips sized to stay in L1 cache, so every plane of the model goes through the memory 
+        once per frame and the update mask never leaves the cache. The result is identical to the sequential calls of the functions for the whole frame.
+        When ::SimdSetThreadNumber sets more than one thread, bands of strips are processed on the global thread pool.
+
+        Using example:
+        \verbatim
+        #include "SimdPipeline.hpp"
+
+        int main()
+        {
+            typedef Simd::BackgroundPipeline<Simd::Allocator> Background;
+
+            Background::View value(1920, 1080, Background::View::Gray8), zones(1920, 1080, Background::View::Gray8);
+            Simd::Fill(zones, 1);
+
+            Background background(25, 50, 10);
+            background.Init(value);
+            for (size_t frame = 0; frame < 1000; ++frame)
+            {
+                // value = next frame
+                background.Update(value, zones);
+            }
+
+            return 0;
+        }
+        \endverbatim
+    */
+    template <template<class> class A>
+    struct BackgroundPipeline
+    {
+        typedef Simd::View<A> View; /*!< An image type definition. */
+
+        /*!
+            \short Kernels of the pipeline. They have the signatures of the corresponding functions of %Simd Library API.
+        */
+        struct Kernels
+        {
+            void (*growRangeFast)(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * lo, size_t loStride, uint8_t * hi, size_t hiStride); /*!< See ::SimdBackgroundGrowRangeFast. */
+            void (*incrementCount)(const uint8_t * value, size_t valueStride, size_t width, size_t height, const uint8_t * loValue, size_t loValueStride, const uint8_t * hiValue, size_t hiValueStride, uint8_t * loCount, size_t loCountStride, uint8_t * hiCount, size_t hiCountStride); /*!< See ::SimdBackgroundIncrementCount. */
+            void (*adjustRangeMasked)(uint8_t * loCount, size_t loCountStride, size_t width, size_t height, uint8_t * loValue, size_t loValueStride, uint8_t * hiCount, size_t hiCountStride, uint8_t * hiValue, size_t hiValueStride, uint8_t threshold, const uint8_t * mask, size_t maskStride); /*!< See ::SimdBackgroundAdjustRangeMasked. */
+            void (*shiftRangeMasked)(const uint8_t * value, size_t valueStride, size_t width, size_t height, uint8_t * lo, size_t loStride, uint8_t * hi, size_t hiStride, const uint8_t * mask, size_t maskStride); /*!< See ::SimdBackgroundShiftRangeMasked. */
+            void (*initMask)(const uint8_t * src, size_t srcStride, size_t width, size_t height, uint8_t index, uint8_t value, uint8_t * dst, size_t dstStride); /*!< See ::SimdBackgroundInitMask. */
+
+            /*!
+                Creates kernels which call the functions of %Simd Library API.
+            */
+            Kernels()
+                : growRangeFast(SimdBackgroundGrowRangeFast)
+                , incrementCount(SimdBackgroundIncrementCount)
+                , adjustRangeMasked(SimdBackgroundAdjustRangeMasked)
+                , shiftRangeMasked(SimdBackgroundShiftRangeMasked)
+                , initMask(SimdBackgroundInitMask)
+            {
+            }
+
+            /*!
+                Creates kernels from given functions.
+            */
+            Kernels(void (*growRangeFast_)(const uint8_t *, size_t, size_t, size_t, uint8_t *, size_t, uint8_t *, size_t),
+                void (*incrementCount_)(const uint8_t *, size_t, size_t, size_t, const uint8_t *, size_t, const uint8_t *, size_t, uint8_t *, size_t, uint8_t *, size_t),
+                void (*adjustRangeMasked_)(uint8_t *, size_t, size_t, size_t, uint8_t *, size_t, uint8_t *, size_t, uint8_t *, size_t, uint8_t, const uint8_t *, size_t),
+                void (*shiftRangeMasked_)(const uint8_t *, size_t, size_t, size_t, uint8_t *, size_t, uint8_t *, size_t, const uint8_t *, size_t),
+                void (*initMask_)(const uint8_t *, size_t, size_t, size_t, uint8_t, uint8_t, uint8_t *, size_t))
+                : growRangeFast(growRangeFast_)
+                , incrementCount(incrementCount_)
+                , adjustRangeMasked(adjustRangeMasked_)
+                , shiftRangeMasked(shiftRangeMasked_)
+                , initMask(initMask_)
+            {
+            }
+        };
+
+        /*!
+            Creates a new BackgroundPipeline structure.
+
+            \param [in] growFrames - a number of initial frames which only grow the background range.
+            \param [in] adjustPeriod - a period (in frames) of the background range adjustment after the growing. It must be positive.
+            \param [in] threshold - a count threshold of the background range adjustment (see ::SimdBackgroundAdjustRangeMasked).
+            \param [in] index - an index of the zones where the background is shifted and adjusted (see ::SimdBackgroundInitMask). By default it is equal to 1.
+            \param [in] stripHeight - a height of the strip. If it is equal to 0 it is estimated from the image width. By default it is equal to 0.
+            \param [in] kernels - kernels of the pipeline. By default the functions of %Simd Library API are used.
+        */
+        BackgroundPipeline(size_t growFrames, size_t adjustPeriod, uint8_t threshold, uint8_t index = 1, size_t stripHeight = 0, const Kernels & kernels = Kernels())
+            : _growFrames(growFrames)
+            , _adjustPeriod(adjustPeriod)
+            , _threshold(threshold)
+            , _index(index)
+            , _stripHeight(stripHeight)
+            , _kernels(kernels)
+            , _frame(0)
+        {
+            assert(adjustPeriod > 0);
+        }
+
+        /*!
+            Gets a height of the strip used for the image of given width.
+
+            \param [in] width - a width of the image.
+            \return - a height of the strip.
+        */
+        size_t StripHeight(size_t width) const
+        {
+            if (_stripHeight)
+                return _stripHeight;
+            const size_t rowSize = width*(1 + 1 + 1 + 1 + 1 + 1 + 1);
+            return std::max<size_t>(1, L1_BUDGET/rowSize);
+        }
+
+        /*!
+            Initializes the background model by the first frame: lo = hi = value, loCount = hiCount = 0.
+
+            \param [in] value - a first frame (8-bit gray image) of the feature value.
+        */
+        void Init(const View & value)
+        {
+            assert(value.format == View::Gray8);
+
+            _lo.Recreate(value.width, value.height, View::Gray8);
+            _hi.Recreate(value.width, value.height, View::Gray8);
+            _loCount.Recreate(value.width, value.height, View::Gray8);
+            _hiCount.Recreate(value.width, value.height, View::Gray8);
+            Simd::Copy(value, _lo);
+            Simd::Copy(value, _hi);
+            Simd::Fill(_loCount, 0);
+            Simd::Fill(_hiCount, 0);
+            _frame = 0;
+        }
+
+        /*!
+            Updates the background model by the next frame.
+
+            \param [in] value - a current frame (8-bit gray image) of the feature value.
+            \param [in] zones - an 8-bit gray image of zones. The background is shifted and adjusted only in the points where it is equal to index.
+            \param [in] shift - a flag to shift the background range to the current value (for example after a sudden change of illumination). By default it is false.
+        */
+        void Update(const View & value, const View & zones, bool shift = false)
+        {
+            assert(EqualSize(value, _lo) && EqualSize(zones, _lo) && value.format == View::Gray8 && zones.format == View::Gray8);
+
+            const size_t width = value.width, height = value.height, stripHeight = StripHeight(width);
+            const size_t stripCount = (height + stripHeight - 1)/stripHeight;
+            const size_t threadNumber = ThreadPool::InTask() ? 1 : std::min(ThreadNumber(), ThreadPool::Global().Size());
+            const size_t bandCount = std::max<size_t>(1, std::min(threadNumber, stripCount));
+            const bool grow = Grow(), adjust = Adjust();
+            shift = shift && !grow;
+
+            while (_masks.size() < bandCount)
+                _masks.push_back(ViewPtr(new View()));
+            for (size_t band = 0; band < bandCount; ++band)
+                if (_masks[band]->width != width || _masks[band]->height != stripHeight)
+                    _masks[band]->Recreate(width, stripHeight, View::Gray8);
+
+            ThreadPool::Global().Run(bandCount, [&](size_t band)
+            {
+                const size_t begin = stripCount*band/bandCount*stripHeight;
+                const size_t end = std::min(stripCount*(band + 1)/bandCount*stripHeight, height);
+                for (size_t top = begin; top < end; top += stripHeight)
+                    RunStrip(value, zones, top, std::min(top + stripHeight, end), grow, shift, adjust, *_masks[band]);
+            });
+
+            _frame++;
+        }
+
+        /*!
+            Gets a number of frames which were passed to the model after its initialization.
+
+            \return - a number of frames.
+        */
+        size_t Frame() const { return _frame; }
+
+        /*!
+            Checks if the next update only grows the background range.
+
+            \return - a result of the check.
+        */
+        bool Grow() const { return _frame < _growFrames; }
+
+        /*!
+            Checks if the next update adjusts the background range.
+
+            \return - a result of the check.
+        */
+        bool Adjust() const { return _frame >= _growFrames && (_frame - _growFrames + 1) % _adjustPeriod == 0; }
+
+        const View & Lo() const { return _lo; } /*!< Gets a feature lower bound of dynamic background. */
+        const View & Hi() const { return _hi; } /*!< Gets a feature upper bound of dynamic background. */
+        const View & LoCount() const { return _loCount; } /*!< Gets a count of feature lower bound of dynamic background. */
+        const View & HiCount() const { return _hiCount; } /*!< Gets a count of feature upper bound of dynamic background. */
+
+    private:
+        static const size_t L1_BUDGET = 32*1024;
+
+        typedef std::unique_ptr<View> ViewPtr;
+
+        size_t _growFrames, _adjustPeriod;
+        uint8_t _threshold, _index;
+        size_t _stripHeight;
+        Kernels _kernels;
+        size_t _frame;
+        View _lo, _hi, _loCount, _hiCount;
+        std::vector<ViewPtr> _masks; // Held by pointers for the same reason as GradientPipeline::_buffers.
+
+        void RunStrip(const View & value, const View & zones, size_t top, size_t bottom, bool grow, bool shift, bool adjust, View & mask)
+        {
+            const size_t width = value.width, height = bottom - top;
+            const uint8_t * v = value.data + top*value.stride;
+            uint8_t * lo = _lo.data + top*_lo.stride;
+            uint8_t * hi = _hi.data + top*_hi.stride;
+
+            if (grow)
+            {
+                _kernels.growRangeFast(v, value.stride, width, height, lo, _lo.stride, hi, _hi.stride);
+                return;
+            }
+
+            uint8_t * loCount = _loCount.data + top*_loCount.stride;
+            uint8_t * hiCount = _hiCount.data + top*_hiCount.stride;
+            if (shift || adjust)
+            {
+                for (size_t row = 0; row < height; ++row)
+                    memset(mask.data + row*mask.stride, 0, width);
+                _kernels.initMask(zones.data + top*zones.stride, zones.stride, width, height, _index, 0xFF, mask.data, mask.stride);
+            }
+            if (shift)
+                _kernels.shiftRangeMasked(v, value.stride, width, height, lo, _lo.stride, hi, _hi.stride, mask.data, mask.stride);
+            _kernels.incrementCount(v, value.stride, width, height, lo, _lo.stride, hi, _hi.stride, loCount, _loCount.stride, hiCount, _hiCount.stride);
+            if (adjust)
+                _kernels.adjustRangeMasked(loCount, _loCount.stride, width, height, lo, _lo.stride, hiCount, _hiCount.stride, hi, _hi.stride, _threshold, mask.data, mask.stride);
+        }
+    };
+}
+
+#endif//__SimdPipeline_hpp__
@@ -0,0 +1,270 @@
+/*
+* Simd Library (http://simd.sourceforge.net).
+*
+* Copyright (c) 2011-2016 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy 
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell 
+* copies of the Software, and to permit persons to whom the Software is 
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in 
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR 
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, 
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE 
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER 
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Simd/SimdMemory.h"
+#include "Simd/SimdConst.h"
+
+namespace Simd
+{
+#ifdef SIMD_SSE2_ENABLE    
+    namespace Sse2
+    {
+        namespace
+        {
+            template <class T> struct Carry;
+            template <> struct Carry<uint32_t> { typedef __m128i Type; static Type Zero() { return _mm_setzero_si128(); } };
+            template <> struct Carry<double> { typedef __m128d Type; static Type Zero() { return _mm_setzero_pd(); } };
+        }
+
+        SIMD_INLINE __m128i PrefixSum16(__m128i a)
+        {
+            a = _mm_add_epi16(a, _mm_slli_si128(a, 2));
+            a = _mm_add_epi16(a, _mm_slli_si128(a, 4));
+            return _mm_add_epi16(a, _mm_slli_si128(a, 8));
+        }
+
+        SIMD_INLINE __m128i PrefixSum32(__m128i a)
+        {
+            a = _mm_add_epi32(a, _mm_slli_si128(a, 4));
+            return _mm_add_epi32(a, _mm_slli_si128(a, 8));
+        }
+
+        SIMD_INLINE __m128i Last32(__m128i a)
+        {
+            return _mm_shuffle_epi32(a, 0xFF);
+        }
+
+        // Prefix sums of 16 pixels, within the block: 8 pixels fit the 16-bit scan
+        SIMD_INLINE void BlockSum(__m128i src, __m128i sum[4])
+        {
+            __m128i lo = PrefixSum16(_mm_unpacklo_epi8(src, K_ZERO));
+            __m128i hi = PrefixSum16(_mm_unpackhi_epi8(src, K_ZERO));
+            sum[0] = _mm_unpacklo_epi16(lo, K_ZERO);
+            sum[1] = _mm_unpackhi_epi16(lo, K_ZERO);
+            __m128i carry = Last32(sum[1]);
+            sum[2] = _mm_add_epi32(_mm_unpacklo_epi16(hi, K_ZERO), carry);
+            sum[3] = _mm_add_epi32(_mm_unpackhi_epi16(hi, K_ZERO), carry);
+        }
+
+        // Prefix sums of the squares of 16 pixels, within the block
+        SIMD_INLINE void BlockSqsum(__m128i src, __m128i sqsum[4])
+        {
+            __m128i lo = _mm_unpacklo_epi8(src, K_ZERO);
+            __m128i hi = _mm_unpackhi_epi8(src, K_ZERO);
+            lo = _mm_mullo_epi16(lo, lo);
+            hi = _mm_mullo_epi16(hi, hi);
+            sqsum[0] = PrefixSum32(_mm_unpacklo_epi16(lo, K_ZERO));
+            sqsum[1] = _mm_add_epi32(PrefixSum32(_mm_unpackhi_epi16(lo, K_ZERO)), Last32(sqsum[0]));
+            sqsum[2] = _mm_add_epi32(PrefixSum32(_mm_unpacklo_epi16(hi, K_ZERO)), Last32(sqsum[1]));
+            sqsum[3] = _mm_add_epi32(PrefixSum32(_mm_unpackhi_epi16(hi, K_ZERO)), Last32(sqsum[2]));
+        }
+
+        SIMD_INLINE void StoreSum(uint32_t * dst, const uint32_t * above, __m128i local, __m128i carry)
+        {
+            __m128i value = _mm_add_epi32(_mm_add_epi32(local, carry), _mm_loadu_si128((__m128i*)above));
+            _mm_storeu_si128((__m128i*)dst, value);
+        }
+
+        SIMD_INLINE void StoreSum(double * dst, const double * above, __m128i local, __m128d carry)
+        {
+            __m128d lo = _mm_add_pd(_mm_cvtepi32_pd(local), carry);
+            __m128d hi = _mm_add_pd(_mm_cvtepi32_pd(_mm_shuffle_epi32(local, 0xEE)), carry);
+            _mm_storeu_pd(dst + 0, _mm_add_pd(lo, _mm_loadu_pd(above + 0)));
+            _mm_storeu_pd(dst + 2, _mm_add_pd(hi, _mm_loadu_pd(above + 2)));
+        }
+
+        SIMD_INLINE void UpdateCarry(__m128i & carry, __m128i local)
+        {
+            carry = _mm_add_epi32(carry, Last32(local));
+        }
+
+        SIMD_INLINE void UpdateCarry(__m128d & carry, __m128i local)
+        {
+            carry = _mm_add_pd(carry, _mm_cvtepi32_pd(Last32(local)));
+        }
+
+        SIMD_INLINE uint32_t ExtractCarry(__m128i carry)
+        {
+            return _mm_cvtsi128_si32(carry);
+        }
+
+        SIMD_INLINE double ExtractCarry(__m128d carry)
+        {
+            return _mm_cvtsd_f64(carry);
+        }
+
+        template <bool sqsumEnable, class TSqsum> void IntegralRow(const uint8_t * src, size_t width,
+            uint32_t * sum, const uint32_t * sumAbove, TSqsum * sqsum, const TSqsum * sqsumAbove)
+        {
+            size_t alignedWidth = AlignLo(width, A);
+            __m128i sumCarry = _mm_setzero_si128();
+            typename Carry<TSqsum>::Type sqsumCarry = Carry<TSqsum>::Zero();
+            __m128i local[4];
+            size_t col = 0;
+            for (; col < alignedWidth; col += A)
+            {
+                __m128i _src = _mm_loadu_si128((__m128i*)(src + col));
+                BlockSum(_src, local);
+                for (size_t i = 0; i < 4; ++i)
+                    StoreSum(sum + col + 4 * i, sumAbove + col + 4 * i, local[i], sumCarry);
+                UpdateCarry(sumCarry, local[3]);
+                if (sqsumEnable)
+                {
+                    BlockSqsum(_src, local);
+                    for (size_t i = 0; i < 4; ++i)
+                        StoreSum(sqsum + col + 4 * i, sqsumAbove + col + 4 * i, local[i], sqsumCarry);
+                    UpdateCarry(sqsumCarry, local[3]);
+                }
+            }
+            uint32_t rowSum = ExtractCarry(sumCarry);
+            TSqsum rowSqsum = sqsumEnable ? ExtractCarry(sqsumCarry) : 0;
+            for (; col < width; ++col)
+            {
+                uint32_t value = src[col];
+                rowSum += value;
+                sum[col] = rowSum + sumAbove[col];
+                if (sqsumEnable)
+                {
+                    rowSqsum += value*value;
+                    sqsum[col] = rowSqsum + sqsumAbove[col];
+                }
+            }
+        }
+
+        /*
+        * The tilted sum follows Base::IntegralSumTilted: buffer[col] is the sum of src along the diagonal
+        * going up and right from (row, col), and for row > 0, col > 0:
+        * tilted[col] = buffer[col] + buffer[col + 1] + src[col] + tiltedAbove[col - 1],
+        * where buffer is that of the row above. Column 0 uses tiltedAbove[0] in place of buffer[0].
+        */
+        SIMD_INLINE void TiltedBlock(__m128i _src, uint32_t * buffer, uint32_t * tilted, const uint32_t * tiltedAbove)
+        {
+            __m128i b0 = _mm_loadu_si128((__m128i*)buffer);
+            __m128i b1 = _mm_loadu_si128((__m128i*)(buffer + 1));
+            __m128i t = _mm_add_epi32(_mm_add_epi32(b0, b1), _mm_add_epi32(_src, _mm_loadu_si128((__m128i*)(tiltedAbove - 1))));
+            _mm_storeu_si128((__m128i*)buffer, _mm_add_epi32(b1, _src));
+            _mm_storeu_si128((__m128i*)tilted, t);
+        }
+
+        void IntegralTiltedRow(const uint8_t * src, size_t width, uint32_t * buffer, uint32_t * tilted, const uint32_t * tiltedAbove)
+        {
+            size_t alignedWidth = AlignLo(width, A);
+            uint32_t first = tiltedAbove[0] + src[0] + buffer[1];
+            size_t col = 0;
+            for (; col < alignedWidth; col += A)
+            {
+                __m128i _src = _mm_loadu_si128((__m128i*)(src + col));
+                __m128i lo = _mm_unpacklo_epi8(_src, K_ZERO);
+                __m128i hi = _mm_unpackhi_epi8(_src, K_ZERO);
+                TiltedBlock(_mm_unpacklo_epi16(lo, K_ZERO), buffer + col + 0, tilted + col + 0, tiltedAbove + col + 0);
+                TiltedBlock(_mm_unpackhi_epi16(lo, K_ZERO), buffer + col + 4, tilted + col + 4, tiltedAbove + col + 4);
+                TiltedBlock(_mm_unpacklo_epi16(hi, K_ZERO), buffer + col + 8, tilted + col + 8, tiltedAbove + col + 8);
+                TiltedBlock(_mm_unpackhi_epi16(hi, K_ZERO), buffer + col + 12, tilted + col + 12, tiltedAbove + col + 12);
+            }
+            for (; col < width; ++col)
+            {
+                uint32_t b1 = buffer[col + 1];
+                tilted[col] = buffer[col] + b1 + src[col] + tiltedAbove[col - 1];
+                buffer[col] = b1 + src[col];
+            }
+            tilted[0] = first;
+        }
+
+        template <bool sqsumEnable, class TSqsum> void Integral(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+            uint32_t * sum, size_t sumStride, TSqsum * sqsum, size_t sqsumStride, uint32_t * tilted, size_t tiltedStride)
+        {
+            memset(sum, 0, (width + 1)*sizeof(uint32_t));
+            sum += sumStride + 1;
+            if (sqsumEnable)
+            {
+                memset(sqsum, 0, (width + 1)*sizeof(TSqsum));
+                sqsum += sqsumStride + 1;
+            }
+            uint32_t * buffer = NULL;
+            if (tilted)
+            {
+                memset(tilted, 0, (width + 1)*sizeof(uint32_t));
+                tilted += tiltedStride + 1;
+                buffer = (uint32_t*)Allocate((width + 1)*sizeof(uint32_t));
+                buffer[width] = 0;
+            }
+
+            for (size_t row = 0; row < height; ++row)
+            {
+                sum[-1] = 0;
+                if (sqsumEnable)
+                    sqsum[-1] = 0;
+                IntegralRow<sqsumEnable>(src, width, sum, sum - sumStride, sqsum, sqsumEnable ? sqsum - sqsumStride : NULL);
+                if (tilted)
+                {
+                    tilted[-1] = row ? tilted[-tiltedStride] : 0;
+                    if (row)
+                        IntegralTiltedRow(src, width, buffer, tilted, tilted - tiltedStride);
+                    else
+                    {
+                        for (size_t col = 0; col < width; ++col)
+                            tilted[col] = buffer[col] = src[col];
+                    }
+                    tilted += tiltedStride;
+                }
+                src += srcStride;
+                sum += sumStride;
+                if (sqsumEnable)
+                    sqsum += sqsumStride;
+            }
+
+            if (buffer)
+                Free(buffer);
+        }
+
+        void Integral(const uint8_t * src, size_t srcStride, size_t width, size_t height,
+            uint8_t * sum, size_t sumStride, uint8_t * sqsum, size_t sqsumStride, uint8_t * tilted, size_t tiltedStride,
+            SimdPixelFormatType sumFormat, SimdPixelFormatType sqsumFormat)
+        {
+            assert(sumFormat == SimdPixelFormatInt32 && sumStride%sizeof(uint32_t) == 0);
+            if (tilted)
+                assert(tiltedStride%sizeof(uint32_t) == 0);
+
+            if (sqsum)
+            {
+                switch (sqsumFormat)
+                {
+                case SimdPixelFormatInt32:
+                    Integral<true, uint32_t>(src, srcStride, width, height, (uint32_t*)sum, sumStride/sizeof(uint32_t),
+                        (uint32_t*)sqsum, sqsumStride/sizeof(uint32_t), (uint32_t*)tilted, tiltedStride/sizeof(uint32_t));
+                    break;
+                case SimdPixelFormatDouble:
+                    Integral<true, double>(src, srcStride, width, height, (uint32_t*)sum, sumStride/sizeof(uint32_t),
+                        (double*)sqsum, sqsumStride/sizeof(double), (uint32_t*)tilted, tiltedStride/sizeof(uint32_t));
+                    break;
+                default:
+                    assert(0);
+                }
+            }
+            else
+                Integral<false, uint32_t>(src, srcStride, width, height, (uint32_t*)sum, sumStride/sizeof(uint32_t),
+                    NULL, 0, (uint32_t*)tilted, tiltedStride/sizeof(uint32_t));
+        }
+    }
+#endif// SIMD_SSE2_ENABLE
+}
@@ -32,6 +32,12 @@ namespace Simd
     namespace Sse42
     {
         uint32_t Crc32c(const void * src, size_t size);
+
+#ifdef SIMD_PCLMUL_ENABLE
+        uint32_t Crc32cInterleaved(const void * src, size_t size);
+
+        uint32_t Crc32cFolded(const void * src, size_t size);
+#endif//SIMD_PCLMUL_ENABLE
     }
 #endif// SIMD_SSE42_ENABLE
 }
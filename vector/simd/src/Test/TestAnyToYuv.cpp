@@ -43,6 +43,7 @@ namespace Test
 			void Call(const View & bgr, View & y, View & u, View & v) const
 			{
 				TEST_PERFORMANCE_TEST(description);
+				TEST_PERFORMANCE_TEST_SET_PIXELS(bgr.width*bgr.height);
 				func(bgr.data, bgr.width, bgr.height, bgr.stride, y.data, y.stride, u.data, u.stride, v.data, v.stride);
 			}
 		};	
@@ -40,6 +40,7 @@ namespace Test
 			void Call(const View & src, View & dst, uint8_t alpha) const
 			{
 				TEST_PERFORMANCE_TEST(description);
+				TEST_PERFORMANCE_TEST_SET_PIXELS(src.width*src.height);
 				func(src.data, src.width, src.height, src.stride, (SimdPixelFormatType)src.format, dst.data, dst.stride, alpha);
 			}
 		};	
@@ -88,6 +89,11 @@ namespace Test
 
         result = result && BayerToBgraAutoTest(FUNC(Simd::Base::BayerToBgra), FUNC(SimdBayerToBgra));
 
+#ifdef SIMD_AVX2_ENABLE
+        if(Simd::Avx2::Enable && W >= int(Simd::Avx2::A + 4))
+            result = result && BayerToBgraAutoTest(FUNC(Simd::Avx2::BayerToBgra), FUNC(SimdBayerToBgra));
+#endif 
+
         return result;    
     }
 
@@ -41,6 +41,7 @@ namespace Test
             void Call(const View & blue, const View & green, const View & red, View & bgra, uint8_t alpha) const
             {
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(blue.width*blue.height);
                 func(blue.data, blue.stride, blue.width, blue.height, green.data, green.stride, red.data, red.stride, bgra.data, bgra.stride, alpha);
             }
         };	
@@ -102,6 +103,11 @@ namespace Test
             result = result && Bgr48pToBgra32AutoTest(FUNC(Simd::Avx2::Bgr48pToBgra32), FUNC(SimdBgr48pToBgra32));
 #endif 
 
+#ifdef SIMD_AVX512BW_ENABLE
+        if(Simd::Avx512bw::Enable)
+            result = result && Bgr48pToBgra32AutoTest(FUNC(Simd::Avx512bw::Bgr48pToBgra32), FUNC(SimdBgr48pToBgra32));
+#endif 
+
 #ifdef SIMD_VMX_ENABLE
         if(Simd::Vmx::Enable)
             result = result && Bgr48pToBgra32AutoTest(FUNC(Simd::Vmx::Bgr48pToBgra32), FUNC(SimdBgr48pToBgra32));
@@ -59,6 +59,7 @@
 #include "Simd/SimdSse42.h"
 #include "Simd/SimdAvx1.h"
 #include "Simd/SimdAvx2.h"
+#include "Simd/SimdAvx512bw.h"
 #include "Simd/SimdVmx.h"
 #include "Simd/SimdVsx.h"
 #include "Simd/SimdNeon.h"
@@ -77,13 +78,10 @@ namespace Test
     typedef std::vector<uint64_t> Sums64;
     typedef std::vector<float> Buffer32f;
 
-#ifdef TEST_PERFORMANCE_TEST_ENABLE
-	const int W = 1920;
-	const int H = 1080;
-#else
-    const int W = 128;
-    const int H = 96;
-#endif
+    // Frame size of the tests (1920x1080 for performance builds, 128x96 otherwise),
+    // can be changed at run time, see SizeSweep.
+    extern int W;
+    extern int H;
 
     const int E = 10;
     const int O = 9;
@@ -41,6 +41,7 @@ namespace Test
             void Call(const View & src, View & dst) const
             {
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(src.width*src.height);
                 func(src.data, src.stride, src.width, src.height, src.PixelSize(), dst.data, dst.stride);
             }
         };
@@ -116,6 +117,7 @@ namespace Test
             void Call(const View & src, const Rect & frame, View & dst) const
             {
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(src.width*src.height);
                 func(src.data, src.stride, src.width, src.height, src.PixelSize(), 
                     frame.left, frame.top, frame.right, frame.bottom, dst.data, dst.stride);
             }
@@ -41,8 +41,14 @@ namespace Test
 			uint32_t Call(const std::vector<uint8_t> & src) const
 			{
 				TEST_PERFORMANCE_TEST(description);
+				TEST_PERFORMANCE_TEST_SET_PIXELS(src.size());
 				return func(src.data(), src.size());
 			}
+
+			uint32_t Call(const uint8_t * src, size_t size) const
+			{
+				return func(src, size);
+			}
 		};
 	}
 
@@ -86,6 +92,68 @@ namespace Test
         return result;
     }
 
+    // Checks every function against the first one for all sizes up to 4096 and some larger ones at all
+    // alignments, then prints the bandwidth of each function for buffers from 64 B to 64 MB.
+    bool Crc32cBandwidthTest(const std::vector<Func> & funcs)
+    {
+        bool result = true;
+
+        const size_t sizeMax = 64*1024*1024;
+        std::vector<uint8_t> src(sizeMax + 8);
+        SetRandom(src.data(), src.size());
+
+        std::vector<size_t> sizes;
+        for(size_t size = 0; size <= 4096; ++size)
+            sizes.push_back(size);
+        for(size_t size = 3*8192 - 1; size < 3*8192*3; size += 3*8192 - 257)
+            sizes.push_back(size);
+        TEST_LOG_SS(Info, "Test " << funcs.size() << " CRC32C functions for sizes up to " << sizes.back() << " at offsets 0..7.");
+        for(size_t i = 0; i < sizes.size() && result; ++i)
+        {
+            const uint8_t * data = src.data() + i%8;
+            uint32_t crc1 = funcs[0].Call(data, sizes[i]);
+            for(size_t f = 1; f < funcs.size(); ++f)
+            {
+                uint32_t crc2 = funcs[f].Call(data, sizes[i]);
+                if(crc1 != crc2)
+                {
+                    TEST_LOG_SS(Error, "Error " << funcs[f].description << " for size " << sizes[i] << " and offset " << i%8 << ": (" << crc1 << " != " << crc2 << ")! ");
+                    result = false;
+                }
+            }
+        }
+
+        std::stringstream table;
+        table << "CRC32C bandwidth (GB/s):" << std::endl << ExpandToLeft("size", 10);
+        for(size_t f = 0; f < funcs.size(); ++f)
+            table << "  " << funcs[f].description;
+        table << std::endl;
+        const double minTime = PerformanceOptions::Get().minTime;
+        for(size_t size = 64; size <= sizeMax && result; size *= 4)
+        {
+            table << ExpandToLeft(size < 1024 ? ToString(size) + " B" : (size < 1024*1024 ? ToString(size/1024) + " KB" : ToString(size/1024/1024) + " MB"), 10);
+            const size_t count = std::max<size_t>(1, 1024*1024/size);
+            for(size_t f = 0; f < funcs.size(); ++f)
+            {
+                funcs[f].Call(src.data(), size);
+                size_t total = 0;
+                double start = GetTime(), time = 0;
+                do
+                {
+                    for(size_t i = 0; i < count; ++i)
+                        funcs[f].Call(src.data(), size);
+                    total += count;
+                    time = GetTime() - start;
+                } while(time < minTime);
+                table << "  " << ExpandToLeft(ToString(double(size)*total/time/1000000000.0, 3, 2), funcs[f].description.size());
+            }
+            table << std::endl;
+        }
+        TEST_LOG_SS(Info, table.str());
+
+        return result;
+    }
+
     bool Crc32cAutoTest()
     {
         bool result = true;
@@ -97,6 +165,38 @@ namespace Test
             result = result && Crc32AutoTest(FUNC(Simd::Sse42::Crc32c), FUNC(SimdCrc32c));
 #endif 
 
+#if defined(SIMD_SSE42_ENABLE) && defined(SIMD_PCLMUL_ENABLE)
+        if(Simd::Sse42::PclmulEnable)
+        {
+            result = result && Crc32AutoTest(FUNC(Simd::Sse42::Crc32cInterleaved), FUNC(SimdCrc32c));
+            result = result && Crc32AutoTest(FUNC(Simd::Sse42::Crc32cFolded), FUNC(SimdCrc32c));
+        }
+#endif 
+
+#if defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_VPCLMULQDQ_ENABLE)
+        if(Simd::Avx512bw::VpclmulqdqEnable)
+            result = result && Crc32AutoTest(FUNC(Simd::Avx512bw::Crc32c), FUNC(SimdCrc32c));
+#endif 
+
+        std::vector<Func> funcs(1, FUNC(Simd::Base::Crc32c));
+#ifdef SIMD_SSE42_ENABLE
+        if(Simd::Sse42::Enable)
+            funcs.push_back(FUNC(Simd::Sse42::Crc32c));
+#endif 
+#if defined(SIMD_SSE42_ENABLE) && defined(SIMD_PCLMUL_ENABLE)
+        if(Simd::Sse42::PclmulEnable)
+        {
+            funcs.push_back(FUNC(Simd::Sse42::Crc32cInterleaved));
+            funcs.push_back(FUNC(Simd::Sse42::Crc32cFolded));
+        }
+#endif 
+#if defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_VPCLMULQDQ_ENABLE)
+        if(Simd::Avx512bw::VpclmulqdqEnable)
+            funcs.push_back(FUNC(Simd::Avx512bw::Crc32c));
+#endif 
+        funcs.push_back(FUNC(SimdCrc32c));
+        result = result && Crc32cBandwidthTest(funcs);
+
         return result;
     }
 
@@ -42,6 +42,7 @@ namespace Test
 			void Call(const View & a, const View & b, uint64_t * sum) const
 			{
 				TEST_PERFORMANCE_TEST(description);
+				TEST_PERFORMANCE_TEST_SET_PIXELS(a.width*a.height);
 				func(a.data, a.stride, b.data, b.stride, a.width, a.height, sum);
 			}
 		};
@@ -59,6 +60,7 @@ namespace Test
 			void Call(const View & a, const View & b, const View & mask, uint8_t index, uint64_t * sum) const
 			{
 				TEST_PERFORMANCE_TEST(description);
+				TEST_PERFORMANCE_TEST_SET_PIXELS(a.width*a.height);
 				func(a.data, a.stride, b.data, b.stride, mask.data, mask.stride, index, a.width, a.height, sum);
 			}
 		};
@@ -75,6 +77,7 @@ namespace Test
             void Call(const View & a, const View & b, float * sum) const
             {
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(a.width);
                 func((float*)a.data, (float*)b.data, a.width, sum);
             }
         };
@@ -274,6 +277,11 @@ namespace Test
             result = result && DifferenceSumsAutoTest(FUNC_S(Simd::Avx2::AbsDifferenceSum), FUNC_S(SimdAbsDifferenceSum), 1);
 #endif 
 
+#ifdef SIMD_AVX512BW_ENABLE
+        if(Simd::Avx512bw::Enable)
+            result = result && DifferenceSumsAutoTest(FUNC_S(Simd::Avx512bw::AbsDifferenceSum), FUNC_S(SimdAbsDifferenceSum), 1);
+#endif 
+
 #ifdef SIMD_VMX_ENABLE
         if(Simd::Vmx::Enable)
             result = result && DifferenceSumsAutoTest(FUNC_S(Simd::Vmx::AbsDifferenceSum), FUNC_S(SimdAbsDifferenceSum), 1);
@@ -303,6 +311,11 @@ namespace Test
             result = result && DifferenceSumsMaskedAutoTest(FUNC_M(Simd::Avx2::AbsDifferenceSumMasked), FUNC_M(SimdAbsDifferenceSumMasked), 1);
 #endif 
 
+#ifdef SIMD_AVX512BW_ENABLE
+        if(Simd::Avx512bw::Enable)
+            result = result && DifferenceSumsMaskedAutoTest(FUNC_M(Simd::Avx512bw::AbsDifferenceSumMasked), FUNC_M(SimdAbsDifferenceSumMasked), 1);
+#endif 
+
 #ifdef SIMD_VMX_ENABLE
         if(Simd::Vmx::Enable)
             result = result && DifferenceSumsMaskedAutoTest(FUNC_M(Simd::Vmx::AbsDifferenceSumMasked), FUNC_M(SimdAbsDifferenceSumMasked), 1);
@@ -41,6 +41,7 @@ namespace Test
             void Call(View & dst, uint8_t value) const
             {
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(dst.width*dst.height);
                 func(dst.data, dst.stride, dst.width, dst.height, dst.PixelSize(), value);
             }
         };
@@ -113,6 +114,7 @@ namespace Test
             void Call(View & dst, const Rect & frame, uint8_t value) const
             {
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(dst.width*dst.height);
                 func(dst.data, dst.stride, dst.width, dst.height, dst.PixelSize(), 
                     frame.left, frame.top, frame.right, frame.bottom, value);
             }
@@ -188,6 +190,7 @@ namespace Test
 			void Call(View & dst, uint8_t blue, uint8_t green, uint8_t red, uint8_t alpha) const
 			{
 				TEST_PERFORMANCE_TEST(description);
+				TEST_PERFORMANCE_TEST_SET_PIXELS(dst.width*dst.height);
 				func(dst.data, dst.stride, dst.width, dst.height, blue, green, red, alpha);
 			}
 		};
@@ -273,6 +276,7 @@ namespace Test
             void Call(View & dst, uint8_t blue, uint8_t green, uint8_t red) const
             {
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(dst.width*dst.height);
                 func(dst.data, dst.stride, dst.width, dst.height, blue, green, red);
             }
         };
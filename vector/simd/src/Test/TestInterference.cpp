@@ -42,6 +42,7 @@ namespace Test
 			{
 				Simd::Copy(statisticSrc, statisticDst);
 				TEST_PERFORMANCE_TEST(description);
+				TEST_PERFORMANCE_TEST_SET_PIXELS(statisticDst.width*statisticDst.height);
 				func(statisticDst.data, statisticDst.stride, statisticDst.width, statisticDst.height, value, saturation);
 			}
 		};
@@ -60,6 +61,7 @@ namespace Test
             {
                 Simd::Copy(statisticSrc, statisticDst);
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(statisticDst.width*statisticDst.height);
                 func(statisticDst.data, statisticDst.stride, statisticDst.width, statisticDst.height, 
                     value, saturation, mask.data, mask.stride, index);
             }
@@ -24,17 +24,69 @@
 #include "Test/TestPerformance.h"
 #include "Test/TestUtils.h"
 
+#include "Simd/SimdParallel.hpp"
+
+#include <climits>
+#include <cstdlib>
+
 #if defined(_MSC_VER)
 #define NOMINMAX
 #include <windows.h>
 #elif defined(__GNUC__)
-#include <sys/time.h>
+#include <time.h>
+#include <sched.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <errno.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
 #else
 #error Platform is not supported!
 #endif
 
 namespace Test
 {
+#ifdef TEST_PERFORMANCE_TEST_ENABLE
+    int W = 1920;
+    int H = 1080;
+#else
+    int W = 128;
+    int H = 96;
+#endif
+
+    static int GetEnv(const char * name, int value)
+    {
+        const char * env = getenv(name);
+        return env ? atoi(env) : value;
+    }
+
+    static PerformanceOptions ParsePerformanceOptions()
+    {
+        PerformanceOptions options;
+        options.warmup = std::max(0, GetEnv("TEST_WARMUP", 1));
+        options.repeats = std::max(1, GetEnv("TEST_REPEATS", 1));
+        const char * minTime = getenv("TEST_MIN_TIME");
+        options.minTime = minTime ? atof(minTime) : MINIMAL_TEST_EXECUTION_TIME;
+        options.cpu = GetEnv("TEST_CPU", -1);
+        const char * clock = getenv("TEST_CLOCK");
+        options.tsc = clock && String(clock) == "tsc";
+        options.counters = GetEnv("TEST_PERF_COUNTERS", 0) != 0;
+        return options;
+    }
+
+    const PerformanceOptions & PerformanceOptions::Get()
+    {
+        // The initialization of a local static is thread-safe: the options may be first read by several measuring threads.
+        static const PerformanceOptions options = ParsePerformanceOptions();
+        return options;
+    }
+
 #if defined(_MSC_VER)
 	double GetFrequency()
 	{
@@ -52,11 +104,34 @@ namespace Test
 		return double(counter.QuadPart)/g_frequency;
 	}
 #elif defined(__GNUC__)
+	static double GetMonotonicTime()
+	{
+		timespec t;
+		clock_gettime(CLOCK_MONOTONIC, &t);
+		return t.tv_sec + t.tv_nsec / 1000000000.0;
+	}
+
+#if defined(__x86_64__) || defined(__i386__)
+	static double GetTscFrequency()
+	{
+		double start = GetMonotonicTime(), finish = start;
+		unsigned long long tsc = __rdtsc();
+		while (finish - start < 0.02)
+			finish = GetMonotonicTime();
+		return double(__rdtsc() - tsc) / (finish - start);
+	}
+#endif
+
 	double GetTime()
 	{
-		timeval t1;
-		gettimeofday(&t1, NULL);
-		return t1.tv_sec + t1.tv_usec / 1000000.0;
+#if defined(__x86_64__) || defined(__i386__)
+		if (PerformanceOptions::Get().tsc)
+		{
+			static const double frequency = GetTscFrequency();
+			return double(__rdtsc()) / frequency;
+		}
+#endif
+		return GetMonotonicTime();
 	}
 #else
 #error Platform is not supported!
@@ -64,6 +139,93 @@ namespace Test
 
 	//-------------------------------------------------------------------------
 
+#if defined(__linux__)
+    static int OpenCounter(uint32_t type, uint64_t config, int leader)
+    {
+        perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.type = type;
+        attr.size = sizeof(attr);
+        attr.config = config;
+        attr.disabled = leader < 0 ? 1 : 0;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP;
+        return (int)syscall(__NR_perf_event_open, &attr, 0, -1, leader, 0);
+    }
+#endif
+
+    PerformanceCounters::PerformanceCounters()
+        : _leader(-1)
+        , _opened(0)
+    {
+        for (int i = 0; i < Size; ++i)
+        {
+            _fd[i] = -1;
+            _index[i] = -1;
+        }
+#if defined(__linux__)
+        if (!PerformanceOptions::Get().counters)
+            return;
+        const uint64_t cache = PERF_COUNT_HW_CACHE_OP_READ << 8 | PERF_COUNT_HW_CACHE_RESULT_MISS << 16;
+        const uint32_t types[Size] = { PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE, PERF_TYPE_HW_CACHE, PERF_TYPE_HARDWARE };
+        const uint64_t configs[Size] = { PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+            PERF_COUNT_HW_CACHE_L1D | cache, PERF_COUNT_HW_CACHE_LL | cache, PERF_COUNT_HW_BRANCH_MISSES };
+        for (int i = 0; i < Size; ++i)
+        {
+            _fd[i] = OpenCounter(types[i], configs[i], _leader);
+            if (_fd[i] < 0)
+            {
+                if (i == Cycles)
+                {
+                    TEST_LOG_SS(Error, "Can't open hardware performance counters (perf_event_open: " << strerror(errno) << ")!");
+                    return;
+                }
+                continue;
+            }
+            if (i == Cycles)
+                _leader = _fd[i];
+            _index[i] = _opened++;
+        }
+        ioctl(_leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+    }
+
+    PerformanceCounters::~PerformanceCounters()
+    {
+#if defined(__linux__)
+        for (int i = 0; i < Size; ++i)
+            if (_fd[i] >= 0)
+                close(_fd[i]);
+#endif
+    }
+
+    // The counters of a thread see only its own work (the counts of inherited threads would be added when they exit, and the
+    // pool threads never do), so they are not captured when the filters run on more than one thread.
+    static bool CountersCaptured()
+    {
+        return PerformanceOptions::Get().counters && SimdGetThreadNumber() <= 1;
+    }
+
+    PerformanceCounters & PerformanceCounters::ThisThread()
+    {
+        static thread_local PerformanceCounters counters;
+        return counters;
+    }
+
+    void PerformanceCounters::Read(uint64_t values[Size]) const
+    {
+        uint64_t buffer[Size + 1] = { 0 };
+#if defined(__linux__)
+        if (Enabled() && read(_leader, buffer, sizeof(buffer)) < (ssize_t)sizeof(uint64_t))
+            buffer[0] = 0;
+#endif
+        for (int i = 0; i < Size; ++i)
+            values[i] = _index[i] >= 0 && _index[i] < (int)buffer[0] ? buffer[1 + _index[i]] : 0;
+    }
+
+	//-------------------------------------------------------------------------
+
 	PerformanceMeasurer::PerformanceMeasurer(const String & description)
         : _description(description)
         , _count(0)
@@ -72,7 +234,10 @@ namespace Test
         , _min(std::numeric_limits<double>::max())
         , _max(std::numeric_limits<double>::min())
         , _size(0)
+        , _pixels(0)
     {
+        for (int i = 0; i < PerformanceCounters::Size; ++i)
+            _counters[i] = 0;
     }
 
     PerformanceMeasurer::PerformanceMeasurer(const PerformanceMeasurer & pm)
@@ -83,7 +248,11 @@ namespace Test
         , _min(pm._min)
         , _max(pm._max)
         , _size(pm._size)
+        , _pixels(pm._pixels)
+        , _samples(pm._samples)
     {
+        for (int i = 0; i < PerformanceCounters::Size; ++i)
+            _counters[i] = pm._counters[i];
     }
 
     void PerformanceMeasurer::Enter()
@@ -91,21 +260,32 @@ namespace Test
         if (!_entered)
         {
             _entered = true;
+            if (CountersCaptured())
+                PerformanceCounters::ThisThread().Read(_counterStart);
             _start = GetTime();
         }
     }
 
-    void PerformanceMeasurer::Leave(size_t size)
+    void PerformanceMeasurer::Leave(size_t size, size_t pixels)
     {
         if (_entered)
         {
             _entered = false;
             double difference = double(GetTime() - _start);
+            if (CountersCaptured())
+            {
+                uint64_t counters[PerformanceCounters::Size];
+                PerformanceCounters::ThisThread().Read(counters);
+                for (int i = 0; i < PerformanceCounters::Size; ++i)
+                    _counters[i] += counters[i] - _counterStart[i];
+            }
             _total += difference;
             _min = std::min(_min, difference);
             _max = std::max(_max, difference);
            ++_count;
            _size += std::max<size_t>(1, size);
+           _pixels += pixels;
+           _samples.push_back(difference);
         }
     }
 
@@ -114,6 +294,36 @@ namespace Test
         return _count ? (_total / _count) : 0;
     }
 
+    PerformanceMeasurer::Summary PerformanceMeasurer::Robust() const
+    {
+        Summary summary = { 0, 0, 0, 0, 0 };
+        if (_samples.empty())
+            return summary;
+        std::vector<double> samples(_samples);
+        std::sort(samples.begin(), samples.end());
+        const size_t n = samples.size();
+        summary.median = n % 2 ? samples[n / 2] : (samples[n / 2 - 1] + samples[n / 2])*0.5;
+
+        // 95% confidence interval of the median by binomial order statistics:
+        const double spread = 0.98*::sqrt(double(n));
+        summary.low = samples[size_t(std::max(0.0, ::floor(n*0.5 - spread)))];
+        summary.high = samples[std::min(n - 1, size_t(::ceil(n*0.5 + spread)))];
+
+        // Mean without the outliers outside of Tukey's fences:
+        const double q1 = samples[n / 4], q3 = samples[n * 3 / 4];
+        const double lo = q1 - 1.5*(q3 - q1), hi = q3 + 1.5*(q3 - q1);
+        double sum = 0;
+        for (size_t i = 0; i < n; ++i)
+        {
+            if (samples[i] < lo || samples[i] > hi)
+                summary.outliers++;
+            else
+                sum += samples[i];
+        }
+        summary.mean = sum / (n - summary.outliers);
+        return summary;
+    }
+
 	String PerformanceMeasurer::Statistic() const
     {
 		std::stringstream ss;
@@ -122,6 +332,17 @@ namespace Test
         ss << " / " << _count << " = ";
         ss << std::setprecision(3) << std::fixed << Average()*1000.0 << " ms";
         ss << std::setprecision(3) << " {min=" << _min*1000.0 << "; max=" << _max*1000.0 << "}";
+        Summary robust = Robust();
+        ss << std::setprecision(3) << " {median=" << robust.median*1000.0 << " [" << robust.low*1000.0 << "; " << robust.high*1000.0 << "]";
+        ss << "; mean=" << robust.mean*1000.0 << "; outliers=" << robust.outliers << "}";
+        if (_counters[PerformanceCounters::Cycles])
+        {
+            ss << std::setprecision(3) << " {ipc=" << double(_counters[PerformanceCounters::Instructions]) / _counters[PerformanceCounters::Cycles];
+            ss << "; cpp=" << double(_counters[PerformanceCounters::Cycles]) / _count / (W*H);
+            ss << "; l1d-miss=" << _counters[PerformanceCounters::L1dMisses] / _count;
+            ss << "; llc-miss=" << _counters[PerformanceCounters::LlcMisses] / _count;
+            ss << "; br-miss=" << _counters[PerformanceCounters::BranchMisses] / _count << "}";
+        }
         if(_size > (long long)_count)
         {
             double size = double(_size);
@@ -137,14 +358,120 @@ namespace Test
         _min = std::min(_min, other._min);
         _max = std::max(_max, other._max);
         _size += other._size;
+        _pixels += other._pixels;
+        _samples.insert(_samples.end(), other._samples.begin(), other._samples.end());
+        for (int i = 0; i < PerformanceCounters::Size; ++i)
+            _counters[i] += other._counters[i];
+    }
+
+    //-------------------------------------------------------------------------
+
+    // Returns the positive integer "value" of "arg", or exits with an error.
+    static ptrdiff_t ParsePositive(const String & arg, const String & value)
+    {
+        char * end = NULL;
+        long number = ::strtol(value.c_str(), &end, 10);
+        if (value.empty() || *end != 0 || number <= 0 || number > INT_MAX)
+        {
+            TEST_LOG_SS(Error, "Invalid argument '" << arg << "': '" << value << "' is not a positive integer!");
+            ::exit(1);
+        }
+        return number;
+    }
+
+    Sweep::Sweep(int argc, char* argv[])
+        : _current(0)
+    {
+        Size size(W, H);
+        ptrdiff_t minWidth = 0, maxWidth = 0;
+        size_t minThreads = 1, maxThreads = 1;
+        for (int i = 1; i < argc; ++i)
+        {
+            String arg = argv[i];
+            if (arg.find("-w=") == 0)
+                size.x = ParsePositive(arg, arg.substr(3));
+            else if (arg.find("-h=") == 0)
+                size.y = ParsePositive(arg, arg.substr(3));
+            else if (arg == "-sweep")
+                minWidth = 128, maxWidth = 4096;
+            else if (arg.find("-sweep=") == 0)
+            {
+                String range = arg.substr(7);
+                size_t colon = range.find(':');
+                minWidth = ParsePositive(arg, range.substr(0, colon));
+                maxWidth = colon == std::string::npos ? minWidth : ParsePositive(arg, range.substr(colon + 1));
+                if (minWidth > maxWidth)
+                {
+                    TEST_LOG_SS(Error, "Invalid argument '" << arg << "': the minimal width is greater than the maximal one!");
+                    ::exit(1);
+                }
+            }
+            else if (arg.find("-threads=") == 0)
+                minThreads = maxThreads = ParsePositive(arg, arg.substr(9));
+            else if (arg == "-thread-sweep")
+                maxThreads = std::min<size_t>(32, std::max<size_t>(1, std::thread::hardware_concurrency()));
+            else if (arg.find("-thread-sweep=") == 0)
+                maxThreads = ParsePositive(arg, arg.substr(14));
+        }
+        if (minThreads > maxThreads)
+        {
+            TEST_LOG_SS(Error, "Invalid arguments: -thread-sweep=" << maxThreads << " is less than -threads=" << minThreads << "!");
+            ::exit(1);
+        }
+        const size_t poolSize = Simd::ThreadPool::Global().Size();
+        if (maxThreads > poolSize)
+        {
+            TEST_LOG_SS(Info, "The number of threads is limited by the size of the thread pool (" << poolSize << ").");
+            maxThreads = poolSize;
+            minThreads = std::min(minThreads, maxThreads);
+        }
+        std::vector<Size> sizes;
+        if (minWidth > 0)
+        {
+            for (ptrdiff_t width = minWidth; width <= maxWidth; width *= 2)
+                sizes.push_back(Size(width, std::max<ptrdiff_t>(width * 9 / 16, 2 * O)));
+        }
+        else
+            sizes.push_back(size);
+        for (size_t s = 0; s < sizes.size(); ++s)
+            for (size_t threads = minThreads; threads <= maxThreads; threads *= 2)
+                _configs.push_back(Config(sizes[s], threads));
+    }
+
+    bool Sweep::Next()
+    {
+        if (_current >= _configs.size())
+            return false;
+        W = (int)_configs[_current].first.x;
+        H = (int)_configs[_current].first.y;
+        SimdSetThreadNumber(_configs[_current].second);
+        if (_configs.size() > 1)
+            TEST_LOG_SS(Info, "Frame size " << W << "x" << H << ", " << SimdGetThreadNumber() << " thread(s) (" << _current + 1 << " of " << _configs.size() << "):");
+        _current++;
+        return true;
     }
 
     //-------------------------------------------------------------------------
 
     PerformanceMeasurerStorage PerformanceMeasurerStorage::s_storage;
 
+    static void PinToCpu(int cpu)
+    {
+        if (cpu < 0)
+            return;
+#if defined(_MSC_VER)
+        SetThreadAffinityMask(GetCurrentThread(), DWORD_PTR(1) << cpu);
+#elif defined(__linux__)
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        sched_setaffinity(0, sizeof(set), &set);
+#endif
+    }
+
     PerformanceMeasurerStorage::PerformanceMeasurerStorage()
     {
+        PinToCpu(PerformanceOptions::Get().cpu);
     }
 
     PerformanceMeasurerStorage::~PerformanceMeasurerStorage()
@@ -160,6 +487,8 @@ namespace Test
     PerformanceMeasurer* PerformanceMeasurerStorage::Get(String name)
     {
         Thread & thread = ThisThread();
+        if (thread.warmup)
+            return NULL;
         name = name + (thread.align ? "{a}" : "{u}");
         PerformanceMeasurer * pm = NULL;
         FunctionMap::iterator it = thread.map.find(name);
@@ -180,6 +509,11 @@ namespace Test
         return thread.align ? SIMD_ALIGN : sizeof(void*);
     }
 
+    void PerformanceMeasurerStorage::Warmup(bool enable)
+    {
+        ThisThread().warmup = enable;
+    }
+
     static String FunctionShortName(const String & description)
     {
         bool isApi = description.find("Simd::") == std::string::npos;
@@ -242,6 +576,7 @@ namespace Test
         T sse41;
         T avx;
         T avx2;
+        T avx512bw;
         T vmx;
         T vsx;
 		T neon;
@@ -274,12 +609,13 @@ namespace Test
         if(enable.sse41) ss << printer.Average(printer.data.sse41) << " ";
         if(enable.avx) ss << printer.Average(printer.data.avx) << " ";
         if(enable.avx2) ss << printer.Average(printer.data.avx2) << " ";
+        if(enable.avx512bw) ss << printer.Average(printer.data.avx512bw) << " ";
         if(enable.vmx) ss << printer.Average(printer.data.vmx) << " ";
         if(enable.vsx) ss << printer.Average(printer.data.vsx) << " ";
 		if(enable.neon) ss << printer.Average(printer.data.neon) << " ";
 		ss << "| ";
 
-        if(enable.sse || enable.sse2 || enable.ssse3 || enable.sse41 || enable.avx || enable.avx2 || enable.vmx || enable.vsx || enable.neon)
+        if(enable.sse || enable.sse2 || enable.ssse3 || enable.sse41 || enable.avx || enable.avx2 || enable.avx512bw || enable.vmx || enable.vsx || enable.neon)
         {
             if(enable.sse) ss << printer.Relation(printer.data.base, printer.data.sse) << " ";
             if(enable.sse2) ss << printer.Relation(printer.data.base, printer.data.sse2) << " ";
@@ -287,13 +623,14 @@ namespace Test
             if(enable.sse41) ss << printer.Relation(printer.data.base, printer.data.sse41) << " ";
             if(enable.avx) ss << printer.Relation(printer.data.base, printer.data.avx) << " ";
             if(enable.avx2) ss << printer.Relation(printer.data.base, printer.data.avx2) << " ";
+            if(enable.avx512bw) ss << printer.Relation(printer.data.base, printer.data.avx512bw) << " ";
             if(enable.vmx) ss << printer.Relation(printer.data.base, printer.data.vmx) << " ";
             if(enable.vsx) ss << printer.Relation(printer.data.base, printer.data.vsx) << " ";
 			if(enable.neon) ss << printer.Relation(printer.data.base, printer.data.neon) << " ";
 			ss << "| ";
         }
 
-        if (enable.sse || enable.sse2 || enable.ssse3 || enable.sse41 || enable.avx || enable.avx2)
+        if (enable.sse || enable.sse2 || enable.ssse3 || enable.sse41 || enable.avx || enable.avx2 || enable.avx512bw)
         {
             if (enable.sse) ss << printer.Improving(printer.data.sse) << " ";
             if (enable.sse2) ss << printer.Improving(printer.data.sse2) << " ";
@@ -301,6 +638,7 @@ namespace Test
             if (enable.sse41) ss << printer.Improving(printer.data.sse41) << " ";
             if (enable.avx) ss << printer.Improving(printer.data.avx) << " ";
             if (enable.avx2) ss << printer.Improving(printer.data.avx2) << " ";
+            if (enable.avx512bw) ss << printer.Improving(printer.data.avx512bw) << " ";
             ss << "| ";
         }
 
@@ -314,6 +652,7 @@ namespace Test
             if(enable.sse41) ss << printer.Alignment(printer.data.sse41) << " ";
             if(enable.avx) ss << printer.Alignment(printer.data.avx) << " ";
             if(enable.avx2) ss << printer.Alignment(printer.data.avx2) << " ";
+            if(enable.avx512bw) ss << printer.Alignment(printer.data.avx512bw) << " ";
             if(enable.vmx) ss << printer.Alignment(printer.data.vmx) << " ";
             if(enable.vsx) ss << printer.Alignment(printer.data.vsx) << " ";
 			if(enable.neon) ss << printer.Alignment(printer.data.neon) << " ";
@@ -408,6 +747,8 @@ namespace Test
             enable.avx = AddToFunction(src, dst.avx);
         if(desc.find("Simd::Avx2::") != std::string::npos)
             enable.avx2 = AddToFunction(src, dst.avx2);
+        if(desc.find("Simd::Avx512bw::") != std::string::npos)
+            enable.avx512bw = AddToFunction(src, dst.avx512bw);
         if(desc.find("Simd::Vmx::") != std::string::npos)
             enable.vmx = AddToFunction(src, dst.vmx);
         if(desc.find("Simd::Vsx::") != std::string::npos)
@@ -437,31 +778,35 @@ namespace Test
         if(enable.sse41) Add(Cond(s.sse41, Cond(s.ssse3, Cond(s.sse2, Cond(s.sse, s.base)))), d.sse41);
         if(enable.avx) Add(Cond(s.avx, Cond(s.sse41, Cond(s.ssse3, Cond(s.sse2, Cond(s.sse, s.base))))), d.avx);
         if(enable.avx2) Add(Cond(s.avx2, Cond(s.avx, Cond(s.sse41, Cond(s.ssse3, Cond(s.sse2, Cond(s.sse, s.base)))))), d.avx2);
+        if(enable.avx512bw) Add(Cond(s.avx512bw, Cond(s.avx2, Cond(s.avx, Cond(s.sse41, Cond(s.ssse3, Cond(s.sse2, Cond(s.sse, s.base))))))), d.avx512bw);
         if(enable.vmx) Add(Cond(s.vmx, s.base), d.vmx);
         if(enable.vsx) Add(Cond(s.vsx, Cond(s.vmx, s.base)), d.vsx);
 		if(enable.neon) Add(Cond(s.neon, s.base), d.neon);
 	}
 
-    String PerformanceMeasurerStorage::Report(bool align, bool raw) const
+    void PerformanceMeasurerStorage::Collect(FunctionMap & map) const
     {
-        FunctionMap map;
+        std::lock_guard<std::recursive_mutex> lock(_mutex);
+        for (ThreadMap::const_iterator thread = _map.begin(); thread != _map.end(); ++thread)
         {
-            std::lock_guard<std::recursive_mutex> lock(_mutex);
-            for (ThreadMap::const_iterator thread = _map.begin(); thread != _map.end(); ++thread)
+            for (FunctionMap::const_iterator function = thread->second.map.begin(); function != thread->second.map.end(); ++function)
             {
-                for (FunctionMap::const_iterator function = thread->second.map.begin(); function != thread->second.map.end(); ++function)
-                {
-                    if(map.find(function->first) == map.end())
-                        map[function->first].reset(new PerformanceMeasurer(function->first));
-                    map[function->first]->Combine(*function->second);
-                }
+                if(map.find(function->first) == map.end())
+                    map[function->first].reset(new PerformanceMeasurer(function->first));
+                map[function->first]->Combine(*function->second);
             }
         }
+    }
+
+    String PerformanceMeasurerStorage::Report(bool align, bool raw) const
+    {
+        FunctionMap map;
+        Collect(map);
 
         FunctionStatisticMap functions;
         CommonStatistic common;
-        StatisticEnable enable = {false, false, false, false, false, false, false, false, false, false, false};
-        StatisticNames names = {{"Simd", "S"}, {"Base", "B"}, { "Sse", "S1" }, {"Sse2", "S2"}, {"Ssse3", "S3"}, {"Sse41", "S4"}, { "Avx", "A1" }, {"Avx2", "A2"}, {"Vmx", "Vm"}, {"Vsx", "Vs"}, { "Neon", "N"}};
+        StatisticEnable enable = {false, false, false, false, false, false, false, false, false, false, false, false};
+        StatisticNames names = {{"Simd", "S"}, {"Base", "B"}, { "Sse", "S1" }, {"Sse2", "S2"}, {"Ssse3", "S3"}, {"Sse41", "S4"}, { "Avx", "A1" }, {"Avx2", "A2"}, {"Avx512bw", "A5"}, {"Vmx", "Vm"}, {"Vsx", "Vs"}, { "Neon", "N"}};
         double timeMax = 0;
         size_t sizeMax = 8;
         for(FunctionMap::const_iterator it = map.begin(); it != map.end(); ++it)
@@ -515,6 +860,184 @@ namespace Test
         return report.str();
     }
 
+    static String FunctionIsa(const String & description)
+    {
+        if(description.find("Simd::") != 0)
+            return "Simd";
+        size_t pos = description.find("::", 6);
+        return pos == std::string::npos ? "Simd" : description.substr(6, pos - 6);
+    }
+
+    static String CompilerName()
+    {
+#if defined(_MSC_VER)
+        return "msvc " + ToString(_MSC_VER);
+#elif defined(__clang__)
+        return String("clang ") + __clang_version__;
+#elif defined(__GNUC__)
+        return String("gcc ") + __VERSION__;
+#else
+        return "unknown";
+#endif
+    }
+
+    static String JsonString(const String & value)
+    {
+        std::stringstream ss;
+        ss << '"';
+        for(size_t i = 0; i < value.size(); ++i)
+        {
+            if(value[i] == '"' || value[i] == '\\')
+                ss << '\\';
+            ss << value[i];
+        }
+        ss << '"';
+        return ss.str();
+    }
+
+    struct ReportRecord
+    {
+        String function, isa;
+        bool align;
+        int count;
+        double min, average, max, total;
+        PerformanceMeasurer::Summary robust;
+        uint64_t counters[PerformanceCounters::Size];
+        double ipc, cpp, mpps;
+        long long bytes, pixels;
+
+        ReportRecord(const PerformanceMeasurer & pm)
+        {
+            const String & desc = pm.Description();
+            function = FunctionShortName(desc);
+            isa = FunctionIsa(desc);
+            align = desc[desc.size() - 2] == 'a';
+            count = pm.Count();
+            min = pm.Min()*1000.0;
+            average = pm.Average()*1000.0;
+            max = pm.Max()*1000.0;
+            total = pm.Total()*1000.0;
+            robust = pm.Robust();
+            for (int i = 0; i < PerformanceCounters::Size; ++i)
+                counters[i] = pm.Counter(PerformanceCounters::Counter(i)) / std::max(1, count);
+            ipc = counters[PerformanceCounters::Cycles] ? double(counters[PerformanceCounters::Instructions]) / counters[PerformanceCounters::Cycles] : 0;
+            pixels = pm.Pixels();
+            cpp = pixels ? double(pm.Counter(PerformanceCounters::Cycles)) / pixels : 0;
+            mpps = pixels && total > 0 ? pixels / total * 0.001 : 0;
+            bytes = pm.Size() > (long long)pm.Count() ? pm.Size() : 0;
+        }
+    };
+
+    String PerformanceMeasurerStorage::ReportCsv(const String & test, bool header) const
+    {
+        FunctionMap map;
+        Collect(map);
+
+        std::stringstream report;
+        if(header)
+            report << "compiler,test,function,isa,align,width,height,threads,count,min_ms,avg_ms,max_ms,total_ms,median_ms,ci_low_ms,ci_high_ms,robust_avg_ms,outliers,bytes,cycles,instructions,l1d_misses,llc_misses,branch_misses,ipc,cycles_per_pixel,mpix_per_s" << std::endl;
+        for(FunctionMap::const_iterator it = map.begin(); it != map.end(); ++it)
+        {
+            ReportRecord r(*it->second);
+            report << JsonString(CompilerName()) << "," << JsonString(test) << "," << JsonString(r.function) << ",";
+            report << r.isa << "," << (r.align ? "a" : "u") << "," << W << "," << H << "," << SimdGetThreadNumber() << "," << r.count << ",";
+            report << std::setprecision(6) << std::fixed << r.min << "," << r.average << "," << r.max << "," << r.total << ",";
+            report << r.robust.median*1000.0 << "," << r.robust.low*1000.0 << "," << r.robust.high*1000.0 << "," << r.robust.mean*1000.0 << ",";
+            report << r.robust.outliers << "," << r.bytes;
+            if (SimdGetThreadNumber() > 1)
+                report << String(PerformanceCounters::Size + 2, ',');
+            else
+            {
+                for (int i = 0; i < PerformanceCounters::Size; ++i)
+                    report << "," << r.counters[i];
+                report << "," << r.ipc << ",";
+                if (r.pixels)
+                    report << r.cpp;
+            }
+            report << ",";
+            if (r.pixels)
+                report << r.mpps;
+            report << std::endl;
+        }
+        return report.str();
+    }
+
+    String PerformanceMeasurerStorage::ReportJson(const String & test) const
+    {
+        FunctionMap map;
+        Collect(map);
+
+        std::stringstream report;
+        for(FunctionMap::const_iterator it = map.begin(); it != map.end(); ++it)
+        {
+            ReportRecord r(*it->second);
+            report << "{\"compiler\": " << JsonString(CompilerName()) << ", \"test\": " << JsonString(test);
+            report << ", \"function\": " << JsonString(r.function) << ", \"isa\": " << JsonString(r.isa);
+            report << ", \"align\": " << (r.align ? "true" : "false") << ", \"width\": " << W << ", \"height\": " << H << ", \"threads\": " << SimdGetThreadNumber();
+            report << ", \"count\": " << r.count << std::setprecision(6) << std::fixed;
+            report << ", \"min_ms\": " << r.min << ", \"avg_ms\": " << r.average << ", \"max_ms\": " << r.max;
+            report << ", \"total_ms\": " << r.total << ", \"median_ms\": " << r.robust.median*1000.0;
+            report << ", \"ci_low_ms\": " << r.robust.low*1000.0 << ", \"ci_high_ms\": " << r.robust.high*1000.0;
+            report << ", \"robust_avg_ms\": " << r.robust.mean*1000.0 << ", \"outliers\": " << r.robust.outliers;
+            report << ", \"bytes\": " << r.bytes;
+            if (SimdGetThreadNumber() > 1)
+                report << ", \"cycles\": null, \"instructions\": null, \"l1d_misses\": null, \"llc_misses\": null, \"branch_misses\": null, \"ipc\": null, \"cycles_per_pixel\": null";
+            else
+            {
+                report << ", \"cycles\": " << r.counters[PerformanceCounters::Cycles];
+                report << ", \"instructions\": " << r.counters[PerformanceCounters::Instructions];
+                report << ", \"l1d_misses\": " << r.counters[PerformanceCounters::L1dMisses];
+                report << ", \"llc_misses\": " << r.counters[PerformanceCounters::LlcMisses];
+                report << ", \"branch_misses\": " << r.counters[PerformanceCounters::BranchMisses];
+                report << ", \"ipc\": " << r.ipc << ", \"cycles_per_pixel\": ";
+                if (r.pixels)
+                    report << r.cpp;
+                else
+                    report << "null";
+            }
+            report << ", \"mpix_per_s\": ";
+            if (r.pixels)
+                report << r.mpps;
+            else
+                report << "null";
+            report << "}" << std::endl;
+        }
+        return report.str();
+    }
+
+    bool PerformanceMeasurerStorage::SaveReport(int argc, char* argv[]) const
+    {
+        String path;
+        for(int i = 1; i < argc; ++i)
+        {
+            String arg = argv[i];
+            if(arg.find("-pr=") == 0)
+                path = arg.substr(4);
+        }
+        if(path.empty())
+            return false;
+
+        String test = argc > 0 ? argv[0] : "";
+        size_t slash = test.find_last_of("/\\");
+        if(slash != std::string::npos)
+            test = test.substr(slash + 1);
+
+        bool json = path.size() >= 5 && path.substr(path.size() - 5) == ".json";
+        bool empty = true;
+        {
+            std::ifstream ifs(path.c_str());
+            empty = !ifs.is_open() || ifs.peek() == std::ifstream::traits_type::eof();
+        }
+        std::ofstream ofs(path.c_str(), std::ofstream::app);
+        if(!ofs.is_open())
+        {
+            TEST_LOG_SS(Error, "Can't open performance report file '" << path << "'!");
+            return false;
+        }
+        ofs << (json ? ReportJson(test) : ReportCsv(test, empty));
+        return true;
+    }
+
     void PerformanceMeasurerStorage::Clear()
     {
         _map.clear();
@@ -43,6 +43,7 @@ namespace Test
 			void Call(const View & src, View & dst) const
 			{
 				TEST_PERFORMANCE_TEST(description);
+				TEST_PERFORMANCE_TEST_SET_PIXELS(src.width*src.height);
 				func(src.data, src.width, src.height, src.stride,
 					dst.data, dst.width, dst.height, dst.stride, View::PixelSize(src.format));
 			}
@@ -119,6 +120,11 @@ namespace Test
             result = result && ResizeAutoTest(FUNC(Simd::Avx2::ResizeBilinear), FUNC(SimdResizeBilinear));
 #endif 
 
+#ifdef SIMD_AVX512BW_ENABLE
+        if(Simd::Avx512bw::Enable)
+            result = result && ResizeAutoTest(FUNC(Simd::Avx512bw::ResizeBilinear), FUNC(SimdResizeBilinear));
+#endif 
+
 #ifdef SIMD_VMX_ENABLE
         if(Simd::Vmx::Enable)
             result = result && ResizeAutoTest(FUNC(Simd::Vmx::ResizeBilinear), FUNC(SimdResizeBilinear));
@@ -244,6 +250,11 @@ namespace Test
 			result = result && ResizeSpecialTest(FUNC(Simd::Avx2::ResizeBilinear), FUNC(SimdResizeBilinear));
 #endif 
 
+#ifdef SIMD_AVX512BW_ENABLE
+		if (Simd::Avx512bw::Enable)
+			result = result && ResizeSpecialTest(FUNC(Simd::Avx512bw::ResizeBilinear), FUNC(SimdResizeBilinear));
+#endif 
+
 #ifdef SIMD_VMX_ENABLE
         if (Simd::Vmx::Enable)
             result = result && ResizeSpecialTest(FUNC(Simd::Vmx::ResizeBilinear), FUNC(SimdResizeBilinear));
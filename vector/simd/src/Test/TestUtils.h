@@ -48,8 +48,9 @@ namespace Test
 
     void FillRandom32f(View & view, float lo = 0, float hi = 4096.0f);
 
+    // hueCycle - a period of the values of the first channel (the hue of HSL/HSV), the other channels do not wrap around.
     bool Compare(const View & a, const View & b,
-        int differenceMax = 0, bool printError = false, int errorCountMax = 0, int valueCycle = 0,
+        int differenceMax = 0, bool printError = false, int errorCountMax = 0, int hueCycle = 0,
         const String & description = "");
 
     bool Compare(const Histogram a, const Histogram b,
@@ -72,6 +73,8 @@ namespace Test
     bool Compare(const float & a, const float & b, float relativeDifferenceMax = EPS, bool printError = false,
         const String & description = "");
 
+    String DifferenceDescription(const View & a, const View & b, int hueCycle = 0);
+
     String ColorDescription(View::Format format);
 
     String FormatDescription(View::Format format);
@@ -41,6 +41,7 @@ namespace Test
 			void Call(const View & src, View & dst) const
 			{
 				TEST_PERFORMANCE_TEST(description);
+				TEST_PERFORMANCE_TEST_SET_PIXELS(src.width*src.height);
 				func(src.data, src.width, src.height, src.stride, dst.data, dst.stride);
 			}
 		};	
@@ -48,7 +49,7 @@ namespace Test
 
 #define FUNC(func) Func(func, #func)
 
-    bool AnyToAnyAutoTest(int width, int height, View::Format srcType, View::Format dstType, const Func & f1, const Func & f2)
+    bool AnyToAnyAutoTest(int width, int height, View::Format srcType, View::Format dstType, const Func & f1, const Func & f2, int maxDifference)
     {
         bool result = true;
 
@@ -64,18 +65,21 @@ namespace Test
 
         TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2));
 
-        result = result && Compare(dst1, dst2, 0, true, 64);
+        if(maxDifference > 0)
+            TEST_LOG_SS(Info, "Difference: " << DifferenceDescription(dst1, dst2, 256) << ".");
+
+        result = result && Compare(dst1, dst2, maxDifference, true, 64, 256);
 
         return result;
     }
 
-    bool AnyToAnyAutoTest(View::Format srcType, View::Format dstType, const Func & f1, const Func & f2)
+    bool AnyToAnyAutoTest(View::Format srcType, View::Format dstType, const Func & f1, const Func & f2, int maxDifference = 0)
     {
         bool result = true;
 
-        result = result && AnyToAnyAutoTest(W, H, srcType, dstType, f1, f2);
-        result = result && AnyToAnyAutoTest(W + O, H - O, srcType, dstType, f1, f2);
-        result = result && AnyToAnyAutoTest(W - O, H + O, srcType, dstType, f1, f2);
+        result = result && AnyToAnyAutoTest(W, H, srcType, dstType, f1, f2, maxDifference);
+        result = result && AnyToAnyAutoTest(W + O, H - O, srcType, dstType, f1, f2, maxDifference);
+        result = result && AnyToAnyAutoTest(W - O, H + O, srcType, dstType, f1, f2, maxDifference);
 
         return result;    
     }
@@ -91,6 +95,16 @@ namespace Test
             result = result && AnyToAnyAutoTest(View::Bgra32, View::Bgr24, FUNC(Simd::Ssse3::BgraToBgr), FUNC(SimdBgraToBgr));
 #endif 
 
+#ifdef SIMD_AVX2_ENABLE
+        if(Simd::Avx2::Enable)
+            result = result && AnyToAnyAutoTest(View::Bgra32, View::Bgr24, FUNC(Simd::Avx2::BgraToBgr), FUNC(SimdBgraToBgr));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if(Simd::Avx512bw::Enable)
+            result = result && AnyToAnyAutoTest(View::Bgra32, View::Bgr24, FUNC(Simd::Avx512bw::BgraToBgr), FUNC(SimdBgraToBgr));
+#endif 
+
 #ifdef SIMD_VMX_ENABLE
         if(Simd::Vmx::Enable)
             result = result && AnyToAnyAutoTest(View::Bgra32, View::Bgr24, FUNC(Simd::Vmx::BgraToBgr), FUNC(SimdBgraToBgr));
@@ -120,6 +134,11 @@ namespace Test
             result = result && AnyToAnyAutoTest(View::Bgra32, View::Gray8, FUNC(Simd::Avx2::BgraToGray), FUNC(SimdBgraToGray));
 #endif 
 
+#ifdef SIMD_AVX512BW_ENABLE
+        if(Simd::Avx512bw::Enable)
+            result = result && AnyToAnyAutoTest(View::Bgra32, View::Gray8, FUNC(Simd::Avx512bw::BgraToGray), FUNC(SimdBgraToGray));
+#endif 
+
 #ifdef SIMD_VMX_ENABLE
         if(Simd::Vmx::Enable)
             result = result && AnyToAnyAutoTest(View::Bgra32, View::Gray8, FUNC(Simd::Vmx::BgraToGray), FUNC(SimdBgraToGray));
@@ -173,6 +192,24 @@ namespace Test
 
         result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsl24, FUNC(Simd::Base::BgrToHsl), FUNC(SimdBgrToHsl));
 
+#ifdef SIMD_SSE41_ENABLE
+        if(Simd::Sse41::Enable)
+        {
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsl24, FUNC(Simd::Sse41::BgrToHsl<-1>), FUNC(SimdBgrToHsl));
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsl24, FUNC(Simd::Sse41::BgrToHsl<0>), FUNC(SimdBgrToHsl), 1);
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsl24, FUNC(Simd::Sse41::BgrToHsl<1>), FUNC(SimdBgrToHsl));
+        }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if(Simd::Avx2::Enable)
+        {
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsl24, FUNC(Simd::Avx2::BgrToHsl<-1>), FUNC(SimdBgrToHsl));
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsl24, FUNC(Simd::Avx2::BgrToHsl<0>), FUNC(SimdBgrToHsl), 1);
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsl24, FUNC(Simd::Avx2::BgrToHsl<1>), FUNC(SimdBgrToHsl));
+        }
+#endif
+
         return result;    
     }
 
@@ -182,6 +219,24 @@ namespace Test
 
         result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsv24, FUNC(Simd::Base::BgrToHsv), FUNC(SimdBgrToHsv));
 
+#ifdef SIMD_SSE41_ENABLE
+        if(Simd::Sse41::Enable)
+        {
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsv24, FUNC(Simd::Sse41::BgrToHsv<-1>), FUNC(SimdBgrToHsv));
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsv24, FUNC(Simd::Sse41::BgrToHsv<0>), FUNC(SimdBgrToHsv), 1);
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsv24, FUNC(Simd::Sse41::BgrToHsv<1>), FUNC(SimdBgrToHsv));
+        }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if(Simd::Avx2::Enable)
+        {
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsv24, FUNC(Simd::Avx2::BgrToHsv<-1>), FUNC(SimdBgrToHsv));
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsv24, FUNC(Simd::Avx2::BgrToHsv<0>), FUNC(SimdBgrToHsv), 1);
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsv24, FUNC(Simd::Avx2::BgrToHsv<1>), FUNC(SimdBgrToHsv));
+        }
+#endif
+
         return result;    
     }
 
@@ -40,6 +40,7 @@ namespace Test
 			void Call(const View & src, View & dst) const
 			{
 				TEST_PERFORMANCE_TEST(description);
+				TEST_PERFORMANCE_TEST_SET_PIXELS(src.width*src.height);
 				func(src.data, src.width, src.height, src.stride, (SimdPixelFormatType)src.format, dst.data, dst.stride);
 			}
 		};	
@@ -88,6 +89,11 @@ namespace Test
 
         result = result && BayerToBgrAutoTest(FUNC(Simd::Base::BayerToBgr), FUNC(SimdBayerToBgr));
 
+#ifdef SIMD_AVX2_ENABLE
+        if(Simd::Avx2::Enable && W >= int(Simd::Avx2::A + 4))
+            result = result && BayerToBgrAutoTest(FUNC(Simd::Avx2::BayerToBgr), FUNC(SimdBayerToBgr));
+#endif 
+
         return result;    
     }
 
@@ -42,6 +42,7 @@ namespace Test
             void Call(const View & src, const View & mask, uint8_t indexMin, View & dst) const
             {
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(src.width*src.height);
                 func(src.data, src.stride, src.width, src.height, mask.data, mask.stride, indexMin, dst.data, dst.stride);
             }
         };
@@ -129,6 +130,7 @@ namespace Test
             void Call(const View & src, size_t step, int16_t threshold, View & dst) const
             {
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(src.width*src.height);
                 func(src.data, src.stride, src.width, src.height, step, threshold, dst.data, dst.stride);
             }
         };
@@ -43,6 +43,7 @@ namespace Test
 			void Call(const View & uv, View & u, View & v) const
 			{
 				TEST_PERFORMANCE_TEST(description);
+				TEST_PERFORMANCE_TEST_SET_PIXELS(uv.width*uv.height);
 				func(uv.data, uv.stride, uv.width, uv.height, u.data, u.stride, v.data, v.stride);
 			}
 		};
@@ -130,6 +131,7 @@ namespace Test
             void Call(const View & bgr, View & b, View & g, View & r) const
             {
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(bgr.width*bgr.height);
                 func(bgr.data, bgr.stride, bgr.width, bgr.height, b.data, b.stride, g.data, g.stride, r.data, r.stride);
             }
         };
@@ -215,6 +217,7 @@ namespace Test
             void Call(const View & bgra, View & b, View & g, View & r, View & a) const
             {
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(bgra.width*bgra.height);
                 func(bgra.data, bgra.stride, bgra.width, bgra.height, b.data, b.stride, g.data, g.stride, r.data, r.stride, a.data, a.stride);
             }
         };
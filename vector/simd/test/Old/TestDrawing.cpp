@@ -42,6 +42,7 @@ namespace Test
 			{
                 Simd::Copy(dstSrc, dstDst);
 				TEST_PERFORMANCE_TEST(description);
+				TEST_PERFORMANCE_TEST_SET_PIXELS(src.width*src.height);
 				func(src.data, src.stride, src.width, src.height, src.ChannelCount(), alpha.data, alpha.stride, dstDst.data, dstDst.stride);
 			}
 		};	
@@ -43,6 +43,7 @@ namespace Test
             void Call(const View & src, View & sum, View & sqsum, View & tilted) const
             {
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(src.width*src.height);
                 func(src.data, src.stride, src.width, src.height, sum.data, sum.stride, sqsum.data, sqsum.stride, tilted.data, tilted.stride, 
                     (SimdPixelFormatType)sum.format, (SimdPixelFormatType)sqsum.format);
             }
@@ -127,6 +128,21 @@ namespace Test
 
         result = result && IntegralAutoTest(FUNC(Simd::Base::Integral), FUNC(SimdIntegral));
 
+#ifdef SIMD_SSE2_ENABLE
+        if(Simd::Sse2::Enable)
+            result = result && IntegralAutoTest(FUNC(Simd::Sse2::Integral), FUNC(SimdIntegral));
+#endif 
+
+#ifdef SIMD_AVX2_ENABLE
+        if(Simd::Avx2::Enable)
+            result = result && IntegralAutoTest(FUNC(Simd::Avx2::Integral), FUNC(SimdIntegral));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if(Simd::Avx512bw::Enable)
+            result = result && IntegralAutoTest(FUNC(Simd::Avx512bw::Integral), FUNC(SimdIntegral));
+#endif 
+
         return result;
     }
 
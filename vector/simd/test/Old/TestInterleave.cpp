@@ -42,6 +42,7 @@ namespace Test
 			void Call(const View & u, const View & v, View & uv) const
 			{
 				TEST_PERFORMANCE_TEST(description);
+				TEST_PERFORMANCE_TEST_SET_PIXELS(u.width*u.height);
 				func(u.data, u.stride, v.data, v.stride, u.width, u.height, uv.data, uv.stride);
 			}
 		};
@@ -126,6 +127,7 @@ namespace Test
             void Call(const View & b, const View & g, const View & r, View & bgr) const
             {
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(bgr.width*bgr.height);
                 func(b.data, b.stride, g.data, g.stride, r.data, r.stride, bgr.width, bgr.height, bgr.data, bgr.stride);
             }
         };
@@ -207,6 +209,7 @@ namespace Test
             void Call(const View & b, const View & g, const View & r, const View & a, View & bgra) const
             {
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(bgra.width*bgra.height);
                 func(b.data, b.stride, g.data, g.stride, r.data, r.stride, a.data, a.stride, bgra.width, bgra.height, bgra.data, bgra.stride);
             }
         };
@@ -0,0 +1,171 @@
+/*
+* Tests for Simd Library (http://simd.sourceforge.net).
+*
+* Copyright (c) 2011-2016 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestData.h"
+
+#include "Simd/SimdPipeline.hpp"
+
+namespace Test
+{
+	namespace
+	{
+        typedef Simd::GradientPipeline<Simd::Allocator> Pipeline;
+
+        struct FuncP
+        {
+            Pipeline::Kernels kernels;
+            String description;
+
+            FuncP(const Pipeline::Kernels & k, const String & d) : kernels(k), description(d) {}
+
+            // Separate calls: every stage reads and writes a whole plane (4 + 1 + 1 + 1 + 1 + 2 + 1 + 2 + 1 = 14 bytes per pixel).
+            void Call(const View & bgra, View & gray, View & blur, View & dx, View & dy, uint32_t * histogram) const
+            {
+                TEST_PERFORMANCE_TEST(description + " unfused");
+                TEST_PERFORMANCE_TEST_SET_SIZE(bgra.width*bgra.height*14);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(bgra.width*bgra.height);
+                kernels.bgraToGray(bgra.data, bgra.width, bgra.height, bgra.stride, gray.data, gray.stride);
+                kernels.gaussianBlur3x3(gray.data, gray.stride, gray.width, gray.height, 1, blur.data, blur.stride);
+                kernels.sobelDxAbs(blur.data, blur.stride, blur.width, blur.height, dx.data, dx.stride);
+                kernels.sobelDyAbs(blur.data, blur.stride, blur.width, blur.height, dy.data, dy.stride);
+                kernels.histogram(blur.data, blur.width, blur.height, blur.stride, histogram);
+            }
+
+            // Fused pipeline: only BGRA input and the gradients go through the memory (4 + 2 + 2 = 8 bytes per pixel).
+            void Call(Pipeline & pipeline, const View & bgra, View & dx, View & dy, uint32_t * histogram) const
+            {
+                TEST_PERFORMANCE_TEST(description + " fused");
+                TEST_PERFORMANCE_TEST_SET_SIZE(bgra.width*bgra.height*8);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(bgra.width*bgra.height);
+                pipeline.Run(bgra, dx, dy, histogram);
+            }
+        };
+	}
+
+#define FUNC_P(isa, histogram) \
+    FuncP(Pipeline::Kernels(isa::BgraToGray, isa::GaussianBlur3x3, isa::SobelDxAbs, isa::SobelDyAbs, histogram), #isa "::GradientPipeline")
+
+    bool PipelineAutoTest(int width, int height, size_t stripHeight, const FuncP & f)
+    {
+        bool result = true;
+
+        Pipeline pipeline(stripHeight, f.kernels);
+
+        TEST_LOG_SS(Info, "Test " << f.description << " unfused & fused [" << width << ", " << height << "], strip height " 
+            << pipeline.StripHeight(width) << ", bytes per frame " << width*height*14 << " & " << width*height*8 << ".");
+
+        View bgra(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+        FillRandom(bgra);
+        View gray(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View blur(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+
+        View dx1(width, height, View::Int16, NULL, TEST_ALIGN(width));
+        View dy1(width, height, View::Int16, NULL, TEST_ALIGN(width));
+        View dx2(width, height, View::Int16, NULL, TEST_ALIGN(width));
+        View dy2(width, height, View::Int16, NULL, TEST_ALIGN(width));
+
+        Histogram h1 = { 0 }, h2 = { 0 };
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f.Call(bgra, gray, blur, dx1, dy1, h1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f.Call(pipeline, bgra, dx2, dy2, h2));
+
+        result = result && Compare(dx1, dx2, 0, true, 32, 0, "dx");
+        result = result && Compare(dy1, dy2, 0, true, 32, 0, "dy");
+        result = result && Compare(h1, h2, 0, true, 32);
+
+        return result;
+    }
+
+    bool PipelineBandsAutoTest(int width, int height, size_t bandCount, const FuncP & f)
+    {
+        bool result = true;
+
+        const size_t stripHeight = 16, poolSize = Simd::ThreadPool::Global().Size(), threadNumber = SimdGetThreadNumber();
+        if (poolSize < bandCount)
+            Simd::ThreadPool::Global().Resize(bandCount);
+
+        Pipeline pipeline(stripHeight, f.kernels);
+
+        TEST_LOG_SS(Info, "Test " << f.description << " with 1 and then " << bandCount << " bands on the same pipeline [" << width << ", " << height << "].");
+
+        View bgra(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+        FillRandom(bgra);
+
+        View dx1(width, height, View::Int16, NULL, TEST_ALIGN(width));
+        View dy1(width, height, View::Int16, NULL, TEST_ALIGN(width));
+        View dx2(width, height, View::Int16, NULL, TEST_ALIGN(width));
+        View dy2(width, height, View::Int16, NULL, TEST_ALIGN(width));
+
+        Histogram h1 = { 0 }, h2 = { 0 };
+
+        SimdSetThreadNumber(1);
+        pipeline.Run(bgra, dx1, dy1, h1);
+
+        SimdSetThreadNumber(bandCount);
+        pipeline.Run(bgra, dx2, dy2, h2);
+
+        SimdSetThreadNumber(threadNumber);
+        if (poolSize < bandCount)
+            Simd::ThreadPool::Global().Resize(poolSize);
+
+        result = result && Compare(dx1, dx2, 0, true, 32, 0, "dx");
+        result = result && Compare(dy1, dy2, 0, true, 32, 0, "dy");
+        result = result && Compare(h1, h2, 0, true, 32);
+
+        return result;
+    }
+
+    bool PipelineAutoTest(const FuncP & f)
+    {
+        bool result = true;
+
+        result = result && PipelineAutoTest(W, H, 0, f);
+        result = result && PipelineAutoTest(W + O, H - O, 0, f);
+        result = result && PipelineAutoTest(W - O, H + O, 5, f);
+        result = result && PipelineBandsAutoTest(W, H, 4, f);
+
+        return result;
+    }
+
+    bool PipelineAutoTest()
+    {
+        bool result = true;
+
+        result = result && PipelineAutoTest(FUNC_P(Simd::Base, Simd::Base::Histogram));
+
+#ifdef SIMD_AVX2_ENABLE
+        if(Simd::Avx2::Enable)
+            result = result && PipelineAutoTest(FUNC_P(Simd::Avx2, Simd::Base::Histogram));
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if(Simd::Avx512bw::Enable)
+            result = result && PipelineAutoTest(FUNC_P(Simd::Avx512bw, Simd::Base::Histogram));
+#endif 
+
+        return result;
+    }
+}
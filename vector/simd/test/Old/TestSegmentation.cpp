@@ -42,6 +42,7 @@ namespace Test
 			{
                 dstRect = srcRect;
 				TEST_PERFORMANCE_TEST(description);
+				TEST_PERFORMANCE_TEST_SET_PIXELS(src.width*src.height);
 				func(src.data, src.stride, src.width, src.height, index, &dstRect.left, &dstRect.top, &dstRect.right, &dstRect.bottom);
 			}
 		};	
@@ -123,6 +124,7 @@ namespace Test
             {
                 Simd::Copy(src, dst);
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(dst.width*dst.height);
                 func(dst.data, dst.stride, dst.width, dst.height, index);
             }
         };	
@@ -205,6 +207,7 @@ namespace Test
             {
                 Simd::Copy(src, dst);
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(dst.width*dst.height);
                 func(dst.data, dst.stride, dst.width, dst.height, oldIndex, newIndex);
             }
         };	
@@ -290,6 +293,7 @@ namespace Test
             {
                 Simd::Copy(childSrc, childDst);
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(parrent.width*parrent.height);
                 func(parrent.data, parrent.stride, parrent.width, parrent.height, childDst.data, childDst.stride, 
                     difference.data, difference.stride, currentIndex, invalidIndex, emptyIndex, differenceThreshold);
             }
@@ -42,6 +42,7 @@ namespace Test
             void Call(const View & src, uint8_t saturation, uint8_t boost, View &  dx, View & dy) const
             {
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(src.width*src.height);
                 func(src.data, src.stride, src.width, src.height, saturation, boost, dx.data, dx.stride, dy.data, dy.stride);
             }
         };
@@ -143,6 +144,7 @@ namespace Test
             void Call(const View & src, uint8_t boost, View &  dst) const
             {
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(src.width*src.height);
                 func(src.data, src.stride, src.width, src.height, boost, dst.data, dst.stride);
             }
         };
@@ -236,6 +238,7 @@ namespace Test
             void Call(const View & src, const View & lo, const View & hi, int64_t * sum) const
             {
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(src.width*src.height);
                 func(src.data, src.stride, src.width, src.height, lo.data, lo.stride, hi.data, hi.stride, sum);
             }
         };
@@ -321,6 +324,7 @@ namespace Test
             void Call(const View & src, int shift, View &  dst) const
             {
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(src.width*src.height);
                 func(src.data, src.stride, src.width, src.height, shift, dst.data, dst.stride);
             }
         };
@@ -42,6 +42,7 @@ namespace Test
 			void Call(const View & y, const View & u, const View & v, View & bgra) const
 			{
 				TEST_PERFORMANCE_TEST(description);
+				TEST_PERFORMANCE_TEST_SET_PIXELS(y.width*y.height);
 				func(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, 0xFF);
 			}
 		};	
@@ -104,6 +105,11 @@ namespace Test
             result = result && YuvToBgraAutoTest(FUNC(Simd::Avx2::Yuv444pToBgra), FUNC(SimdYuv444pToBgra), 1, 1);
 #endif 
 
+#ifdef SIMD_AVX512BW_ENABLE
+        if(Simd::Avx512bw::Enable)
+            result = result && YuvToBgraAutoTest(FUNC(Simd::Avx512bw::Yuv444pToBgra), FUNC(SimdYuv444pToBgra), 1, 1);
+#endif 
+
 #ifdef SIMD_VMX_ENABLE
         if(Simd::Vmx::Enable)
             result = result && YuvToBgraAutoTest(FUNC(Simd::Vmx::Yuv444pToBgra), FUNC(SimdYuv444pToBgra), 1, 1);
@@ -133,6 +139,11 @@ namespace Test
             result = result && YuvToBgraAutoTest(FUNC(Simd::Avx2::Yuv422pToBgra), FUNC(SimdYuv422pToBgra), 2, 1);
 #endif 
 
+#ifdef SIMD_AVX512BW_ENABLE
+        if(Simd::Avx512bw::Enable)
+            result = result && YuvToBgraAutoTest(FUNC(Simd::Avx512bw::Yuv422pToBgra), FUNC(SimdYuv422pToBgra), 2, 1);
+#endif 
+
 #ifdef SIMD_VMX_ENABLE
         if(Simd::Vmx::Enable)
             result = result && YuvToBgraAutoTest(FUNC(Simd::Vmx::Yuv422pToBgra), FUNC(SimdYuv422pToBgra), 2, 1);
@@ -162,6 +173,11 @@ namespace Test
             result = result && YuvToBgraAutoTest(FUNC(Simd::Avx2::Yuv420pToBgra), FUNC(SimdYuv420pToBgra), 2, 2);
 #endif 
 
+#ifdef SIMD_AVX512BW_ENABLE
+        if(Simd::Avx512bw::Enable)
+            result = result && YuvToBgraAutoTest(FUNC(Simd::Avx512bw::Yuv420pToBgra), FUNC(SimdYuv420pToBgra), 2, 2);
+#endif 
+
 #ifdef SIMD_VMX_ENABLE
         if(Simd::Vmx::Enable)
             result = result && YuvToBgraAutoTest(FUNC(Simd::Vmx::Yuv420pToBgra), FUNC(SimdYuv420pToBgra), 2, 2);
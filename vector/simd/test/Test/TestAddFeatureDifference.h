@@ -45,6 +45,7 @@ namespace Test
 			{
 				Simd::Copy(differenceSrc, differenceDst);
 				TEST_PERFORMANCE_TEST(description);
+				TEST_PERFORMANCE_TEST_SET_PIXELS(value.width*value.height);
 				func(value.data, value.stride, value.width, value.height, lo.data, lo.stride, hi.data, hi.stride,
                     weight, differenceDst.data, differenceDst.stride);
 			}
@@ -0,0 +1,185 @@
+/*
+* Tests for Simd Library (http://simd.sourceforge.net).
+*
+* Copyright (c) 2011-2016 Yermalayeu Ihar.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestUtils.h"
+#include "Test/TestPerformance.h"
+#include "Test/TestData.h"
+
+#include "Simd/SimdPoolAllocator.hpp"
+#include "Simd/SimdFrame.hpp"
+#include "Simd/SimdPyramid.hpp"
+#include "Simd/SimdParallel.hpp"
+
+#include <iomanip>
+
+namespace Test
+{
+    namespace
+    {
+        // Simd::Allocator which counts its calls (every call goes to the system allocator).
+        template <class T> struct CountedAllocator : public Simd::Allocator<T>
+        {
+            static std::atomic<size_t> & Count()
+            {
+                static std::atomic<size_t> count(0);
+                return count;
+            }
+
+            static SIMD_INLINE void * Allocate(size_t size, size_t align)
+            {
+                Count()++;
+                return Simd::Allocator<T>::Allocate(size, align);
+            }
+        };
+
+        template <template<class> class A> struct AllocationCounter;
+
+        template <> struct AllocationCounter<CountedAllocator>
+        {
+            static size_t All() { return CountedAllocator<uint8_t>::Count(); }
+            static size_t System() { return CountedAllocator<uint8_t>::Count(); }
+        };
+
+        template <> struct AllocationCounter<Simd::PoolAllocator>
+        {
+            static size_t All() { return Simd::PoolAllocator<uint8_t>::GetStatistic().allocations; }
+            static size_t System() { return Simd::PoolAllocator<uint8_t>::GetStatistic().systemAllocations; }
+        };
+
+        template <template<class> class A> View Wrap(const Simd::View<A> & view)
+        {
+            return View(view.width, view.height, view.stride, (View::Format)view.format, view.data);
+        }
+
+        // Per-frame temporaries of a typical video pipeline: frame conversions NV12 -> YUV420P -> BGRA -> gray and a 4-level pyramid.
+        template <template<class> class A> void ProcessFrame(const Simd::Frame<A> & nv12, View & dst)
+        {
+            typedef Simd::Frame<A> Frame;
+
+            Frame yuv(nv12.Size(), Frame::Yuv420p), bgra(nv12.Size(), Frame::Bgra32), gray(nv12.Size(), Frame::Gray8);
+            Simd::Convert(nv12, yuv);
+            Simd::Convert(yuv, bgra);
+            Simd::Convert(bgra, gray);
+
+            Simd::Pyramid<A> pyramid(nv12.Size(), 4);
+            Simd::Copy(gray.planes[0], pyramid.At(0));
+            Simd::Build(pyramid, SimdReduce2x2);
+
+            Simd::Copy(Wrap(pyramid.At(3)), dst);
+        }
+
+        struct AllocatorStatistic
+        {
+            double allocations, systemAllocations, latency, throughput;
+        };
+
+        String ToString(double value, size_t precision)
+        {
+            std::stringstream ss;
+            ss << std::setprecision(precision) << std::fixed << value;
+            return ss.str();
+        }
+
+        template <template<class> class A> AllocatorStatistic AllocatorFrameTest(const String & description, 
+            const std::vector<View> & y, const std::vector<View> & uv, std::vector<View> & dst)
+        {
+            typedef Simd::Frame<A> Frame;
+
+            const size_t streams = y.size();
+            std::vector<Frame> sources(streams);
+            for (size_t s = 0; s < streams; ++s)
+            {
+                sources[s].Recreate(y[s].Size(), Frame::Nv12);
+                View plane0 = Wrap(sources[s].planes[0]), plane1 = Wrap(sources[s].planes[1]);
+                Simd::Copy(y[s], plane0);
+                Simd::Copy(uv[s], plane1);
+            }
+
+            // The first frame fills the pool.
+            Simd::ThreadPool::Global().Run(streams, [&](size_t s) { ProcessFrame(sources[s], dst[s]); });
+
+            const size_t all = AllocationCounter<A>::All(), system = AllocationCounter<A>::System();
+            std::vector<double> latencies;
+            double start = GetTime(), time = 0;
+            do
+            {
+                double frame = GetTime();
+                {
+                    TEST_PERFORMANCE_TEST(description);
+                    TEST_PERFORMANCE_TEST_SET_PIXELS(streams*y[0].width*y[0].height);
+                    Simd::ThreadPool::Global().Run(streams, [&](size_t s) { ProcessFrame(sources[s], dst[s]); });
+                }
+                latencies.push_back(GetTime() - frame);
+                time = GetTime() - start;
+            } while (time < PerformanceOptions::Get().minTime || latencies.size() < 8);
+            std::sort(latencies.begin(), latencies.end());
+
+            AllocatorStatistic statistic;
+            statistic.allocations = double(AllocationCounter<A>::All() - all)/latencies.size();
+            statistic.systemAllocations = double(AllocationCounter<A>::System() - system)/latencies.size();
+            statistic.latency = latencies[latencies.size()/2];
+            statistic.throughput = latencies.size()/time;
+            return statistic;
+        }
+    }
+
+    bool AllocatorFrameAutoTest(int width, int height, size_t streams)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test Simd::Allocator & Simd::PoolAllocator for " << streams << " stream(s) [" << width << ", " << height << "].");
+
+        std::vector<View> y(streams), uv(streams), dst1(streams), dst2(streams);
+        for (size_t s = 0; s < streams; ++s)
+        {
+            y[s].Recreate(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+            FillRandom(y[s]);
+            uv[s].Recreate(width/2, height/2, View::Uv16, NULL, TEST_ALIGN(width));
+            FillRandom(uv[s]);
+            dst1[s].Recreate(width/8, height/8, View::Gray8, NULL, TEST_ALIGN(width));
+            dst2[s].Recreate(width/8, height/8, View::Gray8, NULL, TEST_ALIGN(width));
+        }
+
+        AllocatorStatistic statistics[2];
+        statistics[0] = AllocatorFrameTest<CountedAllocator>("Simd::Allocator frame", y, uv, dst1);
+        statistics[1] = AllocatorFrameTest<Simd::PoolAllocator>("Simd::PoolAllocator frame", y, uv, dst2);
+
+        for (size_t s = 0; s < streams; ++s)
+            result = result && Compare(dst1[s], dst2[s], 0, true, 32, 0, "dst");
+
+        const char * names[2] = { "Simd::Allocator", "Simd::PoolAllocator" };
+        std::stringstream table;
+        table << "Per-frame allocations and latency of frame conversions and pyramid building:" << std::endl;
+        table << ExpandToLeft("allocator", 20) << ExpandToLeft("allocations", 13) << ExpandToLeft("system allocations", 20)
+            << ExpandToLeft("latency (ms/frame)", 20) << ExpandToLeft("throughput (frames/s)", 23) << std::endl;
+        for (size_t i = 0; i < 2; ++i)
+            table << ExpandToLeft(names[i], 20) << ExpandToLeft(ToString(statistics[i].allocations, 1), 13) 
+                << ExpandToLeft(ToString(statistics[i].systemAllocations, 1), 20) << ExpandToLeft(ToString(statistics[i].latency*1000.0, 2), 20)
+                << ExpandToLeft(ToString(statistics[i].throughput, 2), 23) << std::endl;
+        TEST_LOG_SS(Info, table.str());
+
+        Simd::PoolAllocator<uint8_t>::Clear();
+
+        return result;
+    }
+}
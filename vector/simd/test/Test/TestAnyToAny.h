@@ -41,6 +41,7 @@ namespace Test
 			void Call(const View & src, View & dst) const
 			{
 				TEST_PERFORMANCE_TEST(description);
+				TEST_PERFORMANCE_TEST_SET_PIXELS(src.width*src.height);
 				func(src.data, src.width, src.height, src.stride, dst.data, dst.stride);
 			}
 		};	
@@ -48,7 +49,7 @@ namespace Test
 
 #define FUNC(func) Func(func, #func)
 
-    bool AnyToAnyAutoTest(int width, int height, View::Format srcType, View::Format dstType, const Func & f1, const Func & f2)
+    bool AnyToAnyAutoTest(int width, int height, View::Format srcType, View::Format dstType, const Func & f1, const Func & f2, int maxDifference)
     {
         bool result = true;
 
@@ -64,18 +65,21 @@ namespace Test
 
         TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(src, dst2));
 
-        result = result && Compare(dst1, dst2, 0, true, 64);
+        if(maxDifference > 0)
+            TEST_LOG_SS(Info, "Difference: " << DifferenceDescription(dst1, dst2, 256) << ".");
+
+        result = result && Compare(dst1, dst2, maxDifference, true, 64, 256);
 
         return result;
     }
 
-    bool AnyToAnyAutoTest(View::Format srcType, View::Format dstType, const Func & f1, const Func & f2)
+    bool AnyToAnyAutoTest(View::Format srcType, View::Format dstType, const Func & f1, const Func & f2, int maxDifference = 0)
     {
         bool result = true;
 
-        result = result && AnyToAnyAutoTest(W, H, srcType, dstType, f1, f2);
-        result = result && AnyToAnyAutoTest(W + O, H - O, srcType, dstType, f1, f2);
-        result = result && AnyToAnyAutoTest(W - O, H + O, srcType, dstType, f1, f2);
+        result = result && AnyToAnyAutoTest(W, H, srcType, dstType, f1, f2, maxDifference);
+        result = result && AnyToAnyAutoTest(W + O, H - O, srcType, dstType, f1, f2, maxDifference);
+        result = result && AnyToAnyAutoTest(W - O, H + O, srcType, dstType, f1, f2, maxDifference);
 
         return result;    
     }
@@ -40,6 +40,7 @@ namespace Test
             void Call(const View & src, View & bgra, uint8_t alpha) const
             {
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(src.width*src.height);
                 func(src.data, src.width, src.height, src.stride, bgra.data, bgra.stride, alpha);
             }
         };	
@@ -25,6 +25,8 @@
 #include "Test/TestPerformance.h"
 #include "Test/TestData.h"
 
+#include "Simd/SimdPipeline.hpp"
+
 namespace Test
 {
 	namespace
@@ -44,6 +46,7 @@ namespace Test
 				Simd::Copy(loSrc, loDst);
 				Simd::Copy(hiSrc, hiDst);
 				TEST_PERFORMANCE_TEST(description);
+				TEST_PERFORMANCE_TEST_SET_PIXELS(value.width*value.height);
 				func(value.data, value.stride, value.width, value.height, loDst.data, loDst.stride, hiDst.data, hiDst.stride);
 			}
 		};
@@ -109,6 +112,7 @@ namespace Test
 				Simd::Copy(loCountSrc, loCountDst);
 				Simd::Copy(hiCountSrc, hiCountDst);
 				TEST_PERFORMANCE_TEST(description);
+				TEST_PERFORMANCE_TEST_SET_PIXELS(value.width*value.height);
 				func(value.data, value.stride, value.width, value.height, 
 					loValue.data, loValue.stride, hiValue.data, hiValue.stride,
 					loCountDst.data, loCountDst.stride, hiCountDst.data, hiCountDst.stride);
@@ -182,6 +186,7 @@ namespace Test
 				Simd::Copy(hiCountSrc, hiCountDst);
 				Simd::Copy(hiValueSrc, hiValueDst);
 				TEST_PERFORMANCE_TEST(description);
+				TEST_PERFORMANCE_TEST_SET_PIXELS(loValueDst.width*loValueDst.height);
 				func(loCountDst.data, loCountDst.stride, loValueDst.width, loValueDst.height, loValueDst.data, loValueDst.stride, 
 					hiCountDst.data, hiCountDst.stride, hiValueDst.data, hiValueDst.stride, threshold);
 			}
@@ -260,6 +265,7 @@ namespace Test
 				Simd::Copy(hiCountSrc, hiCountDst);
 				Simd::Copy(hiValueSrc, hiValueDst);
 				TEST_PERFORMANCE_TEST(description);
+				TEST_PERFORMANCE_TEST_SET_PIXELS(loValueDst.width*loValueDst.height);
 				func(loCountDst.data, loCountDst.stride, loValueDst.width, loValueDst.height, loValueDst.data, loValueDst.stride, 
 					hiCountDst.data, hiCountDst.stride, hiValueDst.data, hiValueDst.stride, threshold, mask.data, mask.stride);
 			}
@@ -336,6 +342,7 @@ namespace Test
 				Simd::Copy(loSrc, loDst);
 				Simd::Copy(hiSrc, hiDst);
 				TEST_PERFORMANCE_TEST(description);
+				TEST_PERFORMANCE_TEST_SET_PIXELS(value.width*value.height);
 				func(value.data, value.stride, value.width, value.height, loDst.data, loDst.stride, hiDst.data, hiDst.stride,
 					mask.data, mask.stride);
 			}
@@ -400,6 +407,7 @@ namespace Test
 			void Call(const View & src, uint8_t index, uint8_t value, View & dst) const
 			{
 				TEST_PERFORMANCE_TEST(description);
+				TEST_PERFORMANCE_TEST_SET_PIXELS(src.width*src.height);
 				func(src.data, src.stride, src.width, src.height, index, value, dst.data, dst.stride);
 			}
 		};
@@ -442,5 +450,209 @@ namespace Test
         return result;
     }
 
+    namespace
+    {
+        typedef Simd::BackgroundPipeline<Simd::Allocator> Background;
+        typedef std::vector<View> Views;
+
+        const size_t GROW_FRAMES = 4, ADJUST_PERIOD = 4, SHIFT_FRAME = 10, VIDEO_FRAMES = 20;
+        const uint8_t THRESHOLD = 2;
+
+        // The schedule of Simd::BackgroundPipeline for the given frame after the initialization.
+        bool BackgroundGrow(size_t frame) { return frame < GROW_FRAMES; }
+        bool BackgroundAdjust(size_t frame) { return frame >= GROW_FRAMES && (frame - GROW_FRAMES + 1) % ADJUST_PERIOD == 0; }
+
+        // Bytes read and written by the separate calls (unfused) and by the pipeline (fused) for the given frame.
+        size_t BackgroundBytes(size_t frame, bool shift, bool fused)
+        {
+            if (BackgroundGrow(frame))
+                return 1 + 2 + 2;
+            bool adjust = BackgroundAdjust(frame);
+            if (fused)
+                return 1 + 2 + 2 + 2 + 2 + (shift || adjust ? 1 : 0);
+            return 1 + 1 + 1 + 2 + 2 + (shift || adjust ? 1 + 1 + 2 : 0) + (shift ? 1 + 2 + 2 + 1 : 0) + (adjust ? 2 + 2 + 2 + 2 + 1 : 0);
+        }
+
+        struct FuncB
+        {
+            Background::Kernels kernels;
+            String description;
+
+            FuncB(const Background::Kernels & k, const String & d) : kernels(k), description(d) {}
+
+            // Separate calls of the background functions for the whole frame.
+            void Call(const Views & video, const View & zones, View & lo, View & hi, View & loCount, View & hiCount, View & mask) const
+            {
+                Simd::Copy(video[0], lo);
+                Simd::Copy(video[0], hi);
+                Simd::Fill(loCount, 0);
+                Simd::Fill(hiCount, 0);
+                size_t bytes = 0;
+                for (size_t i = 1; i < video.size(); ++i)
+                    bytes += BackgroundBytes(i - 1, i == SHIFT_FRAME, false);
+
+                TEST_PERFORMANCE_TEST(description + " unfused");
+                TEST_PERFORMANCE_TEST_SET_SIZE(bytes*zones.width*zones.height);
+                TEST_PERFORMANCE_TEST_SET_PIXELS((video.size() - 1)*zones.width*zones.height);
+                for (size_t i = 1; i < video.size(); ++i)
+                {
+                    const View & value = video[i];
+                    const bool shift = i == SHIFT_FRAME, adjust = BackgroundAdjust(i - 1);
+                    if (BackgroundGrow(i - 1))
+                        kernels.growRangeFast(value.data, value.stride, value.width, value.height, lo.data, lo.stride, hi.data, hi.stride);
+                    else
+                    {
+                        if (shift || adjust)
+                        {
+                            Simd::Fill(mask, 0);
+                            kernels.initMask(zones.data, zones.stride, zones.width, zones.height, 1, 0xFF, mask.data, mask.stride);
+                        }
+                        if (shift)
+                            kernels.shiftRangeMasked(value.data, value.stride, value.width, value.height, lo.data, lo.stride, hi.data, hi.stride, mask.data, mask.stride);
+                        kernels.incrementCount(value.data, value.stride, value.width, value.height, lo.data, lo.stride, hi.data, hi.stride, 
+                            loCount.data, loCount.stride, hiCount.data, hiCount.stride);
+                        if (adjust)
+                            kernels.adjustRangeMasked(loCount.data, loCount.stride, lo.width, lo.height, lo.data, lo.stride, 
+                                hiCount.data, hiCount.stride, hi.data, hi.stride, THRESHOLD, mask.data, mask.stride);
+                    }
+                }
+            }
+
+            // Fused pipeline: the chain is run strip by strip in L1 cache.
+            void Call(const Views & video, const View & zones, Background & background) const
+            {
+                background.Init(video[0]);
+                size_t bytes = 0;
+                for (size_t i = 1; i < video.size(); ++i)
+                    bytes += BackgroundBytes(i - 1, i == SHIFT_FRAME, true);
+
+                TEST_PERFORMANCE_TEST(description + " fused");
+                TEST_PERFORMANCE_TEST_SET_SIZE(bytes*zones.width*zones.height);
+                TEST_PERFORMANCE_TEST_SET_PIXELS((video.size() - 1)*zones.width*zones.height);
+                for (size_t i = 1; i < video.size(); ++i)
+                    background.Update(video[i], zones, i == SHIFT_FRAME);
+            }
+        };
+    }
+
+#define FUNC_B(isa) \
+    FuncB(Background::Kernels(isa::BackgroundGrowRangeFast, isa::BackgroundIncrementCount, isa::BackgroundAdjustRangeMasked, \
+    isa::BackgroundShiftRangeMasked, isa::BackgroundInitMask), #isa "::BackgroundPipeline")
+
+    // Synthetic video: a noisy static scene with a moving bright object and a sudden change of illumination at SHIFT_FRAME.
+    // The zones are 1 (updated) except of the left quarter of the frame (0) and a band of rows (2).
+    void CreateBackgroundVideo(int width, int height, Views & video, View & zones)
+    {
+        video.resize(VIDEO_FRAMES);
+        for (size_t i = 0; i < video.size(); ++i)
+        {
+            video[i].Recreate(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+            const int light = i >= SHIFT_FRAME ? 40 : 0, left = int(i)*width/int(VIDEO_FRAMES), top = height/3;
+            for (int y = 0; y < height; ++y)
+            {
+                uint8_t * value = video[i].data + y*video[i].stride;
+                for (int x = 0; x < width; ++x)
+                {
+                    if (x >= left && x < left + width/8 && y >= top && y < top + height/4)
+                        value[x] = uint8_t(230 + Random(16));
+                    else
+                        value[x] = uint8_t(20 + (x + y)/8%160 + light + Random(9));
+                }
+            }
+        }
+
+        zones.Recreate(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        for (int y = 0; y < height; ++y)
+            for (int x = 0; x < width; ++x)
+                zones.At<uint8_t>(x, y) = x < width/4 ? 0 : (y > height*3/4 && y < height*7/8 ? 2 : 1);
+    }
+
+    bool BackgroundPipelineAutoTest(int width, int height, size_t stripHeight, const FuncB & f)
+    {
+        bool result = true;
+
+        Background background(GROW_FRAMES, ADJUST_PERIOD, THRESHOLD, 1, stripHeight, f.kernels);
+
+        TEST_LOG_SS(Info, "Test " << f.description << " unfused & fused [" << width << ", " << height << "], strip height " 
+            << background.StripHeight(width) << ", " << VIDEO_FRAMES << " frames.");
+
+        Views video;
+        View zones;
+        CreateBackgroundVideo(width, height, video, zones);
+
+        View lo(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View hi(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View loCount(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View hiCount(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View mask(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f.Call(video, zones, lo, hi, loCount, hiCount, mask));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f.Call(video, zones, background));
+
+        result = result && Compare(lo, background.Lo(), 0, true, 32, 0, "lo");
+        result = result && Compare(hi, background.Hi(), 0, true, 32, 0, "hi");
+        result = result && Compare(loCount, background.LoCount(), 0, true, 32, 0, "loCount");
+        result = result && Compare(hiCount, background.HiCount(), 0, true, 32, 0, "hiCount");
+
+        return result;
+    }
+
+    bool BackgroundPipelineBandsAutoTest(int width, int height, size_t bandCount, const FuncB & f)
+    {
+        bool result = true;
+
+        const size_t stripHeight = 16, poolSize = Simd::ThreadPool::Global().Size(), threadNumber = SimdGetThreadNumber();
+        if (poolSize < bandCount)
+            Simd::ThreadPool::Global().Resize(bandCount);
+
+        Background background(GROW_FRAMES, ADJUST_PERIOD, THRESHOLD, 1, stripHeight, f.kernels);
+
+        TEST_LOG_SS(Info, "Test " << f.description << " with 1 and then " << bandCount << " bands on the same model [" << width << ", " << height << "].");
+
+        Views video;
+        View zones;
+        CreateBackgroundVideo(width, height, video, zones);
+
+        View lo(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View hi(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View loCount(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View hiCount(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        View mask(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+
+        f.Call(video, zones, lo, hi, loCount, hiCount, mask);
+
+        // The masks of the first bands are used by an adjustment before SHIFT_FRAME, the band count grows at it.
+        background.Init(video[0]);
+        for (size_t i = 1; i < video.size(); ++i)
+        {
+            SimdSetThreadNumber(i < SHIFT_FRAME ? 1 : bandCount);
+            background.Update(video[i], zones, i == SHIFT_FRAME);
+        }
+
+        SimdSetThreadNumber(threadNumber);
+        if (poolSize < bandCount)
+            Simd::ThreadPool::Global().Resize(poolSize);
+
+        result = result && Compare(lo, background.Lo(), 0, true, 32, 0, "lo");
+        result = result && Compare(hi, background.Hi(), 0, true, 32, 0, "hi");
+        result = result && Compare(loCount, background.LoCount(), 0, true, 32, 0, "loCount");
+        result = result && Compare(hiCount, background.HiCount(), 0, true, 32, 0, "hiCount");
+
+        return result;
+    }
+
+    bool BackgroundPipelineAutoTest(const FuncB & f)
+    {
+        bool result = true;
+
+        result = result && BackgroundPipelineAutoTest(W, H, 0, f);
+        result = result && BackgroundPipelineAutoTest(W + O, H - O, 0, f);
+        result = result && BackgroundPipelineAutoTest(W - O, H + O, 5, f);
+        result = result && BackgroundPipelineBandsAutoTest(W, H, 4, f);
+
+        return result;
+    }
+
 
 }
@@ -41,6 +41,7 @@ namespace Test
             void Call(const View & blue, const View & green, const View & red, View & bgra, uint8_t alpha) const
             {
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(blue.width*blue.height);
                 func(blue.data, blue.stride, blue.width, blue.height, green.data, green.stride, red.data, red.stride, bgra.data, bgra.stride, alpha);
             }
         };	
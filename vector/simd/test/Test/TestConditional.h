@@ -43,6 +43,7 @@ namespace Test
             void Call(const View & src, uint8_t value, SimdCompareType compareType, uint32_t & count) const
             {
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(src.width*src.height);
                 func(src.data, src.stride, src.width, src.height, value, compareType, &count);
             }
         };
@@ -107,6 +108,7 @@ namespace Test
             void Call(const View & src, int16_t value, SimdCompareType compareType, uint32_t & count) const
             {
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(src.width*src.height);
                 func(src.data, src.stride, src.width, src.height, value, compareType, &count);
             }
         };
@@ -171,6 +173,7 @@ namespace Test
             void Call(const View & src, const View & mask, uint8_t value, SimdCompareType compareType, uint64_t & sum) const
             {
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(src.width*src.height);
                 func(src.data, src.stride, src.width, src.height, mask.data, mask.stride, value, compareType, &sum);
             }
         };
@@ -238,6 +241,7 @@ namespace Test
 			{
 				Simd::Copy(dstSrc, dstDst);
 				TEST_PERFORMANCE_TEST(description);
+				TEST_PERFORMANCE_TEST_SET_PIXELS(src.width*src.height);
 				func(src.data, src.stride, src.width, src.height, threshold, compareType, value, dstDst.data, dstDst.stride);
 			}
 		};
@@ -26,6 +26,7 @@
 #include "Test/TestData.h"
 
 #include "Simd/SimdDrawing.hpp"
+#include "Simd/SimdDetection.hpp"
 
 namespace Test
 {
@@ -132,6 +133,7 @@ namespace Test
             void Call(const void * hid, const View & mask, const Rect & rect, View & dst) const
             {
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(rect.Area());
                 func(hid, mask.data, mask.stride, rect.left, rect.top, rect.right, rect.bottom, dst.data, dst.stride);
             }
         };
@@ -235,5 +237,111 @@ namespace Test
 
         return result;
     }
+
+    namespace
+    {
+        typedef Simd::Detection<Simd::Allocator> Detection;
+
+        struct FuncO
+        {
+            ptrdiff_t threadNumber;
+            String description;
+
+            FuncO(ptrdiff_t t, const String & d) : threadNumber(t), description(d) {}
+
+            void Call(Detection & detection, const View & src, Detection::Objects & objects) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_SIZE(src.width*src.height);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(src.width*src.height);
+                detection.Detect(src, objects);
+            }
+        };
+    }
+
+    bool Compare(const Detection::Objects & objects1, const Detection::Objects & objects2)
+    {
+        bool result = objects1.size() == objects2.size();
+        for (size_t i = 0; i < objects1.size() && result; ++i)
+            result = objects1[i].rect == objects2[i].rect && objects1[i].weight == objects2[i].weight && objects1[i].tag == objects2[i].tag;
+        if (!result)
+            TEST_LOG_SS(Error, "Detected objects are different (" << objects1.size() << " and " << objects2.size() << " objects)!");
+        return result;
+    }
+
+    // Detection::Detect with 1 thread and with the global thread pool: the (level, band) tasks of all pyramid levels go to the global thread pool at once.
+    bool DetectionObjectAutoTest(const String & path, int width, int height, const FuncO & f1, const FuncO & f2)
+    {
+        bool result = true;
+
+        View src = GetSample(Size(width, height), false);
+        if (src.format == View::None)
+            return false;
+
+        Detection detection1, detection2;
+        if (!detection1.Load(path) || !detection2.Load(path))
+        {
+            TEST_LOG_SS(Error, "Can't load cascade '" << path << "' !");
+            return false;
+        }
+        detection1.Init(src.Size(), 1.1, Size(0, 0), Size(INT_MAX, INT_MAX), View(), f1.threadNumber);
+        detection2.Init(src.Size(), 1.1, Size(0, 0), Size(INT_MAX, INT_MAX), View(), f2.threadNumber);
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " with '" << path << "' for size [" << width << "," << height << "].");
+
+        Detection::Objects objects1, objects2;
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(detection1, src, objects1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(detection2, src, objects2));
+
+        result = result && Compare(objects1, objects2);
+
+        std::stringstream table;
+        table << "Detection of " << objects1.size() << " objects:" << std::endl;
+        table << ExpandToLeft("threads", 8) << ExpandToLeft("latency (ms/frame)", 20) << ExpandToLeft("throughput (frames/s)", 23) << std::endl;
+        const double minTime = PerformanceOptions::Get().minTime;
+        const FuncO * funcs[2] = { &f1, &f2 };
+        Detection * detections[2] = { &detection1, &detection2 };
+        for (size_t f = 0; f < 2 && result; ++f)
+        {
+            std::vector<double> latencies;
+            double start = GetTime(), time = 0;
+            do
+            {
+                double frame = GetTime();
+                detections[f]->Detect(src, objects2);
+                latencies.push_back(GetTime() - frame);
+                time = GetTime() - start;
+            } while (time < minTime);
+            std::sort(latencies.begin(), latencies.end());
+            size_t threads = Simd::ThreadPool::Global().Size();
+            if (funcs[f]->threadNumber > 0)
+                threads = std::min(threads, size_t(funcs[f]->threadNumber));
+            table << ExpandToLeft(ToString(threads), 8) << ExpandToLeft(ToString(latencies[latencies.size() / 2] * 1000.0, 3, 2), 20)
+                << ExpandToLeft(ToString(latencies.size() / time, 3, 2), 23) << std::endl;
+        }
+        TEST_LOG_SS(Info, table.str());
+
+        return result;
+    }
+
+    bool DetectionObjectAutoTest(const FuncO & f1, const FuncO & f2)
+    {
+        bool result = true;
+
+        // Detection::Init limits the thread number by the size of the global thread pool, so the pool gets at least 2 threads here
+        const size_t poolSize = Simd::ThreadPool::Global().Size();
+        if (poolSize < 2)
+            Simd::ThreadPool::Global().Resize(2);
+
+        result = result && DetectionObjectAutoTest(ROOT_PATH + "/data/cascade/haar_face_0.xml", W, H, f1, f2);
+        result = result && DetectionObjectAutoTest(ROOT_PATH + "/data/cascade/lbp_face.xml", W, H, f1, f2);
+
+        if (poolSize < 2)
+            Simd::ThreadPool::Global().Resize(poolSize);
+
+        return result;
+    }
 }
 
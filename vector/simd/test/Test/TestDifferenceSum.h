@@ -42,6 +42,7 @@ namespace Test
 			void Call(const View & a, const View & b, uint64_t * sum) const
 			{
 				TEST_PERFORMANCE_TEST(description);
+				TEST_PERFORMANCE_TEST_SET_PIXELS(a.width*a.height);
 				func(a.data, a.stride, b.data, b.stride, a.width, a.height, sum);
 			}
 		};
@@ -59,6 +60,7 @@ namespace Test
 			void Call(const View & a, const View & b, const View & mask, uint8_t index, uint64_t * sum) const
 			{
 				TEST_PERFORMANCE_TEST(description);
+				TEST_PERFORMANCE_TEST_SET_PIXELS(a.width*a.height);
 				func(a.data, a.stride, b.data, b.stride, mask.data, mask.stride, index, a.width, a.height, sum);
 			}
 		};
@@ -75,6 +77,7 @@ namespace Test
             void Call(const View & a, const View & b, float * sum) const
             {
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(a.width);
                 func((float*)a.data, (float*)b.data, a.width, sum);
             }
         };
@@ -43,6 +43,7 @@ namespace Test
 			{
 				Simd::Copy(backgroundSrc, backgroundDst);
 				TEST_PERFORMANCE_TEST(description);
+				TEST_PERFORMANCE_TEST_SET_PIXELS(value.width*value.height);
 				func(value.data, value.stride, value.width, value.height, backgroundDst.data, backgroundDst.stride);
 			}
 		};
@@ -101,6 +102,7 @@ namespace Test
 			{
 				Simd::Copy(backgroundCountSrc, backgroundCountDst);
 				TEST_PERFORMANCE_TEST(description);
+				TEST_PERFORMANCE_TEST_SET_PIXELS(value.width*value.height);
 				func(value.data, value.stride, value.width, value.height, 
 					backgroundValue.data, backgroundValue.stride, backgroundCountDst.data, backgroundCountDst.stride);
 			}
@@ -163,6 +165,7 @@ namespace Test
 				Simd::Copy(backgroundCountSrc, backgroundCountDst);
 				Simd::Copy(backgroundValueSrc, backgroundValueDst);
 				TEST_PERFORMANCE_TEST(description);
+				TEST_PERFORMANCE_TEST_SET_PIXELS(backgroundValueDst.width*backgroundValueDst.height);
 				func(backgroundCountDst.data, backgroundCountDst.stride, backgroundValueDst.width, backgroundValueDst.height, 
                     backgroundValueDst.data, backgroundValueDst.stride, threshold);
 			}
@@ -226,6 +229,7 @@ namespace Test
                 Simd::Copy(backgroundCountSrc, backgroundCountDst);
                 Simd::Copy(backgroundValueSrc, backgroundValueDst);
 				TEST_PERFORMANCE_TEST(description);
+				TEST_PERFORMANCE_TEST_SET_PIXELS(backgroundValueDst.width*backgroundValueDst.height);
                 func(backgroundCountDst.data, backgroundCountDst.stride, backgroundValueDst.width, backgroundValueDst.height, 
                     backgroundValueDst.data, backgroundValueDst.stride, threshold, mask.data, mask.stride);
 			}
@@ -289,6 +293,7 @@ namespace Test
 			{
 				Simd::Copy(backgroundSrc, backgroundDst);
 				TEST_PERFORMANCE_TEST(description);
+				TEST_PERFORMANCE_TEST_SET_PIXELS(value.width*value.height);
 				func(value.data, value.stride, value.width, value.height, backgroundDst.data, backgroundDst.stride,	mask.data, mask.stride);
 			}
 		};
@@ -41,6 +41,7 @@ namespace Test
 			void Call(const View & src, View & dst) const
 			{
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(src.width*src.height);
                 func(src.data, src.stride, src.width, src.height, View::PixelSize(src.format), dst.data, dst.stride);
 			}
 		};
@@ -104,6 +105,7 @@ namespace Test
             void Call(const View & src, View & dst) const
             {
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(src.width*src.height);
                 func(src.data, src.stride, src.width, src.height, dst.data, dst.stride);
             }
         };
@@ -42,6 +42,7 @@ namespace Test
             void Call(const View & src, uint32_t * histogram) const
             {
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(src.width*src.height);
                 func(src.data, src.width, src.height, src.stride, histogram);
             }
         };       
@@ -59,6 +60,7 @@ namespace Test
             void Call(const View & src, const View & mask, uint8_t index, uint32_t * histogram) const
             {
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(src.width*src.height);
                 func(src.data, src.stride, src.width, src.height, mask.data, mask.stride, index, histogram);
             }
         };
@@ -78,6 +80,7 @@ namespace Test
 			void Call(const View & src, size_t step, size_t indent, uint32_t * histogram) const
 			{
 				TEST_PERFORMANCE_TEST(description);
+				TEST_PERFORMANCE_TEST_SET_PIXELS(src.width*src.height);
 				func(src.data, src.width, src.height, src.stride,
 					step, indent, histogram);
 			}
@@ -213,6 +216,7 @@ namespace Test
             void Call(const View & src, const View & mask, uint8_t value, SimdCompareType compareType, uint32_t * histogram) const
             {
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(src.width*src.height);
                 func(src.data, src.stride, src.width, src.height, mask.data, mask.stride, value, compareType, histogram);
             }
         };
@@ -42,6 +42,7 @@ namespace Test
             void Call(const View & src, const Point & cell, size_t quantization, float * histograms) const
             {
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(src.width*src.height);
                 func(src.data, src.stride, src.width, src.height, cell.x, cell.y, quantization, histograms);
             }
         };       
@@ -43,6 +43,7 @@ namespace Test
             void Call(const View & src, View & sum, View & sqsum, View & tilted) const
             {
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(src.width*src.height);
                 func(src.data, src.stride, src.width, src.height, sum.data, sum.stride, sqsum.data, sqsum.stride, tilted.data, tilted.stride, 
                     (SimdPixelFormatType)sum.format, (SimdPixelFormatType)sqsum.format);
             }
@@ -44,6 +44,7 @@ namespace Test
 			void Call(const View & src, View & dst) const
 			{
 				TEST_PERFORMANCE_TEST(description);
+				TEST_PERFORMANCE_TEST_SET_PIXELS(src.width*src.height);
 				func(src.data, src.stride, src.width, src.height, (float*)dst.data, inversion ? 1 : 0);
 			}
 		};
@@ -97,6 +98,7 @@ namespace Test
             void Call(const View & a, const View & b, float * sum) const
             {
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(a.width);
                 func((float*)a.data, (float*)b.data, a.width, sum);
             }
         };
@@ -137,6 +139,103 @@ namespace Test
         return result;
     }
 
+    namespace
+    {
+        struct FuncPSB
+        {
+            typedef void(*FuncPtr)(const float * a, size_t aStride, size_t aCount, const float * b, size_t bStride, size_t bCount, size_t size, float * sums);
+
+            FuncPtr func;
+            String description;
+
+            FuncPSB(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & a, const View & b, View & sums) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(a.width*a.height*b.height);
+                func((float*)a.data, a.stride/sizeof(float), a.height, (float*)b.data, b.stride/sizeof(float), b.height, a.width, (float*)sums.data);
+            }
+        };
+    }
+#define FUNC_PSB(function) FuncPSB(function, #function)
+
+    bool NeuralProductSumBatchAutoTest(int aCount, int bCount, int size, float eps, const FuncPSB & f1, const FuncPSB & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << aCount << "x" << size << " * " << bCount << "x" << size << "].");
+
+        View a(size, aCount, View::Float, NULL, TEST_ALIGN(size));
+        FillRandom32f(a);
+
+        View b(size, bCount, View::Float, NULL, TEST_ALIGN(size));
+        FillRandom32f(b);
+
+        View s1(aCount*bCount, 1, View::Float, NULL, TEST_ALIGN(bCount));
+        View s2(aCount*bCount, 1, View::Float, NULL, TEST_ALIGN(bCount));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(a, b, s1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(a, b, s2));
+
+        result = result && Compare(s1, s2, eps, true, 32);
+
+        return result;
+    }
+
+    bool NeuralProductSumBatchAutoTest(float eps, const FuncPSB & f1, const FuncPSB & f2)
+    {
+        bool result = true;
+
+        result = result && NeuralProductSumBatchAutoTest(H, 7, W + O, eps, f1, f2);
+        result = result && NeuralProductSumBatchAutoTest(H - O, 10, W - O, eps, f1, f2);
+        result = result && NeuralProductSumBatchAutoTest(H, 1, W, eps, f1, f2);
+
+        return result;
+    }
+
+    // Checks the batch function against the single pair one called for every pair of rows, 
+    // then prints the throughput of both (in GFLOP/s) for several matrix shapes.
+    bool NeuralProductSumBatchSpeedTest(float eps, const FuncPS & f1, const FuncPSB & f2)
+    {
+        bool result = true;
+
+        const size_t shapes[][3] = { { 1024, 1, 64 }, { 1024, 1, 1024 }, { 256, 4, 256 }, { 256, 16, 256 }, { 64, 64, 1024 }, { 16, 256, 4096 } };
+        std::stringstream table;
+        table << f2.description << " vs " << f1.description << " loop (GFLOP/s):" << std::endl;
+        table << ExpandToLeft("a", 6) << ExpandToLeft("b", 6) << ExpandToLeft("size", 6) << ExpandToLeft("loop", 10) << ExpandToLeft("batch", 10) << ExpandToLeft("speedup", 10) << std::endl;
+        for (size_t i = 0; i < sizeof(shapes)/sizeof(shapes[0]) && result; ++i)
+        {
+            const size_t aCount = shapes[i][0], bCount = shapes[i][1], size = shapes[i][2];
+            View a(size, aCount, View::Float, NULL, TEST_ALIGN(size));
+            View b(size, bCount, View::Float, NULL, TEST_ALIGN(size));
+            View s1(aCount*bCount, 1, View::Float, NULL, TEST_ALIGN(bCount));
+            View s2(aCount*bCount, 1, View::Float, NULL, TEST_ALIGN(bCount));
+            FillRandom32f(a);
+            FillRandom32f(b);
+
+            double loop = AverageTime([&]()
+            {
+                for (size_t m = 0; m < aCount; ++m)
+                    for (size_t n = 0; n < bCount; ++n)
+                        f1.func(&a.At<float>(0, m), &b.At<float>(0, n), size, (float*)s1.data + m*bCount + n);
+            });
+            double batch = AverageTime([&]()
+            {
+                f2.func((float*)a.data, a.stride/sizeof(float), aCount, (float*)b.data, b.stride/sizeof(float), bCount, size, (float*)s2.data);
+            });
+            result = result && Compare(s1, s2, eps, true, 32);
+
+            double flops = 2.0*aCount*bCount*size/1000000000.0;
+            table << ExpandToLeft(ToString(aCount), 6) << ExpandToLeft(ToString(bCount), 6) << ExpandToLeft(ToString(size), 6);
+            table << ExpandToLeft(ToString(flops/loop, 3, 2), 10) << ExpandToLeft(ToString(flops/batch, 3, 2), 10) << ExpandToLeft(ToString(loop/batch, 3, 2), 10) << std::endl;
+        }
+        TEST_LOG_SS(Info, table.str());
+
+        return result;
+    }
+
 
     namespace
     {
@@ -153,6 +252,7 @@ namespace Test
             {
                 Simd::Copy(dstSrc, dstDst);
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(src.width);
                 func((float*)src.data, src.width, &value, (float*)dstDst.data);
             }
         };
@@ -211,6 +311,7 @@ namespace Test
 			void Call(const View & src, float slope, View & dst) const
 			{
 				TEST_PERFORMANCE_TEST(description);
+				TEST_PERFORMANCE_TEST_SET_PIXELS(src.width);
 				func((float*)src.data, src.width, &slope, (float*)dst.data);
 			}
 		};
@@ -275,6 +376,7 @@ namespace Test
             {
                 Simd::Copy(dstSrc, dstDst);
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(src.width);
                 func((float*)src.data, src.width, &slope, (float*)dstDst.data);
             }
         };
@@ -333,6 +435,7 @@ namespace Test
                 Simd::Copy(d, dDst);
                 Simd::Copy(w, wDst);
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(x.width);
                 func((float*)x.data, x.width, &a, &b, (float*)dDst.data, (float*)wDst.data);
             }
         };
@@ -397,6 +500,7 @@ namespace Test
                 Simd::Copy(gradientSrc, gradientDst);
                 Simd::Copy(weightSrc, weightDst);
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(delta.width);
                 func((float*)delta.data, delta.width, batch, &alpha, &epsilon, (float*)gradientDst.data, (float*)weightDst.data);
             }
         };
@@ -461,6 +565,7 @@ namespace Test
             {
                 Simd::Copy(dstSrc, dstDst);
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(size.x*size.y);
                 func((float*)src.data, src.stride/sizeof(float), size.x, size.y, weights, (float*)dstDst.data, dstDst.stride/sizeof(float));
             }
         };
@@ -527,6 +632,7 @@ namespace Test
             {
                 Simd::Copy(sumsSrc, sumsDst);
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(dst.width*dst.height);
                 func((float*)src.data, src.stride / sizeof(float), (float*)dst.data, dst.stride / sizeof(float), dst.width, dst.height, (float*)sumsDst.data);
             }
         };
@@ -586,6 +692,7 @@ namespace Test
             void Call(const View & src, View & dst) const
             {
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(src.width*src.height);
                 func((float*)src.data, src.stride/sizeof(float), src.width, src.height, (float*)dst.data, dst.stride/sizeof(float));
             }
         };
@@ -627,4 +734,283 @@ namespace Test
 
 }
 
+//-----------------------------------------------------------------------------
+
+#include "Simd/SimdNeural.hpp"
+
+namespace Test
+{
+    typedef Simd::Neural::Vector Vector;
+    typedef Simd::Neural::Vectors Vectors;
+    typedef Simd::Neural::Label Label;
+    typedef Simd::Neural::Labels Labels;
+    typedef Simd::Neural::VectorI VectorI;
+    typedef Simd::Neural::Network Network;
+    typedef std::pair<float, float> Error;
+
+    struct TrainSample
+    {
+        Vectors src;
+        Labels lbl;
+        Vectors dst;
+
+        void Resize(size_t size)
+        {
+            src.resize(size);
+            lbl.resize(size);
+            dst.resize(size);
+        }
+
+        void Reserve(size_t size)
+        {
+            src.reserve(size);
+            lbl.reserve(size);
+            dst.reserve(size);
+        }
+    };
+
+    struct TrainOptions : public Simd::Neural::TrainOptions
+    {
+        size_t logEvery;
+        float threshold;
+
+        TrainOptions()
+            : Simd::Neural::TrainOptions()
+            , logEvery(10)
+            , threshold(0.5f)
+        {
+        }
+    };
+
+    Error Check(Network & net, const TrainSample & sample, float politive, bool train)
+    {
+        double sum = 0;
+        size_t count = 0, size = net.OutputIndex().Volume();
+        for (size_t i = 0; i < sample.src.size(); ++i)
+        {
+            const Vector & dst = sample.dst[i];
+            Label lbl = sample.lbl[i];
+
+            Vector cur = net.Predict(sample.src[i], train ? Simd::Neural::Layer::Check : Simd::Neural::Layer::Fast);
+
+            float difference = 0;
+            for (size_t j = 0; j < size; ++j)
+                difference += Simd::Square(dst[j] - cur[j]);
+            sum += difference / size;
+
+            float negative = lbl < size ? dst[lbl] : politive;
+            for (size_t j = 0; j < size; ++j)
+            {
+                if (j == lbl)
+                {
+                    if (cur[j] < politive)
+                    {
+                        count++;
+                        break;
+                    }
+                }
+                else
+                {
+                    if (cur[j] > negative)
+                    {
+                        count++;
+                        break;
+                    }
+                }
+            }
+        }
+        return Error((float)::sqrt(sum / sample.src.size()), float(count) / float(sample.src.size()));
+    }
+
+    bool LoadDigits(const Network & net, bool error, TrainSample & dst)
+    {
+        Size size = net.InputIndex().Size();
+        dst.Resize(0);
+        for (size_t i = 0, n = 10, current = 0, total = 0; (error ? i <= n : i < n); ++i)
+        {
+            String path = (i < n ? ROOT_PATH + "/data/image/digit/" + char('0' + i) + ".pgm" : ROOT_PATH + "/data/image/face/lena.pgm");
+            View pooled;
+            if (!pooled.Load(path))
+            {
+                TEST_LOG_SS(Error, "Can't load test image '" << path << "' !");
+                return false;
+            }
+            Size number = pooled.Size() / size, shift;
+            total += number.x*number.y;
+            dst.Resize(total);
+            for (shift.y = 0; shift.y < number.y; ++shift.y)
+            {
+                for (shift.x = 0; shift.x < number.x; ++shift.x, ++current)
+                {
+                    dst.lbl[current] = i;
+                    dst.src[current].resize(size.x*size.y);
+                    Simd::NeuralConvert(pooled.Region(shift*size, shift*size + size), dst.src[current].data(), true);
+                }
+            }
+        }
+        net.Convert(dst.lbl, dst.dst);
+        return true;
+    }
+
+#define TEST_ADD_LAYER(net, layer) \
+    if(!net.Add(layer)) \
+    { \
+       std::cout << "Can't add layer '" << #layer "' to network!" << std::endl; \
+       return false; \
+    }
+
+    Simd::Neural::Layer * CreateConvolution(const Size & srcSize, size_t srcDepth, size_t dstDepth, size_t coreSize, bool gemm)
+    {
+        Simd::Neural::ConvolutionalLayer * layer = new Simd::Neural::ConvolutionalLayer(Simd::Neural::Function::Relu, srcSize, srcDepth, dstDepth, coreSize);
+        if (!gemm)
+            layer->SetGemm(false);
+        return layer;
+    }
+
+    bool CreateNetwork(Network & net, bool dropout, bool gemm = true)
+    {
+        using namespace Simd::Neural;
+        net.Clear();
+        TEST_ADD_LAYER(net, CreateConvolution(Size(16, 16), 1, 12, 5, gemm));
+        TEST_ADD_LAYER(net, (new MaxPoolingLayer(Function::Relu, Size(12, 12), 12, 2)));
+        if(dropout)
+            TEST_ADD_LAYER(net, (new DropoutLayer(6*6*12, 0.9f)));
+        TEST_ADD_LAYER(net, CreateConvolution(Size(6, 6), 12, 24, 3, gemm));
+        if (dropout)
+            TEST_ADD_LAYER(net, (new DropoutLayer(4 * 4 * 24, 0.8f)));
+        TEST_ADD_LAYER(net, (new FullyConnectedLayer(Function::Relu, 4 * 4 * 24, 96)));
+        if (dropout)
+            TEST_ADD_LAYER(net, (new DropoutLayer(96, 0.7f)));
+        TEST_ADD_LAYER(net, (new FullyConnectedLayer(Function::Sigmoid, 96, 10)));
+        return true;
+    }
+
+    // Gives access to the weights and the gradients of a convolutional layer.
+    struct ConvolutionalLayerTest : public Simd::Neural::ConvolutionalLayer
+    {
+        ConvolutionalLayerTest(const Size & srcSize, size_t srcDepth, size_t dstDepth, size_t coreSize, bool gemm)
+            : Simd::Neural::ConvolutionalLayer(Simd::Neural::Function::Relu, srcSize, srcDepth, dstDepth, coreSize)
+        {
+            SetGemm(gemm);
+            SetThreadNumber(1, true);
+        }
+
+        bool Link(ConvolutionalLayerTest & prev) { return Layer::Link(&prev); }
+        Vector & Weight() { return _weight; }
+        Vector & Bias() { return _bias; }
+        const Vector & Dst() const { return _common[0].dst; }
+        const Vector & DWeight() const { return _common[0].dWeight; }
+        const Vector & PrevDelta() const { return _common[0].prevDelta; }
+    };
+
+    void FillRandom32f(Vector & vector, float lo, float hi)
+    {
+        for (size_t i = 0; i < vector.size(); ++i)
+            vector[i] = lo + (hi - lo)*float(Random());
+    }
+
+    Buffer32f ToBuffer(const Vector & vector)
+    {
+        return Buffer32f(vector.begin(), vector.end());
+    }
+
+    // Runs one Forward/Backward of the second convolution of the digit network through the direct and the GEMM paths and compares dWeight and prevDelta.
+    bool NeuralConvolutionBackwardAutoTest()
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test Simd::Neural::ConvolutionalLayer::Backward direct & gemm.");
+
+        ConvolutionalLayerTest prev(Size(8, 8), 1, 12, 3, false);
+        ConvolutionalLayerTest direct(Size(6, 6), 12, 24, 3, false), gemm(Size(6, 6), 12, 24, 3, true);
+        FillRandom32f(prev.Weight(), -1.0f, 1.0f);
+        FillRandom32f(prev.Bias(), 0.0f, 0.5f);
+        FillRandom32f(direct.Weight(), -1.0f, 1.0f);
+        FillRandom32f(direct.Bias(), -0.5f, 0.5f);
+        gemm.Weight() = direct.Weight();
+        gemm.Bias() = direct.Bias();
+
+        Vector src(8 * 8), delta(4 * 4 * 24);
+        FillRandom32f(src, 0.0f, 1.0f);
+        FillRandom32f(delta, -1.0f, 1.0f);
+        prev.Forward(src, 0, Simd::Neural::Layer::Train);
+
+        ConvolutionalLayerTest * layers[2] = { &direct, &gemm };
+        for (size_t l = 0; l < 2; ++l)
+        {
+            if (!layers[l]->Link(prev))
+                return false;
+            layers[l]->Forward(prev.Dst(), 0, Simd::Neural::Layer::Train);
+            layers[l]->Backward(delta, 0);
+        }
+
+        result = result && Compare(ToBuffer(direct.Dst()), ToBuffer(gemm.Dst()), EPS, true, 32, "dst");
+        result = result && Compare(ToBuffer(direct.DWeight()), ToBuffer(gemm.DWeight()), EPS, true, 32, "dWeight");
+        result = result && Compare(ToBuffer(direct.PrevDelta()), ToBuffer(gemm.PrevDelta()), EPS, true, 32, "prevDelta");
+
+        return result;
+    }
+
+    // Trains the digit network on 1 thread and on all threads, with the direct and the im2col/GEMM convolutions, and logs the samples per second.
+    bool NeuralTrainSpeedTest()
+    {
+        bool result = true;
+
+        Network net;
+        TrainSample sample;
+        if (!CreateNetwork(net, false) || !LoadDigits(net, false, sample))
+            return false;
+
+        String path = ROOT_PATH + "/data/network/digit.txt";
+        Network direct;
+        if (!CreateNetwork(direct, false, false) || !net.Load(path) || !direct.Load(path))
+        {
+            TEST_LOG_SS(Error, "Can't load Simd::Neural::Network from file '" << path << "'!");
+            return false;
+        }
+        for (size_t i = 0; i < sample.src.size() && result; ++i)
+        {
+            const Vector & dst1 = direct.Predict(sample.src[i]);
+            const Vector & dst2 = net.Predict(sample.src[i]);
+            for (size_t j = 0; j < dst1.size() && result; ++j)
+            {
+                if (::fabs(dst1[j] - dst2[j]) > 0.001f)
+                {
+                    TEST_LOG_SS(Error, "Direct and GEMM convolutions predict different values for sample " << i << ": " << dst1[j] << " != " << dst2[j] << " !");
+                    result = false;
+                }
+            }
+        }
+
+        const size_t threadNumber = std::thread::hardware_concurrency();
+        std::stringstream table;
+        table << "Simd::Neural::Network::Train on " << sample.src.size() << " digits:" << std::endl;
+        table << ExpandToLeft("threads", 8) << ExpandToLeft("convolution", 12) << ExpandToLeft("samples/s", 12) << ExpandToLeft("epochs", 8) << ExpandToLeft("error", 10) << std::endl;
+        const double minTime = PerformanceOptions::Get().minTime;
+        for (size_t t = 0; t < (threadNumber > 1 ? 2 : 1) && result; ++t)
+        {
+            for (size_t gemm = 0; gemm < 2; ++gemm)
+            {
+                if (!CreateNetwork(net, true, gemm != 0))
+                    return false;
+                TrainOptions options;
+                options.threadNumber = t ? threadNumber : 1;
+                double start = GetTime(), time = 0;
+                for (options.epochStart = 0; options.epochStart == 0 || time < minTime; options.epochStart++)
+                {
+                    options.epochFinish = options.epochStart + 1;
+                    net.Train(sample.src, sample.dst, options, []() {});
+                    time = GetTime() - start;
+                }
+                Error error = Check(net, sample, options.threshold, false);
+                table << ExpandToLeft(ToString(options.threadNumber), 8) << ExpandToLeft(gemm ? "gemm" : "direct", 12);
+                table << ExpandToLeft(ToString(sample.src.size()*options.epochStart/time, 6, 0), 12) << ExpandToLeft(ToString(options.epochStart), 8);
+                table << ExpandToLeft(ToString(error.first, 1, 4), 10) << std::endl;
+            }
+        }
+        TEST_LOG_SS(Info, table.str());
+
+        return result;
+    }
+}
 
@@ -42,6 +42,7 @@ namespace Test
 			void Call(const View & a, const View & b, View & dst, SimdOperationBinary8uType type) const
 			{
 				TEST_PERFORMANCE_TEST(description);
+				TEST_PERFORMANCE_TEST_SET_PIXELS(a.width*a.height);
 				func(a.data, a.stride, b.data, b.stride, a.width, a.height, View::PixelSize(a.format), dst.data, dst.stride, type);
 			}
 		};
@@ -59,6 +60,7 @@ namespace Test
             void Call(const View & a, const View & b, View & dst, SimdOperationBinary16iType type) const
             {
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(a.width*a.height);
                 func(a.data, a.stride, b.data, b.stride, a.width, a.height, dst.data, dst.stride, type);
             }
         };
@@ -75,6 +77,7 @@ namespace Test
             void Call(const View & v, const View & h, View & dst) const
             {
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(dst.width*dst.height);
                 func(v.data, h.data, dst.data, dst.stride, dst.width, dst.height);
             }
         };
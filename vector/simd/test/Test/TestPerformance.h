@@ -30,6 +30,74 @@ namespace Test
 {
 	double GetTime();
 
+    // Measurement settings, read once from the environment:
+    // TEST_WARMUP - untimed calls before measuring (default 1),
+    // TEST_REPEATS - minimal number of timed calls (default 1),
+    // TEST_MIN_TIME - minimal measuring time in seconds (default MINIMAL_TEST_EXECUTION_TIME),
+    // TEST_CPU - CPU to pin the test to (default -1, no pinning),
+    // TEST_CLOCK=tsc - use the calibrated time stamp counter instead of the monotonic clock,
+    // TEST_PERF_COUNTERS=1 - capture hardware counters around every measurement (Linux only, not with -threads above 1).
+    struct PerformanceOptions
+    {
+        int warmup;
+        int repeats;
+        double minTime;
+        int cpu;
+        bool tsc;
+        bool counters;
+
+        static const PerformanceOptions & Get();
+    };
+
+    // Returns the average time (in seconds) of one call of the function repeated as a measurement of TEST_PERFORMANCE_TEST.
+    template <class Function> double AverageTime(const Function & function)
+    {
+        const PerformanceOptions & options = PerformanceOptions::Get();
+        for (int i = 0; i < options.warmup; ++i)
+            function();
+        size_t count = 0;
+        double start = GetTime(), time = 0;
+        do
+        {
+            function();
+            count++;
+            time = GetTime() - start;
+        } while (time < options.minTime || count < (size_t)options.repeats);
+        return time/count;
+    }
+
+	//-------------------------------------------------------------------------
+
+    class PerformanceCounters
+    {
+    public:
+        enum Counter
+        {
+            Cycles,
+            Instructions,
+            L1dMisses,
+            LlcMisses,
+            BranchMisses,
+            Size
+        };
+
+        static PerformanceCounters & ThisThread();
+
+        bool Enabled() const { return _leader >= 0; }
+
+        void Read(uint64_t values[Size]) const;
+
+        ~PerformanceCounters();
+
+    private:
+        PerformanceCounters();
+
+        int _leader;
+        int _fd[Size];
+        int _index[Size];
+        int _opened;
+    };
+
 	//-------------------------------------------------------------------------
 
     class PerformanceMeasurer
@@ -43,18 +111,36 @@ namespace Test
         bool _entered;
 
         long long _size;
+        long long _pixels;
+        std::vector<double> _samples;
+        uint64_t _counters[PerformanceCounters::Size];
+        uint64_t _counterStart[PerformanceCounters::Size];
 
     public:
+        struct Summary
+        {
+            double median, low, high, mean;
+            size_t outliers;
+        };
+
         PerformanceMeasurer(const String & description = "Unnamed");
         PerformanceMeasurer(const PerformanceMeasurer & pm);
 
         void Enter();
-        void Leave(size_t size = 1);
+        void Leave(size_t size = 1, size_t pixels = 0);
 
         double Average() const;
+        Summary Robust() const;
         String Statistic() const;
 
         String Description() const { return _description; }
+        int Count() const { return _count; }
+        double Total() const { return _total; }
+        double Min() const { return _min; }
+        double Max() const { return _max; }
+        long long Size() const { return _size; }
+        long long Pixels() const { return _pixels; }
+        uint64_t Counter(PerformanceCounters::Counter counter) const { return _counters[counter]; }
 
         void Combine(const PerformanceMeasurer & other);
     };
@@ -65,15 +151,16 @@ namespace Test
     {
         PerformanceMeasurer * _pm;
         size_t _size;
+        size_t _pixels;
     public:
 
-        ScopedPerformanceMeasurer(PerformanceMeasurer & pm): _pm(&pm), _size(1)
+        ScopedPerformanceMeasurer(PerformanceMeasurer & pm): _pm(&pm), _size(1), _pixels(0)
         {
             if (_pm)
                 _pm->Enter();
         }
 
-        ScopedPerformanceMeasurer(PerformanceMeasurer * pm): _pm(pm), _size(1)
+        ScopedPerformanceMeasurer(PerformanceMeasurer * pm): _pm(pm), _size(1), _pixels(0)
         {
             if (_pm)
                 _pm->Enter();
@@ -82,10 +169,31 @@ namespace Test
         ~ScopedPerformanceMeasurer()
         {
             if (_pm)
-                _pm->Leave(_size);
+                _pm->Leave(_size, _pixels);
         }
 
         void SetSize(size_t size) { _size = size; }
+        void SetPixels(size_t pixels) { _pixels = pixels; }
+    };
+
+    //-------------------------------------------------------------------------
+
+    // Sets the frame size (W, H) and the library thread number of the tests from the command line:
+    // -w=<width> -h=<height> - run at one size,
+    // -sweep[=<min width>:<max width>] - run at 16:9 frames with doubling width (128..4096 by default),
+    // -threads=<number> - run with the given number of threads (see SimdSetThreadNumber),
+    // -thread-sweep[=<max number>] - run with 1, 2, 4 ... threads (up to 32 or the number of cores by default).
+    // The number of threads is limited by the size of the thread pool.
+    class Sweep
+    {
+        typedef std::pair<Size, size_t> Config;
+        std::vector<Config> _configs;
+        size_t _current;
+
+    public:
+        Sweep(int argc, char* argv[]);
+
+        bool Next();
     };
 
     //-------------------------------------------------------------------------
@@ -99,6 +207,7 @@ namespace Test
         {
             FunctionMap map;
             bool align;
+            bool warmup;
         };
         typedef std::map<std::thread::id, Thread> ThreadMap;
 
@@ -106,6 +215,7 @@ namespace Test
         mutable std::recursive_mutex _mutex;
 
         Thread & ThisThread();
+        void Collect(FunctionMap & map) const;
 
     public:
         static PerformanceMeasurerStorage s_storage;
@@ -117,35 +227,54 @@ namespace Test
 
         size_t Align(size_t size);
 
+        void Warmup(bool enable);
+
         String Report(bool align = false, bool raw = false) const;
 
+        String ReportCsv(const String & test, bool header = true) const;
+        String ReportJson(const String & test) const;
+
+        bool SaveReport(int argc, char* argv[]) const;
+
         void Clear();
     };
 }
 
-#define TEST_PERFORMANCE_TEST_(decription) Test::ScopedPerformanceMeasurer ___spm(*(Test::PerformanceMeasurerStorage::s_storage.Get(decription)));
+#define TEST_PERFORMANCE_TEST_(decription) Test::ScopedPerformanceMeasurer ___spm(Test::PerformanceMeasurerStorage::s_storage.Get(decription));
 #define TEST_FUNCTION_PERFORMANCE_TEST_ TEST_PERFORMANCE_TEST_(__FUNCTION__)
 #define TEST_PERFORMANCE_TEST_SET_SIZE_(size) ___spm.SetSize(size);
+#define TEST_PERFORMANCE_TEST_SET_PIXELS_(pixels) ___spm.SetPixels(pixels);
 
 #ifdef TEST_PERFORMANCE_TEST_ENABLE
 #define TEST_PERFORMANCE_TEST(decription) TEST_PERFORMANCE_TEST_(decription)
 #define TEST_FUNCTION_PERFORMANCE_TEST TEST_FUNCTION_PERFORMANCE_TEST_
 #define TEST_PERFORMANCE_TEST_SET_SIZE(size) TEST_PERFORMANCE_TEST_SET_SIZE_(size)
+#define TEST_PERFORMANCE_TEST_SET_PIXELS(pixels) TEST_PERFORMANCE_TEST_SET_PIXELS_(pixels)
 #else//TEST_PERFORMANCE_TEST_ENABLE
 #define TEST_PERFORMANCE_TEST(decription)
 #define TEST_FUNCTION_PERFORMANCE_TEST
 #define TEST_PERFORMANCE_TEST_SET_SIZE(size)
+#define TEST_PERFORMANCE_TEST_SET_PIXELS(pixels)
 #endif//TEST_PERFORMANCE_TEST_ENABLE
 
 #ifdef NDEBUG
 #define TEST_EXECUTE_AT_LEAST_MIN_TIME(test) \
 { \
+	const Test::PerformanceOptions & ___options = Test::PerformanceOptions::Get(); \
+	Test::PerformanceMeasurerStorage::s_storage.Warmup(true); \
+	for(int ___warmup = 0; ___warmup < ___options.warmup; ++___warmup) \
+	{ \
+		test; \
+	} \
+	Test::PerformanceMeasurerStorage::s_storage.Warmup(false); \
 	double startTime = Test::GetTime(); \
+	int ___repeat = 0; \
 	do \
 	{ \
 		test; \
+		++___repeat; \
 	} \
-	while(Test::GetTime() - startTime < Test::MINIMAL_TEST_EXECUTION_TIME); \
+	while(Test::GetTime() - startTime < ___options.minTime || ___repeat < ___options.repeats); \
 }
 #else
 #define TEST_EXECUTE_AT_LEAST_MIN_TIME(test) \
@@ -41,6 +41,7 @@ namespace Test
 			void Call(const View & src, View & dst) const
 			{
 				TEST_PERFORMANCE_TEST(description);
+				TEST_PERFORMANCE_TEST_SET_PIXELS(src.width);
 				func(src.data, src.width, dst.data);
 			}
 		};
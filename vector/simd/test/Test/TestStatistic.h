@@ -42,6 +42,7 @@ namespace Test
 			void Call(const View & src, uint8_t * min, uint8_t * max, uint8_t * average) const
 			{
 				TEST_PERFORMANCE_TEST(description);
+				TEST_PERFORMANCE_TEST_SET_PIXELS(src.width*src.height);
 				func(src.data, src.stride, src.width, src.height, min, max, average);
 			}
 		};
@@ -99,6 +100,7 @@ namespace Test
             void Call(const View & mask, uint8_t index, uint64_t * area, uint64_t * x, uint64_t * y, uint64_t * xx, uint64_t * xy, uint64_t * yy) const
             {
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(mask.width*mask.height);
                 func(mask.data, mask.stride, mask.width, mask.height, index, area, x, y, xx, xy, yy);
             }
         };
@@ -177,6 +179,7 @@ namespace Test
             void Call(const View & src, uint32_t * sums) const
             {
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(src.width*src.height);
                 func(src.data, src.stride, src.width, src.height, sums);
             }
         };
@@ -232,6 +235,7 @@ namespace Test
             void Call(const View & src, uint64_t * sum) const
             {
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(src.width*src.height);
                 func(src.data, src.stride, src.width, src.height, sum);
             }
         };
@@ -286,6 +290,7 @@ namespace Test
             void Call(const View & a, const View & b, uint64_t * sum) const
             {
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(a.width*a.height);
                 func(a.data, a.stride, b.data, b.stride, a.width, a.height, sum);
             }
         };
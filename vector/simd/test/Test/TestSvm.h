@@ -41,6 +41,7 @@ namespace Test
             void Call(const View & x, const View & svs, const View & weights, size_t length, size_t count, float * sum) const
             {
                 TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(length*count);
                 func((float*)x.data, (float*)svs.data, (float*)weights.data, length, count, sum);
             }
         };       
@@ -84,5 +85,115 @@ namespace Test
         return result;
     }
 
+    namespace
+    {
+        struct FuncSLB
+        {
+            typedef void (*FuncPtr)(const float * x, size_t xStride, size_t xCount, const float * svs, const float * weights, size_t length, size_t count, float * sums);
+
+            FuncPtr func;
+            String description;
+
+            FuncSLB(const FuncPtr & f, const String & d) : func(f), description(d) {}
+
+            void Call(const View & x, const View & svs, const View & weights, size_t count, View & sums) const
+            {
+                TEST_PERFORMANCE_TEST(description);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(x.width*x.height*count);
+                func((float*)x.data, x.stride/sizeof(float), x.height, (float*)svs.data, (float*)weights.data, x.width, count, (float*)sums.data);
+            }
+        };
+
+        // The batch functions sum in another order, so the difference is measured relative to the largest sum of the batch.
+        bool CompareSums(const View & s1, const View & s2, float eps)
+        {
+            float norm = 0;
+            for (size_t i = 0; i < s1.width; ++i)
+                norm = std::max(norm, ::fabs(((float*)s1.data)[i]));
+            return Compare(s1, s2, eps*norm, true, 32, false);
+        }
+    }
+
+#define FUNC_SLB(function) FuncSLB(function, #function)
+
+    bool SvmSumLinearBatchAutoTest(size_t length, size_t count, size_t xCount, const FuncSLB & f1, const FuncSLB & f2)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f1.description << " & " << f2.description << " [" << length << ", " << count << ", " << xCount << "].");
+
+        View svs(length*count, 1, View::Float, NULL, TEST_ALIGN(SIMD_ALIGN));
+        View weights(count, 1, View::Float, NULL, TEST_ALIGN(SIMD_ALIGN));
+        View x(length, xCount, View::Float, NULL, TEST_ALIGN(SIMD_ALIGN));
+
+        FillRandom32f(svs, -10.0, 10.0);
+        FillRandom32f(weights, -10.0, 10.0);
+        FillRandom32f(x, -10.0, 10.0);
+
+        View s1(xCount, 1, View::Float, NULL, TEST_ALIGN(SIMD_ALIGN));
+        View s2(xCount, 1, View::Float, NULL, TEST_ALIGN(SIMD_ALIGN));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f1.Call(x, svs, weights, count, s1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(x, svs, weights, count, s2));
+
+        result = result && CompareSums(s1, s2, EPS);
+
+        return result;
+    }
+
+    bool SvmSumLinearBatchAutoTest(const FuncSLB & f1, const FuncSLB & f2)
+    {
+        bool result = true;
+
+        result = result && SvmSumLinearBatchAutoTest(W/9, H, H*9, f1, f2);
+        result = result && SvmSumLinearBatchAutoTest(W/10 + 1, H + O, H*10 - O, f1, f2);
+        result = result && SvmSumLinearBatchAutoTest(W/11, O, H, f1, f2);
+
+        return result;
+    }
+
+    // Checks the batch function against the single vector one called for every feature vector, 
+    // then prints the time per feature vector of both for several SVM sizes.
+    bool SvmSumLinearBatchSpeedTest(const FuncSL & f1, const FuncSLB & f2)
+    {
+        bool result = true;
+
+        const size_t shapes[][3] = { { 64, 256, 1024 }, { 256, 1024, 1024 }, { 1024, 256, 256 }, { 3780, 512, 64 } };
+        std::stringstream table;
+        table << f2.description << " vs " << f1.description << " loop (microseconds per vector):" << std::endl;
+        table << ExpandToLeft("length", 8) << ExpandToLeft("count", 8) << ExpandToLeft("vectors", 8) << ExpandToLeft("loop", 10) << ExpandToLeft("batch", 10) << ExpandToLeft("speedup", 10) << std::endl;
+        for (size_t i = 0; i < sizeof(shapes)/sizeof(shapes[0]) && result; ++i)
+        {
+            const size_t length = shapes[i][0], count = shapes[i][1], xCount = shapes[i][2];
+            View svs(length*count, 1, View::Float, NULL, TEST_ALIGN(SIMD_ALIGN));
+            View weights(count, 1, View::Float, NULL, TEST_ALIGN(SIMD_ALIGN));
+            View x(length, xCount, View::Float, NULL, TEST_ALIGN(SIMD_ALIGN));
+            View s1(xCount, 1, View::Float, NULL, TEST_ALIGN(SIMD_ALIGN));
+            View s2(xCount, 1, View::Float, NULL, TEST_ALIGN(SIMD_ALIGN));
+            FillRandom32f(svs, -10.0, 10.0);
+            FillRandom32f(weights, -10.0, 10.0);
+            FillRandom32f(x, -10.0, 10.0);
+
+            double loop = AverageTime([&]()
+            {
+                for (size_t n = 0; n < xCount; ++n)
+                    f1.func(&x.At<float>(0, n), (float*)svs.data, (float*)weights.data, length, count, (float*)s1.data + n);
+            });
+            double batch = AverageTime([&]()
+            {
+                f2.func((float*)x.data, x.stride/sizeof(float), xCount, (float*)svs.data, (float*)weights.data, length, count, (float*)s2.data);
+            });
+            result = result && CompareSums(s1, s2, EPS);
+
+            table << ExpandToLeft(ToString(length), 8) << ExpandToLeft(ToString(count), 8) << ExpandToLeft(ToString(xCount), 8);
+            table << ExpandToLeft(ToString(loop*1000000.0/xCount, 3, 2), 10) << ExpandToLeft(ToString(batch*1000000.0/xCount, 3, 2), 10);
+            table << ExpandToLeft(ToString(loop/batch, 3, 2), 10) << std::endl;
+        }
+        TEST_LOG_SS(Info, table.str());
+
+        return result;
+    }
+
 
 }
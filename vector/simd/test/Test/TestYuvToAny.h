@@ -42,6 +42,7 @@ namespace Test
 			void Call(const View & y, const View & u, const View & v, View & dst) const
 			{
 				TEST_PERFORMANCE_TEST(description);
+				TEST_PERFORMANCE_TEST_SET_PIXELS(y.width*y.height);
 				func(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, dst.data, dst.stride);
 			}
 		};	
@@ -72,7 +73,10 @@ namespace Test
 
 		TEST_EXECUTE_AT_LEAST_MIN_TIME(f2.Call(y, u, v, dst2));
 
-		result = result && Compare(dst1, dst2, maxDifference, true, 64, 255);
+		if(maxDifference > 0)
+			TEST_LOG_SS(Info, "Difference: " << DifferenceDescription(dst1, dst2, 256) << ".");
+
+		result = result && Compare(dst1, dst2, maxDifference, true, 64, 256);
 
 		return result;
 	}
@@ -88,6 +92,84 @@ namespace Test
         return result;
     }
 
+    namespace
+    {
+        struct FuncF
+        {
+            typedef void (*ToBgraPtr)(const uint8_t * y, size_t yStride, const uint8_t * u, size_t uStride, const uint8_t * v, size_t vStride,
+                size_t width, size_t height, uint8_t * bgra, size_t bgraStride, uint8_t alpha);
+            typedef void (*BgraToBgrPtr)(const uint8_t * bgra, size_t width, size_t height, size_t bgraStride, uint8_t * bgr, size_t bgrStride);
+
+            ToBgraPtr toBgra;
+            BgraToBgrPtr bgraToBgr;
+            Func::FuncPtr toBgr;
+            String description;
+
+            FuncF(const ToBgraPtr & f1, const BgraToBgrPtr & f2, const Func::FuncPtr & f3, const String & d) : toBgra(f1), bgraToBgr(f2), toBgr(f3), description(d) {}
+
+            // Two passes through an intermediate BGRA frame: luma and chroma planes are read, then 4 + 4 + 3 bytes per pixel.
+            void Call(const View & y, const View & u, const View & v, View & bgra, View & bgr) const
+            {
+                TEST_PERFORMANCE_TEST(description + " unfused");
+                TEST_PERFORMANCE_TEST_SET_SIZE(y.width*y.height*12 + u.width*u.height*2);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(y.width*y.height);
+                toBgra(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, 0xFF);
+                bgraToBgr(bgra.data, bgra.width, bgra.height, bgra.stride, bgr.data, bgr.stride);
+            }
+
+            // Fused conversion: luma and chroma planes are read and only 3 bytes per pixel are written.
+            void Call(const View & y, const View & u, const View & v, View & bgr) const
+            {
+                TEST_PERFORMANCE_TEST(description + " fused");
+                TEST_PERFORMANCE_TEST_SET_SIZE(y.width*y.height*4 + u.width*u.height*2);
+                TEST_PERFORMANCE_TEST_SET_PIXELS(y.width*y.height);
+                toBgr(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgr.data, bgr.stride);
+            }
+        };
+    }
+
+#define FUNC_F(isa, yuv) FuncF(isa::yuv##ToBgra, isa::BgraToBgr, isa::yuv##ToBgr, #isa "::" #yuv "ToBgr")
+
+    bool YuvToBgrFusionAutoTest(int width, int height, int dx, int dy, const FuncF & f)
+    {
+        bool result = true;
+
+        TEST_LOG_SS(Info, "Test " << f.description << " unfused & fused [" << width << ", " << height << "].");
+
+        const int uvWidth = width/dx;
+        const int uvHeight = height/dy;
+
+        View y(width, height, View::Gray8, NULL, TEST_ALIGN(width));
+        FillRandom(y);
+        View u(uvWidth, uvHeight, View::Gray8, NULL, TEST_ALIGN(uvWidth));
+        FillRandom(u);
+        View v(uvWidth, uvHeight, View::Gray8, NULL, TEST_ALIGN(uvWidth));
+        FillRandom(v);
+
+        View bgra(width, height, View::Bgra32, NULL, TEST_ALIGN(width));
+        View bgr1(width, height, View::Bgr24, NULL, TEST_ALIGN(width));
+        View bgr2(width, height, View::Bgr24, NULL, TEST_ALIGN(width));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f.Call(y, u, v, bgra, bgr1));
+
+        TEST_EXECUTE_AT_LEAST_MIN_TIME(f.Call(y, u, v, bgr2));
+
+        result = result && Compare(bgr1, bgr2, 0, true, 64);
+
+        return result;
+    }
+
+    bool YuvToBgrFusionAutoTest(int dx, int dy, const FuncF & f)
+    {
+        bool result = true;
+
+        result = result && YuvToBgrFusionAutoTest(W, H, dx, dy, f);
+        result = result && YuvToBgrFusionAutoTest(W + O*dx, H - O*dy, dx, dy, f);
+        result = result && YuvToBgrFusionAutoTest(W - O*dx, H + O*dy, dx, dy, f);
+
+        return result;
+    }
+
 }
 
 #if defined(SIMD_NEON_ENABLE) && (SIMD_NEON_RCP_ITER > -1)
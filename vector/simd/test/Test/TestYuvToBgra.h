@@ -42,6 +42,7 @@ namespace Test
 			void Call(const View & y, const View & u, const View & v, View & bgra) const
 			{
 				TEST_PERFORMANCE_TEST(description);
+				TEST_PERFORMANCE_TEST_SET_PIXELS(y.width*y.height);
 				func(y.data, y.stride, u.data, u.stride, v.data, v.stride, y.width, y.height, bgra.data, bgra.stride, 0xFF);
 			}
 		};	
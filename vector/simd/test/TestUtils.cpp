@@ -163,7 +163,7 @@ namespace Test
         }
     }
 
-    template <class Channel> bool Compare(const View & a, const View & b, int differenceMax, bool printError, int errorCountMax, int valueCycle, 
+    template <class Channel> bool Compare(const View & a, const View & b, int differenceMax, bool printError, int errorCountMax, int hueCycle, 
         const String & description)
     {
         std::stringstream message;
@@ -181,8 +181,8 @@ namespace Test
                     if(differenceMax > 0)
                     {
                         Channel difference = Simd::Max(pA[offset], pB[offset]) - Simd::Min(pA[offset], pB[offset]);
-                        if(valueCycle > 0)
-                            difference = Simd::Min<Channel>(difference, valueCycle - difference);
+                        if(hueCycle > 0 && offset%channelCount == 0)
+                            difference = Simd::Min<Channel>(difference, Channel(hueCycle - difference));
                         if(difference <= differenceMax)
                             continue;
                     }
@@ -225,7 +225,7 @@ namespace Test
 		return true;
 	}
 
-    bool Compare(const View & a, const View & b, int differenceMax, bool printError, int errorCountMax, int valueCycle, 
+    bool Compare(const View & a, const View & b, int differenceMax, bool printError, int errorCountMax, int hueCycle, 
 		const String & description)
     {
         assert(Simd::Compatible(a, b));
@@ -234,21 +234,21 @@ namespace Test
 		//	return true;
 
         if(a.format == View::Float)
-            return Compare<float>(a, b, differenceMax, printError, errorCountMax, valueCycle, description);
+            return Compare<float>(a, b, differenceMax, printError, errorCountMax, hueCycle, description);
         else if(a.format == View::Double)
-            return Compare<double>(a, b, differenceMax, printError, errorCountMax, valueCycle, description);
+            return Compare<double>(a, b, differenceMax, printError, errorCountMax, hueCycle, description);
         else
         {
             switch(a.ChannelSize())
             {
             case 1:
-                return Compare<uint8_t>(a, b, differenceMax, printError, errorCountMax, valueCycle, description);
+                return Compare<uint8_t>(a, b, differenceMax, printError, errorCountMax, hueCycle, description);
             case 2:
-                return Compare<int16_t>(a, b, differenceMax, printError, errorCountMax, valueCycle, description);
+                return Compare<int16_t>(a, b, differenceMax, printError, errorCountMax, hueCycle, description);
             case 4:
-                return Compare<int32_t>(a, b, differenceMax, printError, errorCountMax, valueCycle, description);
+                return Compare<int32_t>(a, b, differenceMax, printError, errorCountMax, hueCycle, description);
             case 8:
-                return Compare<int64_t>(a, b, differenceMax, printError, errorCountMax, valueCycle, description);
+                return Compare<int64_t>(a, b, differenceMax, printError, errorCountMax, hueCycle, description);
             default:
                 assert(0);
             }
@@ -373,6 +373,38 @@ namespace Test
 		return ss.str();
 	}
 
+    String DifferenceDescription(const View & a, const View & b, int hueCycle)
+    {
+        assert(Simd::Compatible(a, b) && a.ChannelSize() == 1);
+
+        const size_t channelCount = a.ChannelCount();
+        std::vector<int> differenceMax(channelCount, 0);
+        size_t errorCount = 0;
+        for (size_t row = 0; row < a.height; ++row)
+        {
+            const uint8_t * pA = a.data + row*a.stride;
+            const uint8_t * pB = b.data + row*b.stride;
+            for (size_t offset = 0, size = a.width*channelCount; offset < size; ++offset)
+            {
+                int difference = Simd::Abs(pA[offset] - pB[offset]);
+                if (hueCycle > 0 && offset%channelCount == 0)
+                    difference = Simd::Min(difference, hueCycle - difference);
+                if (difference)
+                {
+                    errorCount++;
+                    differenceMax[offset%channelCount] = Simd::Max(differenceMax[offset%channelCount], difference);
+                }
+            }
+        }
+
+        std::stringstream ss;
+        ss << "max difference (" << differenceMax[0];
+        for (size_t channel = 1; channel < channelCount; ++channel)
+            ss << ", " << differenceMax[channel];
+        ss << "), " << std::fixed << std::setprecision(3) << 100.0*errorCount/(a.width*a.height*channelCount) << "% of values differ";
+        return ss.str();
+    }
+
     String FormatDescription(View::Format format)
     {
         switch(format)
@@ -252,6 +252,18 @@ bool AutoTest8()	{
 
 		return result;
 	}
+bool AutoTest9()    {
+        bool result = true;
+
+        result = result && BackgroundPipelineAutoTest(FUNC_B(Simd::Base));
+
+#ifdef SIMD_AVX2_ENABLE
+        if(Simd::Avx2::Enable)
+            result = result && BackgroundPipelineAutoTest(FUNC_B(Simd::Avx2));
+#endif 
+
+        return result;
+    }
 //_AUTO_TEST_		
 	
   String ROOT_PATH = "..";
@@ -259,6 +271,8 @@ bool AutoTest8()	{
 
 int main(int argc, char* argv[])
 {
+    for (Test::Sweep sweep(argc, argv); sweep.Next(); )
+    {
 
 //_TESTS_8
 
@@ -318,11 +332,21 @@ if(!result8)
 {
   return 1;
 }
+TEST_LOG_SS(Info,  "AutoTest9 is started :");
+bool result9 = Test::AutoTest9();
+TEST_LOG_SS(Info, "AutoTest9 is finished " << (result9 ? "successfully." : "with errors!") << std::endl);
+if(!result9)
+{
+  return 1;
+}
 //_RUN_CODE_
     
 #ifdef TEST_PERFORMANCE_TEST_ENABLE
     TEST_LOG_SS(Info, Test::PerformanceMeasurerStorage::s_storage.Report(false, false));
+    Test::PerformanceMeasurerStorage::s_storage.SaveReport(argc, argv);
+    Test::PerformanceMeasurerStorage::s_storage.Clear();
 #endif
+    }
 
     return 0;
 }
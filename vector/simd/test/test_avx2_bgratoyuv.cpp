@@ -137,6 +137,8 @@ bool AutoTest3()    {
 
 int main(int argc, char* argv[])
 {
+    for (Test::Sweep sweep(argc, argv); sweep.Next(); )
+    {
 
 //_TESTS_3
 
@@ -165,7 +167,10 @@ if(!result3)
     
 #ifdef TEST_PERFORMANCE_TEST_ENABLE
     TEST_LOG_SS(Info, Test::PerformanceMeasurerStorage::s_storage.Report(false, false));
+    Test::PerformanceMeasurerStorage::s_storage.SaveReport(argc, argv);
+    Test::PerformanceMeasurerStorage::s_storage.Clear();
 #endif
+    }
 
     return 0;
 }
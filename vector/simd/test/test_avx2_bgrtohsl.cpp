@@ -0,0 +1,93 @@
+
+/*
+* Tests for Simd Library (http://simd.sourceforge.net).
+*
+* Copyright (c) 2011-2017 Yermalayeu Ihar,
+*               2014-2017 Antonenka Mikhail.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in
+* all copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*/
+#include "Test/TestPerformance.h"
+#include "Test/TestUtils.h"
+#include "Test/TestLog.h"
+#undef SIMD_SSE41_ENABLE
+#undef SIMD_AVX2_ENABLE
+#define SIMD_AVX2_ENABLE
+#include "Test/TestAnyToAny.h"
+//_INSERT_HEADERS_
+
+namespace Test
+{
+
+	
+bool AutoTest1()    {
+        bool result = true;
+
+        result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsl24, FUNC(Simd::Base::BgrToHsl), FUNC(SimdBgrToHsl));
+
+#ifdef SIMD_SSE41_ENABLE
+        if(Simd::Sse41::Enable)
+        {
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsl24, FUNC(Simd::Sse41::BgrToHsl<-1>), FUNC(SimdBgrToHsl));
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsl24, FUNC(Simd::Sse41::BgrToHsl<0>), FUNC(SimdBgrToHsl), 1);
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsl24, FUNC(Simd::Sse41::BgrToHsl<1>), FUNC(SimdBgrToHsl));
+        }
+#endif
+
+#ifdef SIMD_AVX2_ENABLE
+        if(Simd::Avx2::Enable)
+        {
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsl24, FUNC(Simd::Avx2::BgrToHsl<-1>), FUNC(SimdBgrToHsl));
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsl24, FUNC(Simd::Avx2::BgrToHsl<0>), FUNC(SimdBgrToHsl), 1);
+            result = result && AnyToAnyAutoTest(View::Bgr24, View::Hsl24, FUNC(Simd::Avx2::BgrToHsl<1>), FUNC(SimdBgrToHsl));
+        }
+#endif
+
+        return result;    
+    }
+//_AUTO_TEST_		
+	
+  String ROOT_PATH = "..";
+}
+
+int main(int argc, char* argv[])
+{
+    for (Test::Sweep sweep(argc, argv); sweep.Next(); )
+    {
+
+//_TESTS_1
+
+TEST_LOG_SS(Info,  "AutoTest1 is started :");
+bool result1 = Test::AutoTest1();
+TEST_LOG_SS(Info, "AutoTest1 is finished " << (result1 ? "successfully." : "with errors!") << std::endl);
+if(!result1)
+{
+  return 1;
+}
+//_RUN_CODE_
+    
+#ifdef TEST_PERFORMANCE_TEST_ENABLE
+    TEST_LOG_SS(Info, Test::PerformanceMeasurerStorage::s_storage.Report(false, false));
+    Test::PerformanceMeasurerStorage::s_storage.SaveReport(argc, argv);
+    Test::PerformanceMeasurerStorage::s_storage.Clear();
+#endif
+    }
+
+    return 0;
+}
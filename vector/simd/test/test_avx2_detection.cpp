@@ -167,6 +167,13 @@ bool AutoTest6()    {
             result = result && DetectionDetectAutoTest(1, 1, 1, FUNC_D(Simd::Neon::DetectionLbpDetect16ii), FUNC_D(SimdDetectionLbpDetect16ii));
 #endif
 
+        return result;
+    }
+bool AutoTest7()    {
+        bool result = true;
+
+        result = result && DetectionObjectAutoTest(FuncO(1, "Simd::Detection serial"), FuncO(-1, "Simd::Detection pool"));
+
         return result;
     }
 //_AUTO_TEST_		
@@ -176,9 +183,19 @@ bool AutoTest6()    {
 
 int main(int argc, char* argv[])
 {
+    for (Test::Sweep sweep(argc, argv); sweep.Next(); )
+    {
 
 //_TESTS_6
 
+// the serial-vs-pool check first, so that a failing kernel test cannot skip it
+TEST_LOG_SS(Info,  "AutoTest7 is started :");
+bool result7 = Test::AutoTest7();
+TEST_LOG_SS(Info, "AutoTest7 is finished " << (result7 ? "successfully." : "with errors!") << std::endl);
+if(!result7)
+{
+  return 1;
+}
 TEST_LOG_SS(Info,  "AutoTest1 is started :");
 bool result1 = Test::AutoTest1();
 TEST_LOG_SS(Info, "AutoTest1 is finished " << (result1 ? "successfully." : "with errors!") << std::endl);
@@ -225,7 +242,10 @@ if(!result6)
     
 #ifdef TEST_PERFORMANCE_TEST_ENABLE
     TEST_LOG_SS(Info, Test::PerformanceMeasurerStorage::s_storage.Report(false, false));
+    Test::PerformanceMeasurerStorage::s_storage.SaveReport(argc, argv);
+    Test::PerformanceMeasurerStorage::s_storage.Clear();
 #endif
+    }
 
     return 0;
 }
@@ -234,6 +234,8 @@ bool AutoTest7()    {
 
 int main(int argc, char* argv[])
 {
+    for (Test::Sweep sweep(argc, argv); sweep.Next(); )
+    {
 
 //_TESTS_7
 
@@ -290,7 +292,10 @@ if(!result7)
     
 #ifdef TEST_PERFORMANCE_TEST_ENABLE
     TEST_LOG_SS(Info, Test::PerformanceMeasurerStorage::s_storage.Report(false, false));
+    Test::PerformanceMeasurerStorage::s_storage.SaveReport(argc, argv);
+    Test::PerformanceMeasurerStorage::s_storage.Clear();
 #endif
+    }
 
     return 0;
 }
@@ -29,6 +29,7 @@
 #undef SIMD_SSE_ENABLE
 #undef SIMD_AVX_ENABLE
 #undef SIMD_AVX2_ENABLE
+#undef SIMD_AVX512BW_ENABLE
 #undef SIMD_VSX_ENABLE
 #undef SIMD_NEON_ENABLE
 #define SIMD_AVX2_ENABLE
@@ -258,9 +259,47 @@ bool AutoTest7()	{
 
 		return result;
 }
+bool AutoTest8()    {
+        bool result = true;
+
+        result = result && NeuralProductSumBatchAutoTest(EPS, FUNC_PSB(Simd::Base::NeuralProductSumBatch), FUNC_PSB(SimdNeuralProductSumBatch));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+            result = result && NeuralProductSumBatchAutoTest(EPS, FUNC_PSB(Simd::Avx2::NeuralProductSumBatch), FUNC_PSB(SimdNeuralProductSumBatch));
+#endif
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if (Simd::Avx512bw::Enable)
+            result = result && NeuralProductSumBatchAutoTest(EPS, FUNC_PSB(Simd::Avx512bw::NeuralProductSumBatch), FUNC_PSB(SimdNeuralProductSumBatch));
+#endif
+
+        result = result && NeuralProductSumBatchSpeedTest(EPS, FUNC_PS(SimdNeuralProductSum), FUNC_PSB(SimdNeuralProductSumBatch));
+
+#ifdef SIMD_AVX2_ENABLE
+        if (Simd::Avx2::Enable)
+        {
+            result = result && NeuralProductSumBatchSpeedTest(EPS, FUNC_PS(Simd::Avx2::NeuralProductSum), FUNC_PSB(Simd::Avx2::NeuralProductSumBatch));
+#ifdef SIMD_AVX512BW_ENABLE
+            if (Simd::Avx512bw::Enable)
+                result = result && NeuralProductSumBatchSpeedTest(EPS, FUNC_PS(Simd::Avx2::NeuralProductSum), FUNC_PSB(Simd::Avx512bw::NeuralProductSumBatch));
+#endif
+        }
+#endif
+
+        return result;
+    }
 
 
 
+bool AutoTest9()    {
+        bool result = true;
+
+        result = result && NeuralConvolutionBackwardAutoTest();
+        result = result && NeuralTrainSpeedTest();
+
+        return result;
+    }
 //_AUTO_TEST_		
 	
   String ROOT_PATH = "..";
@@ -268,6 +307,8 @@ bool AutoTest7()	{
 
 int main(int argc, char* argv[])
 {
+    for (Test::Sweep sweep(argc, argv); sweep.Next(); )
+    {
 
 //_TESTS_6
 
@@ -322,11 +363,29 @@ if(!result7)
   return 1;
 }
 
+TEST_LOG_SS(Info,  "AutoTest8 is started :");
+bool result8 = Test::AutoTest8();
+TEST_LOG_SS(Info, "AutoTest8 is finished " << (result8 ? "successfully." : "with errors!") << std::endl);
+if(!result8)
+{
+  return 1;
+}
+
+TEST_LOG_SS(Info,  "AutoTest9 is started :");
+bool result9 = Test::AutoTest9();
+TEST_LOG_SS(Info, "AutoTest9 is finished " << (result9 ? "successfully." : "with errors!") << std::endl);
+if(!result9)
+{
+  return 1;
+}
 //_RUN_CODE_
     
 #ifdef TEST_PERFORMANCE_TEST_ENABLE
     TEST_LOG_SS(Info, Test::PerformanceMeasurerStorage::s_storage.Report(false, false));
+    Test::PerformanceMeasurerStorage::s_storage.SaveReport(argc, argv);
+    Test::PerformanceMeasurerStorage::s_storage.Clear();
 #endif
+    }
 
     return 0;
 }
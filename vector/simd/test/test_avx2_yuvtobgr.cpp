@@ -28,6 +28,7 @@
 #include "Test/TestLog.h"
 #undef SIMD_SSSE3_ENABLE
 #undef SIMD_AVX2_ENABLE
+#undef SIMD_AVX512BW_ENABLE
 #undef SIMD_VMX_ENABLE
 #undef SIMD_NEON_ENABLE
 #define SIMD_AVX2_ENABLE
@@ -117,6 +118,30 @@ bool AutoTest3()    {
 			result = result && YuvToAnyAutoTest(2, 2, View::Bgr24, FUNC(Simd::Neon::Yuv420pToBgr), FUNC(SimdYuv420pToBgr));
 #endif
 
+        return result;
+    }
+bool AutoTest4()    {
+        bool result = true;
+
+        result = result && YuvToBgrFusionAutoTest(2, 2, FUNC_F(Simd::Base, Yuv420p));
+        result = result && YuvToBgrFusionAutoTest(1, 1, FUNC_F(Simd::Base, Yuv444p));
+
+#ifdef SIMD_AVX2_ENABLE
+        if(Simd::Avx2::Enable)
+        {
+            result = result && YuvToBgrFusionAutoTest(2, 2, FUNC_F(Simd::Avx2, Yuv420p));
+            result = result && YuvToBgrFusionAutoTest(1, 1, FUNC_F(Simd::Avx2, Yuv444p));
+        }
+#endif 
+
+#ifdef SIMD_AVX512BW_ENABLE
+        if(Simd::Avx512bw::Enable)
+        {
+            result = result && YuvToBgrFusionAutoTest(2, 2, FUNC_F(Simd::Avx512bw, Yuv420p));
+            result = result && YuvToBgrFusionAutoTest(1, 1, FUNC_F(Simd::Avx512bw, Yuv444p));
+        }
+#endif 
+
         return result;
     }
 //_AUTO_TEST_		
@@ -126,6 +151,8 @@ bool AutoTest3()    {
 
 int main(int argc, char* argv[])
 {
+    for (Test::Sweep sweep(argc, argv); sweep.Next(); )
+    {
 
 //_TESTS_3
 
@@ -150,11 +177,21 @@ if(!result3)
 {
   return 1;
 }
+TEST_LOG_SS(Info,  "AutoTest4 is started :");
+bool result4 = Test::AutoTest4();
+TEST_LOG_SS(Info, "AutoTest4 is finished " << (result4 ? "successfully." : "with errors!") << std::endl);
+if(!result4)
+{
+  return 1;
+}
 //_RUN_CODE_
     
 #ifdef TEST_PERFORMANCE_TEST_ENABLE
     TEST_LOG_SS(Info, Test::PerformanceMeasurerStorage::s_storage.Report(false, false));
+    Test::PerformanceMeasurerStorage::s_storage.SaveReport(argc, argv);
+    Test::PerformanceMeasurerStorage::s_storage.Clear();
 #endif
+    }
 
     return 0;
 }
@@ -27,6 +27,7 @@
 #include "Test/TestUtils.h"
 #include "Test/TestLog.h"
 #undef SIMD_SSE42_ENABLE
+#undef SIMD_AVX512BW_ENABLE
 #define SIMD_SSE42_ENABLE
 #include "Test/TestCrc32.h"
 //_INSERT_HEADERS_
@@ -45,6 +46,38 @@ bool AutoTest1()    {
             result = result && Crc32AutoTest(FUNC(Simd::Sse42::Crc32c), FUNC(SimdCrc32c));
 #endif 
 
+#if defined(SIMD_SSE42_ENABLE) && defined(SIMD_PCLMUL_ENABLE)
+        if(Simd::Sse42::PclmulEnable)
+        {
+            result = result && Crc32AutoTest(FUNC(Simd::Sse42::Crc32cInterleaved), FUNC(SimdCrc32c));
+            result = result && Crc32AutoTest(FUNC(Simd::Sse42::Crc32cFolded), FUNC(SimdCrc32c));
+        }
+#endif 
+
+#if defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_VPCLMULQDQ_ENABLE)
+        if(Simd::Avx512bw::VpclmulqdqEnable)
+            result = result && Crc32AutoTest(FUNC(Simd::Avx512bw::Crc32c), FUNC(SimdCrc32c));
+#endif 
+
+        std::vector<Func> funcs(1, FUNC(Simd::Base::Crc32c));
+#ifdef SIMD_SSE42_ENABLE
+        if(Simd::Sse42::Enable)
+            funcs.push_back(FUNC(Simd::Sse42::Crc32c));
+#endif 
+#if defined(SIMD_SSE42_ENABLE) && defined(SIMD_PCLMUL_ENABLE)
+        if(Simd::Sse42::PclmulEnable)
+        {
+            funcs.push_back(FUNC(Simd::Sse42::Crc32cInterleaved));
+            funcs.push_back(FUNC(Simd::Sse42::Crc32cFolded));
+        }
+#endif 
+#if defined(SIMD_AVX512BW_ENABLE) && defined(SIMD_VPCLMULQDQ_ENABLE)
+        if(Simd::Avx512bw::VpclmulqdqEnable)
+            funcs.push_back(FUNC(Simd::Avx512bw::Crc32c));
+#endif 
+        funcs.push_back(FUNC(SimdCrc32c));
+        result = result && Crc32cBandwidthTest(funcs);
+
         return result;
     }
 //_AUTO_TEST_		
@@ -54,6 +87,8 @@ bool AutoTest1()    {
 
 int main(int argc, char* argv[])
 {
+    for (Test::Sweep sweep(argc, argv); sweep.Next(); )
+    {
 
 //_TESTS_1
 
@@ -68,7 +103,10 @@ if(!result1)
     
 #ifdef TEST_PERFORMANCE_TEST_ENABLE
     TEST_LOG_SS(Info, Test::PerformanceMeasurerStorage::s_storage.Report(false, false));
+    Test::PerformanceMeasurerStorage::s_storage.SaveReport(argc, argv);
+    Test::PerformanceMeasurerStorage::s_storage.Clear();
 #endif
+    }
 
     return 0;
 }
@@ -0,0 +1,651 @@
+/*****************************************************************************
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02111, USA.
+ *****************************************************************************/
+
+/* AVX-512 versions of the forward and inverse transforms and dequant_scaling,
+ * needing AVX512F and AVX512BW.
+ *
+ * These are organised like the AVX2 versions in dct-avx2.cpp: each pass is a
+ * matrix product on pairs of inputs with _mm512_madd_epi16, bit-exact with the
+ * C reference. The 8x8 transforms, which would only fill half a vector per
+ * line, instead keep the whole block in registers and compute two lines (or
+ * two output rows) per instruction. */
+
+#include "common.h"
+#include "primitives.h"
+#include <immintrin.h> // AVX-512
+
+#define DCT8_SHIFT1   (2 + X265_DEPTH - 8)
+#define DCT8_SHIFT2   9
+
+#define DCT16_SHIFT1  (3 + X265_DEPTH - 8)
+#define DCT16_SHIFT2  10
+
+#define DCT32_SHIFT1  (4 + X265_DEPTH - 8)
+#define DCT32_SHIFT2  11
+
+#define IDCT_SHIFT1   7
+#define IDCT_SHIFT2   (12 - (X265_DEPTH - 8))
+
+using namespace X265_NS;
+
+/* tab_dctN_pairs[p][2 * k + i] = g_tN[k][2 * p + i]: the coefficients applied
+ * to the input pair (2p, 2p + 1) for output k of the forward transform.
+ * tab_idctN_pairs[p][2 * k + i] = g_tN[2 * p + i][k]: the same for the
+ * inverse transform. tab_dct8_cols[m][p] and tab_idct8_cols[m][p] repeat the
+ * pair of outputs 2m and 2m + 1 over the low and high halves of a vector. */
+ALIGN_VAR_64(static const int16_t, tab_dct8_pairs[4][16]) =
+{
+    {  64,  64,  89,  75,  83,  36,  75, -18,  64, -64,  50, -89,  36, -83,  18, -50 },
+    {  64,  64,  50,  18, -36, -83, -89, -50, -64,  64,  18,  75,  83, -36,  75, -89 },
+    {  64,  64, -18, -50, -83, -36,  50,  89,  64, -64, -75, -18, -36,  83,  89, -75 },
+    {  64,  64, -75, -89,  36,  83,  18, -75, -64,  64,  89, -50, -83,  36,  50, -18 }
+};
+
+ALIGN_VAR_64(static const int16_t, tab_idct8_pairs[4][16]) =
+{
+    {  64,  89,  64,  75,  64,  50,  64,  18,  64, -18,  64, -50,  64, -75,  64, -89 },
+    {  83,  75,  36, -18, -36, -89, -83, -50, -83,  50, -36,  89,  36,  18,  83, -75 },
+    {  64,  50, -64, -89, -64,  18,  64,  75,  64, -75, -64, -18, -64,  89,  64, -50 },
+    {  36,  18, -83, -50,  83,  75, -36, -89, -36,  89,  83, -75, -83,  50,  36, -18 }
+};
+
+ALIGN_VAR_64(static const int16_t, tab_dct16_pairs[8][32]) =
+{
+    {  64,  64,  90,  87,  89,  75,  87,  57,  83,  36,  80,   9,  75, -18,  70, -43,
+       64, -64,  57, -80,  50, -89,  43, -90,  36, -83,  25, -70,  18, -50,   9, -25 },
+    {  64,  64,  80,  70,  50,  18,   9, -43, -36, -83, -70, -87, -89, -50, -87,   9,
+      -64,  64, -25,  90,  18,  75,  57,  25,  83, -36,  90, -80,  75, -89,  43, -57 },
+    {  64,  64,  57,  43, -18, -50, -80, -90, -83, -36, -25,  57,  50,  89,  90,  25,
+       64, -64,  -9, -87, -75, -18, -87,  70, -36,  83,  43,   9,  89, -75,  70, -80 },
+    {  64,  64,  25,   9, -75, -89, -70, -25,  36,  83,  90,  43,  18, -75, -80, -57,
+      -64,  64,  43,  70,  89, -50,   9, -80, -83,  36, -57,  87,  50, -18,  87, -90 },
+    {  64,  64,  -9, -25, -89, -75,  25,  70,  83,  36, -43, -90, -75,  18,  57,  80,
+       64, -64, -70, -43, -50,  89,  80,  -9,  36, -83, -87,  57, -18,  50,  90, -87 },
+    {  64,  64, -43, -57, -50, -18,  90,  80, -36, -83, -57,  25,  89,  50, -25, -90,
+      -64,  64,  87,   9, -18, -75, -70,  87,  83, -36,  -9, -43, -75,  89,  80, -70 },
+    {  64,  64, -70, -80,  18,  50,  43,  -9, -83, -36,  87,  70, -50, -89,  -9,  87,
+       64, -64, -90,  25,  75,  18, -25, -57, -36,  83,  80, -90, -89,  75,  57, -43 },
+    {  64,  64, -87, -90,  75,  89, -57, -87,  36,  83,  -9, -80, -18,  75,  43, -70,
+      -64,  64,  80, -57, -89,  50,  90, -43, -83,  36,  70, -25, -50,  18,  25,  -9 }
+};
+
+ALIGN_VAR_64(static const int16_t, tab_idct16_pairs[8][32]) =
+{
+    {  64,  90,  64,  87,  64,  80,  64,  70,  64,  57,  64,  43,  64,  25,  64,   9,
+       64,  -9,  64, -25,  64, -43,  64, -57,  64, -70,  64, -80,  64, -87,  64, -90 },
+    {  89,  87,  75,  57,  50,   9,  18, -43, -18, -80, -50, -90, -75, -70, -89, -25,
+      -89,  25, -75,  70, -50,  90, -18,  80,  18,  43,  50,  -9,  75, -57,  89, -87 },
+    {  83,  80,  36,   9, -36, -70, -83, -87, -83, -25, -36,  57,  36,  90,  83,  43,
+       83, -43,  36, -90, -36, -57, -83,  25, -83,  87, -36,  70,  36,  -9,  83, -80 },
+    {  75,  70, -18, -43, -89, -87, -50,   9,  50,  90,  89,  25,  18, -80, -75, -57,
+      -75,  57,  18,  80,  89, -25,  50, -90, -50,  -9, -89,  87, -18,  43,  75, -70 },
+    {  64,  57, -64, -80, -64, -25,  64,  90,  64,  -9, -64, -87, -64,  43,  64,  70,
+       64, -70, -64, -43, -64,  87,  64,   9,  64, -90, -64,  25, -64,  80,  64, -57 },
+    {  50,  43, -89, -90,  18,  57,  75,  25, -75, -87, -18,  70,  89,   9, -50, -80,
+      -50,  80,  89,  -9, -18, -70, -75,  87,  75, -25,  18, -57, -89,  90,  50, -43 },
+    {  36,  25, -83, -70,  83,  90, -36, -80, -36,  43,  83,   9, -83, -57,  36,  87,
+       36, -87, -83,  57,  83,  -9, -36, -43, -36,  80,  83, -90, -83,  70,  36, -25 },
+    {  18,   9, -50, -25,  75,  43, -89, -57,  89,  70, -75, -80,  50,  87, -18, -90,
+      -18,  90,  50, -87, -75,  80,  89, -70, -89,  57,  75, -43, -50,  25,  18,  -9 }
+};
+
+ALIGN_VAR_64(static const int16_t, tab_dct32_pairs[16][64]) =
+{
+    {  64,  64,  90,  90,  90,  87,  90,  82,  89,  75,  88,  67,  87,  57,  85,  46,
+       83,  36,  82,  22,  80,   9,  78,  -4,  75, -18,  73, -31,  70, -43,  67, -54,
+       64, -64,  61, -73,  57, -80,  54, -85,  50, -89,  46, -90,  43, -90,  38, -88,
+       36, -83,  31, -78,  25, -70,  22, -61,  18, -50,  13, -38,   9, -25,   4, -13 },
+    {  64,  64,  88,  85,  80,  70,  67,  46,  50,  18,  31, -13,   9, -43, -13, -67,
+      -36, -83, -54, -90, -70, -87, -82, -73, -89, -50, -90, -22, -87,   9, -78,  38,
+      -64,  64, -46,  82, -25,  90,  -4,  88,  18,  75,  38,  54,  57,  25,  73,  -4,
+       83, -36,  90, -61,  90, -80,  85, -90,  75, -89,  61, -78,  43, -57,  22, -31 },
+    {  64,  64,  82,  78,  57,  43,  22,  -4, -18, -50, -54, -82, -80, -90, -90, -73,
+      -83, -36, -61,  13, -25,  57,  13,  85,  50,  89,  78,  67,  90,  25,  85, -22,
+       64, -64,  31, -88,  -9, -87, -46, -61, -75, -18, -90,  31, -87,  70, -67,  90,
+      -36,  83,   4,  54,  43,   9,  73, -38,  89, -75,  88, -90,  70, -80,  38, -46 },
+    {  64,  64,  73,  67,  25,   9, -31, -54, -75, -89, -90, -78, -70, -25, -22,  38,
+       36,  83,  78,  85,  90,  43,  67, -22,  18, -75, -38, -90, -80, -57, -90,   4,
+      -64,  64, -13,  90,  43,  70,  82,  13,  89, -50,  61, -88,   9, -80, -46, -31,
+      -83,  36, -88,  82, -57,  87,  -4,  46,  50, -18,  85, -73,  87, -90,  54, -61 },
+    {  64,  64,  61,  54,  -9, -25, -73, -85, -89, -75, -46,  -4,  25,  70,  82,  88,
+       83,  36,  31, -46, -43, -90, -88, -61, -75,  18, -13,  82,  57,  80,  90,  13,
+       64, -64,  -4, -90, -70, -43, -90,  38, -50,  89,  22,  67,  80,  -9,  85, -78,
+       36, -83, -38, -22, -87,  57, -78,  90, -18,  50,  54, -31,  90, -87,  67, -73 },
+    {  64,  64,  46,  38, -43, -57, -90, -88, -50, -18,  38,  73,  90,  80,  54,  -4,
+      -36, -83, -90, -67, -57,  25,  31,  90,  89,  50,  61, -46, -25, -90, -88, -31,
+      -64,  64,  22,  85,  87,   9,  67, -78, -18, -75, -85,  13, -70,  87,  13,  61,
+       83, -36,  73, -90,  -9, -43, -82,  54, -75,  89,   4,  22,  80, -70,  78, -82 },
+    {  64,  64,  31,  22, -70, -80, -78, -61,  18,  50,  90,  85,  43,  -9, -61, -90,
+      -83, -36,   4,  73,  87,  70,  54, -38, -50, -89, -88,  -4,  -9,  87,  82,  46,
+       64, -64, -38, -78, -90,  25, -22,  90,  75,  18,  73, -82, -25, -57, -90,  54,
+      -36,  83,  67, -13,  80, -90, -13, -31, -89,  75, -46,  67,  57, -43,  85, -88 },
+    {  64,  64,  13,   4, -87, -90, -38, -13,  75,  89,  61,  22, -57, -87, -78, -31,
+       36,  83,  88,  38,  -9, -80, -90, -46, -18,  75,  85,  54,  43, -70, -73, -61,
+      -64,  64,  54,  67,  80, -57, -31, -73, -89,  50,   4,  78,  90, -43,  22, -82,
+      -83,  36, -46,  85,  70, -25,  67, -88, -50,  18, -82,  90,  25,  -9,  90, -90 },
+    {  64,  64,  -4, -13, -90, -87,  13,  38,  89,  75, -22, -61, -87, -57,  31,  78,
+       83,  36, -38, -88, -80,  -9,  46,  90,  75, -18, -54, -85, -70,  43,  61,  73,
+       64, -64, -67, -54, -57,  80,  73,  31,  50, -89, -78,  -4, -43,  90,  82, -22,
+       36, -83, -85,  46, -25,  70,  88, -67,  18, -50, -90,  82,  -9,  25,  90, -90 },
+    {  64,  64, -22, -31, -80, -70,  61,  78,  50,  18, -85, -90,  -9,  43,  90,  61,
+      -36, -83, -73,  -4,  70,  87,  38, -54, -89, -50,   4,  88,  87,  -9, -46, -82,
+      -64,  64,  78,  38,  25, -90, -90,  22,  18,  75,  82, -73, -57, -25, -54,  90,
+       83, -36,  13, -67, -90,  80,  31,  13,  75, -89, -67,  46, -43,  57,  88, -85 },
+    {  64,  64, -38, -46, -57, -43,  88,  90, -18, -50, -73, -38,  80,  90,   4, -54,
+      -83, -36,  67,  90,  25, -57, -90, -31,  50,  89,  46, -61, -90, -25,  31,  88,
+       64, -64, -85, -22,   9,  87,  78, -67, -75, -18, -13,  85,  87, -70, -61, -13,
+      -36,  83,  90, -73, -43,  -9, -54,  82,  89, -75, -22,  -4, -70,  80,  82, -78 },
+    {  64,  64, -54, -61, -25,  -9,  85,  73, -75, -89,   4,  46,  70,  25, -88, -82,
+       36,  83,  46, -31, -90, -43,  61,  88,  18, -75, -82,  13,  80,  57, -13, -90,
+      -64,  64,  90,   4, -43, -70, -38,  90,  89, -50, -67, -22,  -9,  80,  78, -85,
+      -83,  36,  22,  38,  57, -87, -90,  78,  50, -18,  31, -54, -87,  90,  73, -67 },
+    {  64,  64, -67, -73,   9,  25,  54,  31, -89, -75,  78,  90, -25, -70, -38,  22,
+       83,  36, -85, -78,  43,  90,  22, -67, -75,  18,  90,  38, -57, -80,  -4,  90,
+       64, -64, -90,  13,  70,  43, -13, -82, -50,  89,  88, -61, -80,   9,  31,  46,
+       36, -83, -82,  88,  87, -57, -46,   4, -18,  50,  73, -85, -90,  87,  61, -54 },
+    {  64,  64, -78, -82,  43,  57,   4, -22, -50, -18,  82,  54, -90, -80,  73,  90,
+      -36, -83, -13,  61,  57, -25, -85, -13,  89,  50, -67, -78,  25,  90,  22, -85,
+      -64,  64,  88, -31, -87,  -9,  61,  46, -18, -75, -31,  90,  70, -87, -90,  67,
+       83, -36, -54,  -4,   9,  43,  38, -73, -75,  89,  90, -88, -80,  70,  46, -38 },
+    {  64,  64, -85, -88,  70,  80, -46, -67,  18,  50,  13, -31, -43,   9,  67,  13,
+      -83, -36,  90,  54, -87, -70,  73,  82, -50, -89,  22,  90,   9, -87, -38,  78,
+       64, -64, -82,  46,  90, -25, -88,   4,  75,  18, -54, -38,  25,  57,   4, -73,
+      -36,  83,  61, -90, -80,  90,  90, -85, -89,  75,  78, -61, -57,  43,  31, -22 },
+    {  64,  64, -90, -90,  87,  90, -82, -90,  75,  89, -67, -88,  57,  87, -46, -85,
+       36,  83, -22, -82,   9,  80,   4, -78, -18,  75,  31, -73, -43,  70,  54, -67,
+      -64,  64,  73, -61, -80,  57,  85, -54, -89,  50,  90, -46, -90,  43,  88, -38,
+      -83,  36,  78, -31, -70,  25,  61, -22, -50,  18,  38, -13, -25,   9,  13,  -4 }
+};
+
+ALIGN_VAR_64(static const int16_t, tab_idct32_pairs[16][64]) =
+{
+    {  64,  90,  64,  90,  64,  88,  64,  85,  64,  82,  64,  78,  64,  73,  64,  67,
+       64,  61,  64,  54,  64,  46,  64,  38,  64,  31,  64,  22,  64,  13,  64,   4,
+       64,  -4,  64, -13,  64, -22,  64, -31,  64, -38,  64, -46,  64, -54,  64, -61,
+       64, -67,  64, -73,  64, -78,  64, -82,  64, -85,  64, -88,  64, -90,  64, -90 },
+    {  90,  90,  87,  82,  80,  67,  70,  46,  57,  22,  43,  -4,  25, -31,   9, -54,
+       -9, -73, -25, -85, -43, -90, -57, -88, -70, -78, -80, -61, -87, -38, -90, -13,
+      -90,  13, -87,  38, -80,  61, -70,  78, -57,  88, -43,  90, -25,  85,  -9,  73,
+        9,  54,  25,  31,  43,   4,  57, -22,  70, -46,  80, -67,  87, -82,  90, -90 },
+    {  89,  88,  75,  67,  50,  31,  18, -13, -18, -54, -50, -82, -75, -90, -89, -78,
+      -89, -46, -75,  -4, -50,  38, -18,  73,  18,  90,  50,  85,  75,  61,  89,  22,
+       89, -22,  75, -61,  50, -85,  18, -90, -18, -73, -50, -38, -75,   4, -89,  46,
+      -89,  78, -75,  90, -50,  82, -18,  54,  18,  13,  50, -31,  75, -67,  89, -88 },
+    {  87,  85,  57,  46,   9, -13, -43, -67, -80, -90, -90, -73, -70, -22, -25,  38,
+       25,  82,  70,  88,  90,  54,  80,  -4,  43, -61,  -9, -90, -57, -78, -87, -31,
+      -87,  31, -57,  78,  -9,  90,  43,  61,  80,   4,  90, -54,  70, -88,  25, -82,
+      -25, -38, -70,  22, -90,  73, -80,  90, -43,  67,   9,  13,  57, -46,  87, -85 },
+    {  83,  82,  36,  22, -36, -54, -83, -90, -83, -61, -36,  13,  36,  78,  83,  85,
+       83,  31,  36, -46, -36, -90, -83, -67, -83,   4, -36,  73,  36,  88,  83,  38,
+       83, -38,  36, -88, -36, -73, -83,  -4, -83,  67, -36,  90,  36,  46,  83, -31,
+       83, -85,  36, -78, -36, -13, -83,  61, -83,  90, -36,  54,  36, -22,  83, -82 },
+    {  80,  78,   9,  -4, -70, -82, -87, -73, -25,  13,  57,  85,  90,  67,  43, -22,
+      -43, -88, -90, -61, -57,  31,  25,  90,  87,  54,  70, -38,  -9, -90, -80, -46,
+      -80,  46,  -9,  90,  70,  38,  87, -54,  25, -90, -57, -31, -90,  61, -43,  88,
+       43,  22,  90, -67,  57, -85, -25, -13, -87,  73, -70,  82,   9,   4,  80, -78 },
+    {  75,  73, -18, -31, -89, -90, -50, -22,  50,  78,  89,  67,  18, -38, -75, -90,
+      -75, -13,  18,  82,  89,  61,  50, -46, -50, -88, -89,  -4, -18,  85,  75,  54,
+       75, -54, -18, -85, -89,   4, -50,  88,  50,  46,  89, -61,  18, -82, -75,  13,
+      -75,  90,  18,  38,  89, -67,  50, -78, -50,  22, -89,  90, -18,  31,  75, -73 },
+    {  70,  67, -43, -54, -87, -78,   9,  38,  90,  85,  25, -22, -80, -90, -57,   4,
+       57,  90,  80,  13, -25, -88, -90, -31,  -9,  82,  87,  46,  43, -73, -70, -61,
+      -70,  61,  43,  73,  87, -46,  -9, -82, -90,  31, -25,  88,  80, -13,  57, -90,
+      -57,  -4, -80,  90,  25,  22,  90, -85,   9, -38, -87,  78, -43,  54,  70, -67 },
+    {  64,  61, -64, -73, -64, -46,  64,  82,  64,  31, -64, -88, -64, -13,  64,  90,
+       64,  -4, -64, -90, -64,  22,  64,  85,  64, -38, -64, -78, -64,  54,  64,  67,
+       64, -67, -64, -54, -64,  78,  64,  38,  64, -85, -64, -22, -64,  90,  64,   4,
+       64, -90, -64,  13, -64,  88,  64, -31,  64, -82, -64,  46, -64,  73,  64, -61 },
+    {  57,  54, -80, -85, -25,  -4,  90,  88,  -9, -46, -87, -61,  43,  82,  70,  13,
+      -70, -90, -43,  38,  87,  67,   9, -78, -90, -22,  25,  90,  80, -31, -57, -73,
+      -57,  73,  80,  31,  25, -90, -90,  22,   9,  78,  87, -67, -43, -38, -70,  90,
+       70, -13,  43, -82, -87,  61,  -9,  46,  90, -88, -25,   4, -80,  85,  57, -54 },
+    {  50,  46, -89, -90,  18,  38,  75,  54, -75, -90, -18,  31,  89,  61, -50, -88,
+      -50,  22,  89,  67, -18, -85, -75,  13,  75,  73,  18, -82, -89,   4,  50,  78,
+       50, -78, -89,  -4,  18,  82,  75, -73, -75, -13, -18,  85,  89, -67, -50, -22,
+      -50,  88,  89, -61, -18, -31, -75,  90,  75, -54,  18, -38, -89,  90,  50, -46 },
+    {  43,  38, -90, -88,  57,  73,  25,  -4, -87, -67,  70,  90,   9, -46, -80, -31,
+       80,  85,  -9, -78, -70,  13,  87,  61, -25, -90, -57,  54,  90,  22, -43, -82,
+      -43,  82,  90, -22, -57, -54, -25,  90,  87, -61, -70, -13,  -9,  78,  80, -85,
+      -80,  31,   9,  46,  70, -90, -87,  67,  25,   4,  57, -73, -90,  88,  43, -38 },
+    {  36,  31, -83, -78,  83,  90, -36, -61, -36,   4,  83,  54, -83, -88,  36,  82,
+       36, -38, -83, -22,  83,  73, -36, -90, -36,  67,  83, -13, -83, -46,  36,  85,
+       36, -85, -83,  46,  83,  13, -36, -67, -36,  90,  83, -73, -83,  22,  36,  38,
+       36, -82, -83,  88,  83, -54, -36,  -4, -36,  61,  83, -90, -83,  78,  36, -31 },
+    {  25,  22, -70, -61,  90,  85, -80, -90,  43,  73,   9, -38, -57,  -4,  87,  46,
+      -87, -78,  57,  90,  -9, -82, -43,  54,  80, -13, -90, -31,  70,  67, -25, -88,
+      -25,  88,  70, -67, -90,  31,  80,  13, -43, -54,  -9,  82,  57, -90, -87,  78,
+       87, -46, -57,   4,   9,  38,  43, -73, -80,  90,  90, -85, -70,  61,  25, -22 },
+    {  18,  13, -50, -38,  75,  61, -89, -78,  89,  88, -75, -90,  50,  85, -18, -73,
+      -18,  54,  50, -31, -75,   4,  89,  22, -89, -46,  75,  67, -50, -82,  18,  90,
+       18, -90, -50,  82,  75, -67, -89,  46,  89, -22, -75,  -4,  50,  31, -18, -54,
+      -18,  73,  50, -85, -75,  90,  89, -88, -89,  78,  75, -61, -50,  38,  18, -13 },
+    {   9,   4, -25, -13,  43,  22, -57, -31,  70,  38, -80, -46,  87,  54, -90, -61,
+       90,  67, -87, -73,  80,  78, -70, -82,  57,  85, -43, -88,  25,  90,  -9, -90,
+       -9,  90,  25, -90, -43,  88,  57, -85, -70,  82,  80, -78, -87,  73,  90, -67,
+      -90,  61,  87, -54, -80,  46,  70, -38, -57,  31,  43, -22, -25,  13,   9,  -4 }
+};
+
+ALIGN_VAR_64(static const int16_t, tab_dct8_cols[4][4][32]) =
+{
+    {
+        {  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,
+           89,  75,  89,  75,  89,  75,  89,  75,  89,  75,  89,  75,  89,  75,  89,  75 },
+        {  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,
+           50,  18,  50,  18,  50,  18,  50,  18,  50,  18,  50,  18,  50,  18,  50,  18 },
+        {  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,
+          -18, -50, -18, -50, -18, -50, -18, -50, -18, -50, -18, -50, -18, -50, -18, -50 },
+        {  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,  64,
+          -75, -89, -75, -89, -75, -89, -75, -89, -75, -89, -75, -89, -75, -89, -75, -89 }
+    },
+    {
+        {  83,  36,  83,  36,  83,  36,  83,  36,  83,  36,  83,  36,  83,  36,  83,  36,
+           75, -18,  75, -18,  75, -18,  75, -18,  75, -18,  75, -18,  75, -18,  75, -18 },
+        { -36, -83, -36, -83, -36, -83, -36, -83, -36, -83, -36, -83, -36, -83, -36, -83,
+          -89, -50, -89, -50, -89, -50, -89, -50, -89, -50, -89, -50, -89, -50, -89, -50 },
+        { -83, -36, -83, -36, -83, -36, -83, -36, -83, -36, -83, -36, -83, -36, -83, -36,
+           50,  89,  50,  89,  50,  89,  50,  89,  50,  89,  50,  89,  50,  89,  50,  89 },
+        {  36,  83,  36,  83,  36,  83,  36,  83,  36,  83,  36,  83,  36,  83,  36,  83,
+           18, -75,  18, -75,  18, -75,  18, -75,  18, -75,  18, -75,  18, -75,  18, -75 }
+    },
+    {
+        {  64, -64,  64, -64,  64, -64,  64, -64,  64, -64,  64, -64,  64, -64,  64, -64,
+           50, -89,  50, -89,  50, -89,  50, -89,  50, -89,  50, -89,  50, -89,  50, -89 },
+        { -64,  64, -64,  64, -64,  64, -64,  64, -64,  64, -64,  64, -64,  64, -64,  64,
+           18,  75,  18,  75,  18,  75,  18,  75,  18,  75,  18,  75,  18,  75,  18,  75 },
+        {  64, -64,  64, -64,  64, -64,  64, -64,  64, -64,  64, -64,  64, -64,  64, -64,
+          -75, -18, -75, -18, -75, -18, -75, -18, -75, -18, -75, -18, -75, -18, -75, -18 },
+        { -64,  64, -64,  64, -64,  64, -64,  64, -64,  64, -64,  64, -64,  64, -64,  64,
+           89, -50,  89, -50,  89, -50,  89, -50,  89, -50,  89, -50,  89, -50,  89, -50 }
+    },
+    {
+        {  36, -83,  36, -83,  36, -83,  36, -83,  36, -83,  36, -83,  36, -83,  36, -83,
+           18, -50,  18, -50,  18, -50,  18, -50,  18, -50,  18, -50,  18, -50,  18, -50 },
+        {  83, -36,  83, -36,  83, -36,  83, -36,  83, -36,  83, -36,  83, -36,  83, -36,
+           75, -89,  75, -89,  75, -89,  75, -89,  75, -89,  75, -89,  75, -89,  75, -89 },
+        { -36,  83, -36,  83, -36,  83, -36,  83, -36,  83, -36,  83, -36,  83, -36,  83,
+           89, -75,  89, -75,  89, -75,  89, -75,  89, -75,  89, -75,  89, -75,  89, -75 },
+        { -83,  36, -83,  36, -83,  36, -83,  36, -83,  36, -83,  36, -83,  36, -83,  36,
+           50, -18,  50, -18,  50, -18,  50, -18,  50, -18,  50, -18,  50, -18,  50, -18 }
+    }
+};
+
+ALIGN_VAR_64(static const int16_t, tab_idct8_cols[4][4][32]) =
+{
+    {
+        {  64,  89,  64,  89,  64,  89,  64,  89,  64,  89,  64,  89,  64,  89,  64,  89,
+           64,  75,  64,  75,  64,  75,  64,  75,  64,  75,  64,  75,  64,  75,  64,  75 },
+        {  83,  75,  83,  75,  83,  75,  83,  75,  83,  75,  83,  75,  83,  75,  83,  75,
+           36, -18,  36, -18,  36, -18,  36, -18,  36, -18,  36, -18,  36, -18,  36, -18 },
+        {  64,  50,  64,  50,  64,  50,  64,  50,  64,  50,  64,  50,  64,  50,  64,  50,
+          -64, -89, -64, -89, -64, -89, -64, -89, -64, -89, -64, -89, -64, -89, -64, -89 },
+        {  36,  18,  36,  18,  36,  18,  36,  18,  36,  18,  36,  18,  36,  18,  36,  18,
+          -83, -50, -83, -50, -83, -50, -83, -50, -83, -50, -83, -50, -83, -50, -83, -50 }
+    },
+    {
+        {  64,  50,  64,  50,  64,  50,  64,  50,  64,  50,  64,  50,  64,  50,  64,  50,
+           64,  18,  64,  18,  64,  18,  64,  18,  64,  18,  64,  18,  64,  18,  64,  18 },
+        { -36, -89, -36, -89, -36, -89, -36, -89, -36, -89, -36, -89, -36, -89, -36, -89,
+          -83, -50, -83, -50, -83, -50, -83, -50, -83, -50, -83, -50, -83, -50, -83, -50 },
+        { -64,  18, -64,  18, -64,  18, -64,  18, -64,  18, -64,  18, -64,  18, -64,  18,
+           64,  75,  64,  75,  64,  75,  64,  75,  64,  75,  64,  75,  64,  75,  64,  75 },
+        {  83,  75,  83,  75,  83,  75,  83,  75,  83,  75,  83,  75,  83,  75,  83,  75,
+          -36, -89, -36, -89, -36, -89, -36, -89, -36, -89, -36, -89, -36, -89, -36, -89 }
+    },
+    {
+        {  64, -18,  64, -18,  64, -18,  64, -18,  64, -18,  64, -18,  64, -18,  64, -18,
+           64, -50,  64, -50,  64, -50,  64, -50,  64, -50,  64, -50,  64, -50,  64, -50 },
+        { -83,  50, -83,  50, -83,  50, -83,  50, -83,  50, -83,  50, -83,  50, -83,  50,
+          -36,  89, -36,  89, -36,  89, -36,  89, -36,  89, -36,  89, -36,  89, -36,  89 },
+        {  64, -75,  64, -75,  64, -75,  64, -75,  64, -75,  64, -75,  64, -75,  64, -75,
+          -64, -18, -64, -18, -64, -18, -64, -18, -64, -18, -64, -18, -64, -18, -64, -18 },
+        { -36,  89, -36,  89, -36,  89, -36,  89, -36,  89, -36,  89, -36,  89, -36,  89,
+           83, -75,  83, -75,  83, -75,  83, -75,  83, -75,  83, -75,  83, -75,  83, -75 }
+    },
+    {
+        {  64, -75,  64, -75,  64, -75,  64, -75,  64, -75,  64, -75,  64, -75,  64, -75,
+           64, -89,  64, -89,  64, -89,  64, -89,  64, -89,  64, -89,  64, -89,  64, -89 },
+        {  36,  18,  36,  18,  36,  18,  36,  18,  36,  18,  36,  18,  36,  18,  36,  18,
+           83, -75,  83, -75,  83, -75,  83, -75,  83, -75,  83, -75,  83, -75,  83, -75 },
+        { -64,  89, -64,  89, -64,  89, -64,  89, -64,  89, -64,  89, -64,  89, -64,  89,
+           64, -50,  64, -50,  64, -50,  64, -50,  64, -50,  64, -50,  64, -50,  64, -50 },
+        { -83,  50, -83,  50, -83,  50, -83,  50, -83,  50, -83,  50, -83,  50, -83,  50,
+           36, -18,  36, -18,  36, -18,  36, -18,  36, -18,  36, -18,  36, -18,  36, -18 }
+    }
+};
+
+/* Interleaves the two halves of each lane of _mm512_packs_epi32(a, b) into
+ * (a[k], b[k]) pairs. */
+ALIGN_VAR_64(static const int8_t, tab_pack_pairs[64]) =
+{
+    0, 1, 8, 9, 2, 3, 10, 11, 4, 5, 12, 13, 6, 7, 14, 15,
+    0, 1, 8, 9, 2, 3, 10, 11, 4, 5, 12, 13, 6, 7, 14, 15,
+    0, 1, 8, 9, 2, 3, 10, 11, 4, 5, 12, 13, 6, 7, 14, 15,
+    0, 1, 8, 9, 2, 3, 10, 11, 4, 5, 12, 13, 6, 7, 14, 15
+};
+
+/* Puts the 64-bit quarters of each lane of _mm512_packs_epi32(a, b) back in order. */
+ALIGN_VAR_64(static const int64_t, tab_pack_order[8]) = { 0, 2, 4, 6, 1, 3, 5, 7 };
+
+/* Interleaves the 16-bit samples of two 256-bit lines a (low) and b (high). */
+ALIGN_VAR_64(static const int16_t, tab_interleave[32]) =
+{
+    0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23,
+    8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31
+};
+
+static inline int32_t load_pair(const int16_t *p)
+{
+    int32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline __m512i round_shift(__m512i a, int shift)
+{
+    return _mm512_srai_epi32(_mm512_add_epi32(a, _mm512_set1_epi32(1 << (shift - 1))), shift);
+}
+
+/* Rounds and shifts 2 x 16 sums and saturates them to 32 int16, in order. */
+static inline __m512i round_pack(__m512i a, __m512i b, int shift)
+{
+    __m512i r = _mm512_packs_epi32(round_shift(a, shift), round_shift(b, shift));
+    return _mm512_permutexvar_epi64(_mm512_load_si512(tab_pack_order), r);
+}
+
+/* acc[c] = the sums for outputs 16c..16c+15 of one line of N samples. */
+template<int N>
+static inline void line_products(const int16_t *line, const int16_t (*tab)[2 * N], __m512i *acc)
+{
+    for (int c = 0; c < N / 16; c++)
+        acc[c] = _mm512_setzero_si512();
+    for (int p = 0; p < N / 2; p++)
+    {
+        const __m512i x = _mm512_set1_epi32(load_pair(line + 2 * p));
+        for (int c = 0; c < N / 16; c++)
+            acc[c] = _mm512_add_epi32(acc[c], _mm512_madd_epi16(x, _mm512_load_si512(&tab[p][32 * c])));
+    }
+}
+
+/* acc[c] = the sums for columns 16c..16c+15 of output k, from pairs[p][j]
+ * which holds the 16-bit pair (line 2p, line 2p + 1) of column j. */
+template<int N>
+static inline void pair_products(const int32_t *pairs, const int16_t (*tab)[2 * N], int k, __m512i *acc)
+{
+    for (int c = 0; c < N / 16; c++)
+        acc[c] = _mm512_setzero_si512();
+    for (int p = 0; p < N / 2; p++)
+    {
+        const __m512i coef = _mm512_set1_epi32(load_pair(&tab[p][2 * k]));
+        for (int c = 0; c < N / 16; c++)
+            acc[c] = _mm512_add_epi32(acc[c], _mm512_madd_epi16(_mm512_load_si512(pairs + p * N + 16 * c), coef));
+    }
+}
+
+/* Column pass: output rows of N samples, stored contiguously to dst. Blocks of
+ * 16 are done two rows at a time so every store is a full vector. */
+template<int N>
+static inline void pass_cols(const int32_t *pairs, int16_t *dst, const int16_t (*tab)[2 * N], int shift)
+{
+    const int K = N >= 32 ? 1 : 2;
+
+    for (int k = 0; k < N; k += K)
+    {
+        __m512i acc[K * N / 16];
+        for (int i = 0; i < K; i++)
+            pair_products<N>(pairs, tab, k + i, acc + i * N / 16);
+        for (int c = 0; c < K * N / 16; c += 2)
+            _mm512_storeu_si512(dst + k * N + 16 * c, round_pack(acc[c], acc[c + 1], shift));
+    }
+}
+
+/* Forward transform of lines 2p and 2p + 1 of the block, kept as pairs for
+ * the column pass. */
+template<int N>
+static inline void dct_rows(const int16_t *src, intptr_t stride, int32_t *pairs, const int16_t (*tab)[2 * N], int shift)
+{
+    const __m512i shuf = _mm512_load_si512(tab_pack_pairs);
+
+    for (int p = 0; p < N / 2; p++)
+    {
+        __m512i a[N / 16], b[N / 16];
+        line_products<N>(src + 2 * p * stride, tab, a);
+        line_products<N>(src + (2 * p + 1) * stride, tab, b);
+        for (int c = 0; c < N / 16; c++)
+        {
+            __m512i r = _mm512_packs_epi32(round_shift(a[c], shift), round_shift(b[c], shift));
+            _mm512_store_si512(pairs + p * N + 16 * c, _mm512_shuffle_epi8(r, shuf));
+        }
+    }
+}
+
+/* Pairs up rows 2p and 2p + 1 of the coefficients for the inverse column pass. */
+template<int N>
+static inline void idct_pairs(const int16_t *src, int32_t *pairs)
+{
+    const __m512i idx = _mm512_load_si512(tab_interleave);
+
+    for (int p = 0; p < N / 2; p++)
+    {
+        for (int c = 0; c < N / 16; c++)
+        {
+            __m256i a = _mm256_loadu_si256((const __m256i*)(src + 2 * p * N + 16 * c));
+            __m256i b = _mm256_loadu_si256((const __m256i*)(src + (2 * p + 1) * N + 16 * c));
+            __m512i ab = _mm512_inserti64x4(_mm512_castsi256_si512(a), b, 1);
+            _mm512_store_si512(pairs + p * N + 16 * c, _mm512_permutexvar_epi16(idx, ab));
+        }
+    }
+}
+
+/* Inverse transform of the lines of tmp, stored with the destination stride. */
+template<int N>
+static inline void idct_rows(const int16_t *tmp, int16_t *dst, intptr_t stride, const int16_t (*tab)[2 * N], int shift)
+{
+    const int K = N >= 32 ? 1 : 2;
+
+    for (int j = 0; j < N; j += K)
+    {
+        __m512i acc[K * N / 16];
+        for (int i = 0; i < K; i++)
+            line_products<N>(tmp + (j + i) * N, tab, acc + i * N / 16);
+        for (int c = 0; c < K * N / 16; c += 2)
+        {
+            __m512i r = round_pack(acc[c], acc[c + 1], shift);
+            if (N >= 32)
+                _mm512_storeu_si512(dst + j * stride + 16 * c, r);
+            else
+            {
+                _mm256_storeu_si256((__m256i*)(dst + j * stride), _mm512_castsi512_si256(r));
+                _mm256_storeu_si256((__m256i*)(dst + (j + 1) * stride), _mm512_extracti64x4_epi64(r, 1));
+            }
+        }
+    }
+}
+
+template<int N>
+static inline void dct(const int16_t *src, int16_t *dst, intptr_t stride, const int16_t (*tab)[2 * N], int shift1, int shift2)
+{
+    ALIGN_VAR_64(int32_t, pairs[N / 2 * N]);
+
+    dct_rows<N>(src, stride, pairs, tab, shift1);
+    pass_cols<N>(pairs, dst, tab, shift2);
+}
+
+template<int N>
+static inline void idct(const int16_t *src, int16_t *dst, intptr_t stride, const int16_t (*tab)[2 * N])
+{
+    ALIGN_VAR_64(int32_t, pairs[N / 2 * N]);
+    ALIGN_VAR_64(int16_t, tmp[N * N]);
+
+    idct_pairs<N>(src, pairs);
+    pass_cols<N>(pairs, tmp, tab, IDCT_SHIFT1);
+    idct_rows<N>(tmp, dst, stride, tab, IDCT_SHIFT2);
+}
+
+/* Loads four lines of 8 samples into one vector. */
+static inline __m512i load_lines8(const int16_t *src, intptr_t stride)
+{
+    __m512i r = _mm512_castsi128_si512(_mm_loadu_si128((const __m128i*)src));
+    r = _mm512_inserti32x4(r, _mm_loadu_si128((const __m128i*)(src + stride)), 1);
+    r = _mm512_inserti32x4(r, _mm_loadu_si128((const __m128i*)(src + 2 * stride)), 2);
+    return _mm512_inserti32x4(r, _mm_loadu_si128((const __m128i*)(src + 3 * stride)), 3);
+}
+
+/* Broadcasts pair q of line l to the low half and of line l + 1 to the high
+ * half, out of four lines of 8 samples. */
+static inline __m512i line_pairs8(__m512i lines, int l, int q)
+{
+    const __m512i idx = _mm512_inserti64x4(_mm512_set1_epi32(4 * l + q), _mm256_set1_epi32(4 * (l + 1) + q), 1);
+    return _mm512_permutexvar_epi32(idx, lines);
+}
+
+/* Row pass of an 8x8 block, lines 2m and 2m + 1 in the two halves of a vector:
+ * returns the results of lines 2m and 2m + 1 as 16-bit pairs. */
+static inline __m256i rows8(__m512i lines, int l, const int16_t (*tab)[16], int shift)
+{
+    __m512i acc = _mm512_setzero_si512();
+    for (int q = 0; q < 4; q++)
+    {
+        const __m512i coef = _mm512_broadcast_i64x4(_mm256_load_si256((const __m256i*)tab[q]));
+        acc = _mm512_add_epi32(acc, _mm512_madd_epi16(line_pairs8(lines, l, q), coef));
+    }
+    __m256i r = _mm512_cvtsepi32_epi16(round_shift(acc, shift));
+    __m128i a = _mm256_castsi256_si128(r);
+    __m128i b = _mm256_extracti128_si256(r, 1);
+    return _mm256_set_m128i(_mm_unpackhi_epi16(a, b), _mm_unpacklo_epi16(a, b));
+}
+
+/* Column pass of an 8x8 block: output rows 2m and 2m + 1 from the pairs. */
+static inline __m256i cols8(const __m256i *pairs, const int16_t (*tab)[32], int shift)
+{
+    __m512i acc = _mm512_setzero_si512();
+    for (int p = 0; p < 4; p++)
+        acc = _mm512_add_epi32(acc, _mm512_madd_epi16(_mm512_broadcast_i64x4(pairs[p]), _mm512_load_si512(tab[p])));
+    return _mm512_cvtsepi32_epi16(round_shift(acc, shift));
+}
+
+void avx512_dct8(const int16_t * __restrict__ src, int16_t * __restrict__ dst, intptr_t stride)
+{
+    const __m512i lines0 = load_lines8(src, stride);
+    const __m512i lines1 = load_lines8(src + 4 * stride, stride);
+    __m256i pairs[4];
+
+    pairs[0] = rows8(lines0, 0, tab_dct8_pairs, DCT8_SHIFT1);
+    pairs[1] = rows8(lines0, 2, tab_dct8_pairs, DCT8_SHIFT1);
+    pairs[2] = rows8(lines1, 0, tab_dct8_pairs, DCT8_SHIFT1);
+    pairs[3] = rows8(lines1, 2, tab_dct8_pairs, DCT8_SHIFT1);
+
+    for (int m = 0; m < 4; m++)
+        _mm256_storeu_si256((__m256i*)(dst + 16 * m), cols8(pairs, tab_dct8_cols[m], DCT8_SHIFT2));
+}
+
+void avx512_dct16(const int16_t * __restrict__ src, int16_t * __restrict__ dst, intptr_t stride)
+{
+    dct<16>(src, dst, stride, tab_dct16_pairs, DCT16_SHIFT1, DCT16_SHIFT2);
+}
+
+void avx512_dct32(const int16_t * __restrict__ src, int16_t * __restrict__ dst, intptr_t stride)
+{
+    dct<32>(src, dst, stride, tab_dct32_pairs, DCT32_SHIFT1, DCT32_SHIFT2);
+}
+
+void avx512_idct8(const int16_t * __restrict__ src, int16_t * __restrict__ dst, intptr_t stride)
+{
+    __m256i pairs[4], tmp[4];
+
+    for (int p = 0; p < 4; p++)
+    {
+        __m128i a = _mm_loadu_si128((const __m128i*)(src + 16 * p));
+        __m128i b = _mm_loadu_si128((const __m128i*)(src + 16 * p + 8));
+        pairs[p] = _mm256_set_m128i(_mm_unpackhi_epi16(a, b), _mm_unpacklo_epi16(a, b));
+    }
+    for (int m = 0; m < 4; m++)
+        tmp[m] = cols8(pairs, tab_idct8_cols[m], IDCT_SHIFT1);
+
+    const __m512i lines0 = _mm512_inserti64x4(_mm512_castsi256_si512(tmp[0]), tmp[1], 1);
+    const __m512i lines1 = _mm512_inserti64x4(_mm512_castsi256_si512(tmp[2]), tmp[3], 1);
+
+    for (int m = 0; m < 4; m++)
+    {
+        __m512i acc = _mm512_setzero_si512();
+        for (int q = 0; q < 4; q++)
+        {
+            const __m512i coef = _mm512_broadcast_i64x4(_mm256_load_si256((const __m256i*)tab_idct8_pairs[q]));
+            acc = _mm512_add_epi32(acc, _mm512_madd_epi16(line_pairs8(m < 2 ? lines0 : lines1, 2 * (m & 1), q), coef));
+        }
+        __m256i r = _mm512_cvtsepi32_epi16(round_shift(acc, IDCT_SHIFT2));
+        _mm_storeu_si128((__m128i*)(dst + 2 * m * stride), _mm256_castsi256_si128(r));
+        _mm_storeu_si128((__m128i*)(dst + (2 * m + 1) * stride), _mm256_extracti128_si256(r, 1));
+    }
+}
+
+void avx512_idct16(const int16_t * __restrict__ src, int16_t * __restrict__ dst, intptr_t stride)
+{
+    idct<16>(src, dst, stride, tab_idct16_pairs);
+}
+
+void avx512_idct32(const int16_t * __restrict__ src, int16_t * __restrict__ dst, intptr_t stride)
+{
+    idct<32>(src, dst, stride, tab_idct32_pairs);
+}
+
+void avx512_dequant_scaling(const int16_t * __restrict__ quantCoef, const int32_t * __restrict__ deQuantCoef, int16_t * __restrict__ coef, int num, int per, int shift)
+{
+    X265_CHECK(num <= 32 * 32, "dequant num too large\n");
+    X265_CHECK((num % 16) == 0, "dequant num not multiple of 16\n");
+
+    shift += 4;
+
+    if (shift > per)
+    {
+        const __m512i add = _mm512_set1_epi32(1 << (shift - per - 1));
+        const __m128i count = _mm_cvtsi32_si128(shift - per);
+
+        for (int n = 0; n < num; n += 16)
+        {
+            __m512i q = _mm512_cvtepi16_epi32(_mm256_loadu_si256((const __m256i*)(quantCoef + n)));
+            q = _mm512_mullo_epi32(q, _mm512_loadu_si512(deQuantCoef + n));
+            q = _mm512_sra_epi32(_mm512_add_epi32(q, add), count);
+            _mm256_storeu_si256((__m256i*)(coef + n), _mm512_cvtsepi32_epi16(q));
+        }
+    }
+    else
+    {
+        const __m512i lo = _mm512_set1_epi32(-32768);
+        const __m512i hi = _mm512_set1_epi32(32767);
+        const __m128i count = _mm_cvtsi32_si128(per - shift);
+
+        for (int n = 0; n < num; n += 16)
+        {
+            __m512i q = _mm512_cvtepi16_epi32(_mm256_loadu_si256((const __m256i*)(quantCoef + n)));
+            q = _mm512_mullo_epi32(q, _mm512_loadu_si512(deQuantCoef + n));
+            q = _mm512_sll_epi32(_mm512_min_epi32(_mm512_max_epi32(q, lo), hi), count);
+            _mm256_storeu_si256((__m256i*)(coef + n), _mm512_cvtsepi32_epi16(q));
+        }
+    }
+}
+
+namespace X265_NS {
+void setupIntrinsicDCT_avx512(EncoderPrimitives &p)
+{
+    p.cu[BLOCK_8x8].dct = avx512_dct8;
+    p.cu[BLOCK_16x16].dct = avx512_dct16;
+    p.cu[BLOCK_32x32].dct = avx512_dct32;
+    p.cu[BLOCK_8x8].idct = avx512_idct8;
+    p.cu[BLOCK_16x16].idct = avx512_idct16;
+    p.cu[BLOCK_32x32].idct = avx512_idct32;
+    p.dequant_scaling = avx512_dequant_scaling;
+}
+}
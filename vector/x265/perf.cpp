@@ -23,9 +23,11 @@
 #include <chrono>
 #include <iostream>
 #include <thread>
+#include <vector>
 #include <math.h>
 
 #include "common.h"
+#include "perfcounters.h"
 
 void sse3_idct32(const int16_t *src, int16_t *dst, intptr_t stride);
 void sse3_idct16(const int16_t *src, int16_t *dst, intptr_t stride);
@@ -34,23 +36,63 @@ void ssse3_dct16(const int16_t *src, int16_t *dst, intptr_t stride);
 void ssse3_dct32(const int16_t *src, int16_t *dst, intptr_t stride);
 void sse41_dequant_scaling(const int16_t* quantCoef, const int32_t *deQuantCoef, int16_t* coef, int num, int per, int shift);
 
+// AVX2 and AVX-512 versions, linked into the binaries built for them
+#if defined(__AVX2__)
+void avx2_dct8(const int16_t *src, int16_t *dst, intptr_t stride);
+void avx2_dct16(const int16_t *src, int16_t *dst, intptr_t stride);
+void avx2_dct32(const int16_t *src, int16_t *dst, intptr_t stride);
+void avx2_idct8(const int16_t *src, int16_t *dst, intptr_t stride);
+void avx2_idct16(const int16_t *src, int16_t *dst, intptr_t stride);
+void avx2_idct32(const int16_t *src, int16_t *dst, intptr_t stride);
+void avx2_dequant_scaling(const int16_t* quantCoef, const int32_t *deQuantCoef, int16_t* coef, int num, int per, int shift);
+#endif
+#if defined(__AVX512F__) && defined(__AVX512BW__)
+void avx512_dct8(const int16_t *src, int16_t *dst, intptr_t stride);
+void avx512_dct16(const int16_t *src, int16_t *dst, intptr_t stride);
+void avx512_dct32(const int16_t *src, int16_t *dst, intptr_t stride);
+void avx512_idct8(const int16_t *src, int16_t *dst, intptr_t stride);
+void avx512_idct16(const int16_t *src, int16_t *dst, intptr_t stride);
+void avx512_idct32(const int16_t *src, int16_t *dst, intptr_t stride);
+void avx512_dequant_scaling(const int16_t* quantCoef, const int32_t *deQuantCoef, int16_t* coef, int num, int per, int shift);
+#endif
+
+// C references from dct-c.cpp, built with the same compiler and flags
+void idct32_c(const int16_t *src, int16_t *dst, intptr_t stride);
+void idct16_c(const int16_t *src, int16_t *dst, intptr_t stride);
+void idct8_c(const int16_t *src, int16_t *dst, intptr_t stride);
+void dct32_c(const int16_t *src, int16_t *dst, intptr_t stride);
+void dct8_c(const int16_t *src, int16_t *dst, intptr_t stride);
+void dct16_c(const int16_t *src, int16_t *dst, intptr_t stride);
+void dequant_scaling_c(const int16_t* quantCoef, const int32_t *deQuantCoef, int16_t* coef, int num, int per, int shift);
+
+typedef void (*transform_t)(const int16_t *src, int16_t *dst, intptr_t stride);
+typedef void (*dequant_scaling_t)(const int16_t* quantCoef, const int32_t *deQuantCoef, int16_t* coef, int num, int per, int shift);
+
+// A named implementation of a kernel
+template<typename F>
+struct Version {
+    const char *name;
+    F func;
+};
+
+typedef std::vector<Version<transform_t> > transform_versions;
+typedef std::vector<Version<dequant_scaling_t> > dequant_scaling_versions;
+
 const int iterations = 5000000;
 const double variance = 1.0 / sqrt(iterations);
 
 #define SLEEP(MSEC) std::this_thread::sleep_for(std::chrono::milliseconds(MSEC))
 
-#define DEFINE_TEST_WITH_MATRIX(func) \
-void test_##func(int W) { \
-    int16_t src[W * W]; \
-	int16_t dst[W * W]; \
-    random_fill(src, W * W); \
-    memset(dst, 0, W * W * sizeof(int16_t)); \
-    auto t1 = std::chrono::high_resolution_clock::now(); \
-    for (int i = 0; i < iterations; ++i) \
-        func(src, dst, W); \
-	auto t2 = std::chrono::high_resolution_clock::now(); \
-    double time_per_iteration = std::chrono::duration_cast<std::chrono::microseconds>(t2-t1).count() / (double) iterations; \
-	std::cout << #func ", " << time_per_iteration << ", " << time_per_iteration * variance << "\n"; \
+PerfCounters counters;
+
+// name, us/iteration, error, IPC, cycles/pixel, then L1D/LLC/branch misses per iteration
+void report(const std::string &name, double time_per_iteration, int pixels) {
+    std::cout << name << ", " << time_per_iteration << ", " << time_per_iteration * variance
+              << ", " << counters.ipc()
+              << ", " << counters.value[PerfCounters::CYCLES] / (double) iterations / pixels
+              << ", " << counters.value[PerfCounters::L1D_MISSES] / (double) iterations
+              << ", " << counters.value[PerfCounters::LLC_MISSES] / (double) iterations
+              << ", " << counters.value[PerfCounters::BRANCH_MISSES] / (double) iterations << "\n";
 }
 
 void random_fill(int16_t *src, size_t length) {
@@ -63,11 +105,152 @@ void random_fill(int32_t *src, size_t length) {
         src[i] = rand() % PIXEL_MAX;
 }
 
-void test_sse41_dequant_scaling(int log2Size, int qp) {
+/* Correctness checks, as in source/test/mbdstharness.cpp: every intrinsic
+ * version must match the C reference on check_iterations inputs, each drawn
+ * from one of the test cases below, before anything is timed. */
+const int check_iterations = 1000;
+
+enum { RANDOM_CASE, MIN_CASE, MAX_CASE, TEST_CASES };
+
+void fill_case(int16_t *src, size_t length, int index) {
+    if (index == RANDOM_CASE)
+        random_fill(src, length);
+    else
+        std::fill(src, src + length, (int16_t) (index == MIN_CASE ? -PIXEL_MAX : PIXEL_MAX));
+}
+
+void fill_case(int32_t *src, size_t length, int index) {
+    if (index == RANDOM_CASE)
+        random_fill(src, length);
+    else
+        std::fill(src, src + length, index == MIN_CASE ? -PIXEL_MAX : PIXEL_MAX);
+}
+
+bool check_transform(transform_t ref, transform_t opt, int W) {
+    ALIGN_VAR_32(int16_t, src[32 * 32]);
+    ALIGN_VAR_32(int16_t, ref_dst[32 * 32]);
+    ALIGN_VAR_32(int16_t, opt_dst[32 * 32]);
+
+    for (int i = 0; i < check_iterations; ++i) {
+        fill_case(src, W * W, rand() % TEST_CASES);
+        memset(ref_dst, 0, sizeof(ref_dst));
+        memset(opt_dst, 0, sizeof(opt_dst));
+
+        ref(src, ref_dst, W);
+        opt(src, opt_dst, W);
+
+        if (memcmp(ref_dst, opt_dst, W * W * sizeof(int16_t)))
+            return false;
+    }
+    return true;
+}
+
+bool check_dequant_scaling(dequant_scaling_t ref, dequant_scaling_t opt) {
+    ALIGN_VAR_32(int16_t, quantCoef[32 * 32]);
+    ALIGN_VAR_32(int32_t, dequantCoef[32 * 32]);
+    ALIGN_VAR_32(int16_t, ref_dst[32 * 32]);
+    ALIGN_VAR_32(int16_t, opt_dst[32 * 32]);
+
+    for (int i = 0; i < check_iterations; ++i) {
+        int log2Size = (rand() % 4) + 2;
+        int num = 1 << (2 * log2Size);
+        int qp = rand() % (QP_MAX_SPEC + QP_BD_OFFSET + 1);
+        int per = qp / 6;
+        int transformShift = MAX_TR_DYNAMIC_RANGE - X265_DEPTH - log2Size;
+        int shift = QUANT_IQUANT_SHIFT - QUANT_SHIFT - transformShift;
+
+        int index = rand() % TEST_CASES;
+        fill_case(quantCoef, num, index);
+        fill_case(dequantCoef, num, index);
+        memset(ref_dst, 0, sizeof(ref_dst));
+        memset(opt_dst, 0, sizeof(opt_dst));
+
+        ref(quantCoef, dequantCoef, ref_dst, num, per, shift);
+        opt(quantCoef, dequantCoef, opt_dst, num, per, shift);
+
+        if (memcmp(ref_dst, opt_dst, num * sizeof(int16_t)))
+            return false;
+    }
+    return true;
+}
+
+// Checks every version against the C reference, reporting the ones that fail
+template<typename F, typename Check>
+bool check_versions(const Version<F> &c, const std::vector<Version<F> > &simd, Check check) {
+    bool ok = true;
+    for (size_t v = 0; v < simd.size(); ++v) {
+        if (!check(c.func, simd[v].func)) {
+            std::cerr << simd[v].name << ": failed against " << c.name << "\n";
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+// One row of the speedup matrix: the C reference and an intrinsic version
+// timed on identical inputs, and whether their outputs are identical.
+struct Speedup {
+    std::string kernel;
+    std::string version;
+    double c_time;
+    double simd_time;
+    bool match;
+};
+
+std::vector<Speedup> speedups;
+
+double time_transform(const char *name, transform_t func, const int16_t *src, int16_t *dst, int W) {
+    counters.reset();
+    auto t1 = std::chrono::high_resolution_clock::now();
+    counters.start();
+    for (int i = 0; i < iterations; ++i)
+        func(src, dst, W);
+    counters.stop();
+    auto t2 = std::chrono::high_resolution_clock::now();
+    double time_per_iteration = std::chrono::duration_cast<std::chrono::microseconds>(t2-t1).count() / (double) iterations;
+    report(name, time_per_iteration, W * W);
+    return time_per_iteration;
+}
+
+void test_transform(const char *kernel, int W, const Version<transform_t> &c, const transform_versions &simd) {
+    ALIGN_VAR_32(int16_t, src[32 * 32]);
+    ALIGN_VAR_32(int16_t, c_dst[32 * 32]);
+    ALIGN_VAR_32(int16_t, simd_dst[32 * 32]);
+    random_fill(src, W * W);
+    memset(c_dst, 0, W * W * sizeof(int16_t));
+
+    double c_time = time_transform(c.name, c.func, src, c_dst, W);
+    for (size_t v = 0; v < simd.size(); ++v) {
+        SLEEP(1000);
+        memset(simd_dst, 0, W * W * sizeof(int16_t));
+        Speedup s;
+        s.kernel = kernel;
+        s.version = simd[v].name;
+        s.c_time = c_time;
+        s.simd_time = time_transform(simd[v].name, simd[v].func, src, simd_dst, W);
+        s.match = memcmp(c_dst, simd_dst, W * W * sizeof(int16_t)) == 0;
+        speedups.push_back(s);
+    }
+}
+
+double time_dequant_scaling(const std::string &name, dequant_scaling_t func, const int16_t *quantCoef,
+                            const int32_t *dequantCoef, int16_t *dstCoef, int num, int per, int shift) {
+    counters.reset();
+    auto t1 = std::chrono::high_resolution_clock::now();
+    counters.start();
+    for (int i = 0; i < iterations; ++i)
+        func(quantCoef, dequantCoef, dstCoef, num, per, shift);
+    counters.stop();
+    auto t2 = std::chrono::high_resolution_clock::now();
+    double time_per_iteration = std::chrono::duration_cast<std::chrono::microseconds>(t2-t1).count() / (double) iterations;
+    report(name, time_per_iteration, num);
+    return time_per_iteration;
+}
+
+void test_dequant_scaling(int log2Size, int qp, const dequant_scaling_versions &simd) {
     assert(log2Size <= 5 && log2Size >= 2);
     int width = 1 << log2Size;
     int num = width * width;
-    int cmp_size = sizeof(int16_t) * num;
 
     assert(qp < (QP_MAX_SPEC + QP_BD_OFFSET + 1) && qp >= 0);
     int per = qp / 6;
@@ -75,53 +258,122 @@ void test_sse41_dequant_scaling(int log2Size, int qp) {
     int transformShift = MAX_TR_DYNAMIC_RANGE - X265_DEPTH - log2Size;
     int shift = QUANT_IQUANT_SHIFT - QUANT_SHIFT - transformShift;
 
-    int16_t quantCoef[num];
+    ALIGN_VAR_32(int16_t, quantCoef[32 * 32]);
     random_fill(quantCoef, num);
 
-    int32_t dequantCoef[num];
+    ALIGN_VAR_32(int32_t, dequantCoef[32 * 32]);
     random_fill(dequantCoef, num);
 
-    int16_t dstCoef[num];
-    memset(dstCoef, 0, num * sizeof(int16_t));
+    ALIGN_VAR_32(int16_t, c_dstCoef[32 * 32]);
+    ALIGN_VAR_32(int16_t, simd_dstCoef[32 * 32]);
+    memset(c_dstCoef, 0, num * sizeof(int16_t));
 
-    auto t1 = std::chrono::high_resolution_clock::now();
-    for (int i = 0; i < iterations; ++i)
-        sse41_dequant_scaling(quantCoef, dequantCoef, dstCoef, num, per, shift);
-	auto t2 = std::chrono::high_resolution_clock::now();
-    double time_per_iteration = std::chrono::duration_cast<std::chrono::microseconds>(t2-t1).count() / (double) iterations;
-	std::cout << "sse41_dequant_scaling(num=" << num << "_qp=" << qp << "_shift=" << shift << "), "
-              << time_per_iteration << ", " << time_per_iteration * variance << "\n"; \
+    std::string args = "(num=" + std::to_string(num) + "_qp=" + std::to_string(qp) + "_shift=" + std::to_string(shift) + ")";
+    double c_time = time_dequant_scaling("dequant_scaling_c" + args, dequant_scaling_c,
+                                         quantCoef, dequantCoef, c_dstCoef, num, per, shift);
+    for (size_t v = 0; v < simd.size(); ++v) {
+        SLEEP(1000);
+        memset(simd_dstCoef, 0, num * sizeof(int16_t));
+        Speedup s;
+        s.kernel = "dequant_scaling" + args;
+        s.version = simd[v].name;
+        s.c_time = c_time;
+        s.simd_time = time_dequant_scaling(simd[v].name + args, simd[v].func,
+                                           quantCoef, dequantCoef, simd_dstCoef, num, per, shift);
+        s.match = memcmp(c_dstCoef, simd_dstCoef, num * sizeof(int16_t)) == 0;
+        speedups.push_back(s);
+    }
 }
 
-DEFINE_TEST_WITH_MATRIX(sse3_idct32)
-DEFINE_TEST_WITH_MATRIX(sse3_idct16)
-DEFINE_TEST_WITH_MATRIX(sse3_idct8)
-DEFINE_TEST_WITH_MATRIX(ssse3_dct32)
-DEFINE_TEST_WITH_MATRIX(ssse3_dct16)
+// kernel, version, C us/iteration, intrinsics us/iteration, speedup (C / intrinsics), outputs identical
+void report_speedups() {
+    std::cout << "\nkernel, version, c us/iteration, simd us/iteration, speedup, check\n";
+    for (size_t i = 0; i < speedups.size(); ++i) {
+        const Speedup &s = speedups[i];
+        std::cout << s.kernel << ", " << s.version << ", " << s.c_time << ", " << s.simd_time << ", "
+                  << (s.simd_time > 0 ? s.c_time / s.simd_time : 0.0) << ", "
+                  << (s.match ? "ok" : "mismatch") << "\n";
+    }
+}
 
 int main() {
     // Seed for random_fill
     srand(124U);
 
-    test_sse3_idct32(32);
+    if (!counters.enabled())
+        std::cerr << "hardware performance counters are not available, reporting zeros\n";
+
+    transform_versions idct32 = { {"sse3_idct32", sse3_idct32} };
+    transform_versions idct16 = { {"sse3_idct16", sse3_idct16} };
+    transform_versions idct8 = { {"sse3_idct8", sse3_idct8} };
+    transform_versions dct32 = { {"ssse3_dct32", ssse3_dct32} };
+    transform_versions dct16 = { {"ssse3_dct16", ssse3_dct16} };
+    transform_versions dct8;
+    dequant_scaling_versions dequant = { {"sse41_dequant_scaling", sse41_dequant_scaling} };
+#if defined(__AVX2__)
+    idct32.push_back({"avx2_idct32", avx2_idct32});
+    idct16.push_back({"avx2_idct16", avx2_idct16});
+    idct8.push_back({"avx2_idct8", avx2_idct8});
+    dct32.push_back({"avx2_dct32", avx2_dct32});
+    dct16.push_back({"avx2_dct16", avx2_dct16});
+    dct8.push_back({"avx2_dct8", avx2_dct8});
+    dequant.push_back({"avx2_dequant_scaling", avx2_dequant_scaling});
+#endif
+#if defined(__AVX512F__) && defined(__AVX512BW__)
+    idct32.push_back({"avx512_idct32", avx512_idct32});
+    idct16.push_back({"avx512_idct16", avx512_idct16});
+    idct8.push_back({"avx512_idct8", avx512_idct8});
+    dct32.push_back({"avx512_dct32", avx512_dct32});
+    dct16.push_back({"avx512_dct16", avx512_dct16});
+    dct8.push_back({"avx512_dct8", avx512_dct8});
+    dequant.push_back({"avx512_dequant_scaling", avx512_dequant_scaling});
+#endif
+
+    const Version<transform_t> idct32_ref = {"idct32_c", idct32_c};
+    const Version<transform_t> idct16_ref = {"idct16_c", idct16_c};
+    const Version<transform_t> idct8_ref = {"idct8_c", idct8_c};
+    const Version<transform_t> dct32_ref = {"dct32_c", dct32_c};
+    const Version<transform_t> dct16_ref = {"dct16_c", dct16_c};
+    const Version<transform_t> dct8_ref = {"dct8_c", dct8_c};
+    const Version<dequant_scaling_t> dequant_ref = {"dequant_scaling_c", dequant_scaling_c};
+
+    // A miscompiled kernel would otherwise only show up as a faster one
+    bool ok = true;
+    ok &= check_versions(idct32_ref, idct32, [](transform_t ref, transform_t opt) { return check_transform(ref, opt, 32); });
+    ok &= check_versions(idct16_ref, idct16, [](transform_t ref, transform_t opt) { return check_transform(ref, opt, 16); });
+    ok &= check_versions(idct8_ref, idct8, [](transform_t ref, transform_t opt) { return check_transform(ref, opt, 8); });
+    ok &= check_versions(dct32_ref, dct32, [](transform_t ref, transform_t opt) { return check_transform(ref, opt, 32); });
+    ok &= check_versions(dct16_ref, dct16, [](transform_t ref, transform_t opt) { return check_transform(ref, opt, 16); });
+    ok &= check_versions(dct8_ref, dct8, [](transform_t ref, transform_t opt) { return check_transform(ref, opt, 8); });
+    ok &= check_versions(dequant_ref, dequant, check_dequant_scaling);
+    if (!ok) {
+        std::cerr << "intrinsic kernels do not match the C reference, not timing them\n";
+        return 1;
+    }
+
+    std::cout << "function, us/iteration, error, ipc, cycles/pixel, l1d misses, llc misses, branch misses\n";
+    test_transform("idct32", 32, idct32_ref, idct32);
     SLEEP(1000);
-    test_sse3_idct16(16);
+    test_transform("idct16", 16, idct16_ref, idct16);
     SLEEP(1000);
-    test_sse3_idct8(8);
+    test_transform("idct8", 8, idct8_ref, idct8);
     SLEEP(1000);
 
-    test_ssse3_dct32(32);
+    test_transform("dct32", 32, dct32_ref, dct32);
     SLEEP(1000);
-    test_ssse3_dct16(16);
+    test_transform("dct16", 16, dct16_ref, dct16);
+    SLEEP(1000);
+    test_transform("dct8", 8, dct8_ref, dct8);
     SLEEP(1000);
 
     for (int qp = 0; qp < QP_MAX_SPEC + QP_BD_OFFSET + 1; qp += 6) {
-        test_sse41_dequant_scaling(5, qp);
+        test_dequant_scaling(5, qp, dequant);
         SLEEP(1000);
-        test_sse41_dequant_scaling(4, qp);
+        test_dequant_scaling(4, qp, dequant);
         SLEEP(1000);
-        test_sse41_dequant_scaling(3, qp);
+        test_dequant_scaling(3, qp, dequant);
         SLEEP(1000);
     }
-}
 
+    report_speedups();
+}
@@ -0,0 +1,116 @@
+/*****************************************
+ * Hardware performance counters for the kernel benchmarks.
+ *
+ * Opens a Linux perf_event group (cycles, instructions, L1D read misses,
+ * LLC read misses, branch misses) for the calling thread. When the
+ * counters are not available (other OS, perf_event_paranoid, virtual
+ * machine) every value reads as zero and the benchmark still runs.
+ ****************************************/
+
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+struct PerfCounters
+{
+    enum { CYCLES, INSTRUCTIONS, L1D_MISSES, LLC_MISSES, BRANCH_MISSES, COUNT };
+
+    uint64_t value[COUNT];
+
+    PerfCounters() : leader(-1), opened(0)
+    {
+        for (int i = 0; i < COUNT; ++i)
+        {
+            fd[i] = index[i] = -1;
+            value[i] = start_value[i] = 0;
+        }
+#if defined(__linux__)
+        const uint64_t cache = PERF_COUNT_HW_CACHE_OP_READ << 8 | PERF_COUNT_HW_CACHE_RESULT_MISS << 16;
+        const uint32_t types[COUNT] = { PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE, PERF_TYPE_HW_CACHE, PERF_TYPE_HARDWARE };
+        const uint64_t configs[COUNT] = { PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+            PERF_COUNT_HW_CACHE_L1D | cache, PERF_COUNT_HW_CACHE_LL | cache, PERF_COUNT_HW_BRANCH_MISSES };
+        for (int i = 0; i < COUNT; ++i)
+        {
+            perf_event_attr attr;
+            memset(&attr, 0, sizeof(attr));
+            attr.type = types[i];
+            attr.size = sizeof(attr);
+            attr.config = configs[i];
+            attr.disabled = leader < 0;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_GROUP;
+            fd[i] = (int)syscall(__NR_perf_event_open, &attr, 0, -1, leader, 0);
+            if (fd[i] < 0)
+            {
+                if (i == CYCLES)
+                    return;
+                continue;
+            }
+            if (i == CYCLES)
+                leader = fd[i];
+            index[i] = opened++;
+        }
+        ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+    }
+
+    ~PerfCounters()
+    {
+#if defined(__linux__)
+        for (int i = 0; i < COUNT; ++i)
+            if (fd[i] >= 0)
+                close(fd[i]);
+#endif
+    }
+
+    bool enabled() const { return leader >= 0; }
+
+    void reset()
+    {
+        for (int i = 0; i < COUNT; ++i)
+            value[i] = 0;
+    }
+
+    void start() { read(start_value); }
+
+    void stop()
+    {
+        uint64_t current[COUNT];
+        read(current);
+        for (int i = 0; i < COUNT; ++i)
+            value[i] += current[i] - start_value[i];
+    }
+
+    double ipc() const
+    {
+        return value[CYCLES] ? double(value[INSTRUCTIONS]) / value[CYCLES] : 0.0;
+    }
+
+private:
+    int leader, opened;
+    int fd[COUNT], index[COUNT];
+    uint64_t start_value[COUNT];
+
+    void read(uint64_t *values) const
+    {
+        uint64_t buffer[COUNT + 1] = { 0 };
+#if defined(__linux__)
+        if (enabled() && ::read(leader, buffer, sizeof(buffer)) < (ssize_t)sizeof(uint64_t))
+            buffer[0] = 0;
+#endif
+        for (int i = 0; i < COUNT; ++i)
+            values[i] = index[i] >= 0 && index[i] < (int)buffer[0] ? buffer[1 + index[i]] : 0;
+    }
+};
+
+#endif // PERF_COUNTERS_H